@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "chessbot/CBoard.h"
+
+static const std::string KIWIPETE = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+// White is in check from the queen on d2
+static const std::string KIWIPETE_CHECK = "r3k2r/p1pp1pb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPqBPPP/R3K2R w KQkq - 0 1";
+
+// Includes generating the knight, king and sliding piece tables
+static void BM_ConstructDefault(benchmark::State &state) {
+    for (auto _ : state) {
+        CBoard board;
+        benchmark::DoNotOptimize(board);
+    }
+}
+BENCHMARK(BM_ConstructDefault)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseFenStart(benchmark::State &state) {
+    CBoard board;
+    std::string fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+    for (auto _ : state) {
+        board.setFen(fen);
+        benchmark::DoNotOptimize(board.getKey());
+    }
+}
+BENCHMARK(BM_ParseFenStart);
+
+static void BM_ParseFenKiwipete(benchmark::State &state) {
+    CBoard board;
+
+    for (auto _ : state) {
+        board.setFen(KIWIPETE);
+        benchmark::DoNotOptimize(board.getKey());
+    }
+}
+BENCHMARK(BM_ParseFenKiwipete);
+
+static void BM_WhitePawnPushes(benchmark::State &state) {
+    CBoard board(KIWIPETE);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.pawnPushTargets<enumColour::white>());
+        benchmark::DoNotOptimize(board.pawnDoublePushTargets<enumColour::white>());
+        benchmark::DoNotOptimize(board.pawnsCanPush<enumColour::white>());
+        benchmark::DoNotOptimize(board.pawnsCanDoublePush<enumColour::white>());
+    }
+}
+BENCHMARK(BM_WhitePawnPushes);
+
+static void BM_BlackPawnPushes(benchmark::State &state) {
+    CBoard board(KIWIPETE);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(board.pawnPushTargets<enumColour::black>());
+        benchmark::DoNotOptimize(board.pawnDoublePushTargets<enumColour::black>());
+        benchmark::DoNotOptimize(board.pawnsCanPush<enumColour::black>());
+        benchmark::DoNotOptimize(board.pawnsCanDoublePush<enumColour::black>());
+    }
+}
+BENCHMARK(BM_BlackPawnPushes);
+
+static void BM_GeneratePawnMoves(benchmark::State &state) {
+    CBoard board(KIWIPETE);
+    std::vector<CMove> moves;
+    moves.reserve(256);
+
+    for (auto _ : state) {
+        moves.clear();
+        board.generatePawnMoves(&moves);
+        benchmark::DoNotOptimize(moves.data());
+    }
+}
+BENCHMARK(BM_GeneratePawnMoves);
+
+template <enumGenType Type>
+static void BM_GenerateMoves(benchmark::State &state) {
+    CBoard board(Type == genEvasions ? KIWIPETE_CHECK : KIWIPETE);
+    std::vector<CMove> moves;
+    moves.reserve(256);
+
+    for (auto _ : state) {
+        moves.clear();
+        board.generateMoves<Type>(&moves);
+        benchmark::DoNotOptimize(moves.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * moves.size());
+}
+BENCHMARK_TEMPLATE(BM_GenerateMoves, genAll);
+BENCHMARK_TEMPLATE(BM_GenerateMoves, genCaptures);
+BENCHMARK_TEMPLATE(BM_GenerateMoves, genQuiets);
+BENCHMARK_TEMPLATE(BM_GenerateMoves, genEvasions);
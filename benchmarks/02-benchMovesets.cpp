@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+
+// Fixed seed so every run looks up the same occupancies
+// Anding three random numbers gives roughly 8 set bits, close to a middlegame board
+static std::vector<U64> randomOccupancies(int count) {
+    std::mt19937_64 rng(1070372);
+    std::vector<U64> occupancies(count);
+
+    for (auto &occ : occupancies) occ = rng() & rng() & rng();
+
+    return occupancies;
+}
+
+static const std::vector<U64> OCCUPANCIES = randomOccupancies(4096);
+
+// Each iteration looks up all 64 squares, so items processed counts lookups
+template <typename Lookup>
+static void runSliderLookups(benchmark::State &state, Lookup lookup) {
+    std::size_t i = 0;
+
+    for (auto _ : state) {
+        U64 occ = OCCUPANCIES[i++ & (OCCUPANCIES.size() - 1)];
+
+        for (int square = 0; square < 64; ++square) {
+            benchmark::DoNotOptimize(lookup(static_cast<enumSquare>(square), occ));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void BM_BishopMoveset(benchmark::State &state) {
+    CBoard board;
+    runSliderLookups(state, [&](enumSquare square, U64 occ) {
+        return board.getBishopMoveset(square, occ, 0ULL);
+    });
+}
+BENCHMARK(BM_BishopMoveset);
+
+static void BM_RookMoveset(benchmark::State &state) {
+    CBoard board;
+    runSliderLookups(state, [&](enumSquare square, U64 occ) {
+        return board.getRookMoveset(square, occ, 0ULL);
+    });
+}
+BENCHMARK(BM_RookMoveset);
+
+static void BM_QueenMoveset(benchmark::State &state) {
+    CBoard board;
+    runSliderLookups(state, [&](enumSquare square, U64 occ) {
+        return board.getQueenMoveset(square, occ, 0ULL);
+    });
+}
+BENCHMARK(BM_QueenMoveset);
+
+static void BM_KnightMoveset(benchmark::State &state) {
+    CBoard board;
+    runSliderLookups(state, [&](enumSquare square, U64 occ) {
+        return board.getKnightMoveset(square, occ);
+    });
+}
+BENCHMARK(BM_KnightMoveset);
+
+static void BM_KingMoveset(benchmark::State &state) {
+    CBoard board;
+    runSliderLookups(state, [&](enumSquare square, U64 occ) {
+        return board.getKingMoveset(square, occ);
+    });
+}
+BENCHMARK(BM_KingMoveset);
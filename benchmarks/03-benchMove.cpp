@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CMove.h"
+#include "chessbot/constants.h"
+
+static void BM_MoveEncode(benchmark::State &state) {
+    unsigned int i = 0;
+
+    for (auto _ : state) {
+        CMove move(static_cast<enumSquare>(i & 63), static_cast<enumSquare>((i >> 6) & 63), i >> 12);
+        benchmark::DoNotOptimize(move);
+        ++i;
+    }
+}
+BENCHMARK(BM_MoveEncode);
+
+static void BM_MoveDecode(benchmark::State &state) {
+    CMove move(enumSquare::e2, enumSquare::e4, 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(move);
+        benchmark::DoNotOptimize(move.getFrom());
+        benchmark::DoNotOptimize(move.getTo());
+        benchmark::DoNotOptimize(move.getFlags());
+        benchmark::DoNotOptimize(move.isCapture());
+    }
+}
+BENCHMARK(BM_MoveDecode);
+
+static void BM_MoveSetters(benchmark::State &state) {
+    CMove move;
+    unsigned int i = 0;
+
+    for (auto _ : state) {
+        move.setFrom(static_cast<enumSquare>(i & 63));
+        move.setTo(static_cast<enumSquare>((i >> 6) & 63));
+        move.setFlags(i >> 12);
+        benchmark::DoNotOptimize(move);
+        ++i;
+    }
+}
+BENCHMARK(BM_MoveSetters);
+
+static void BM_MoveToUci(benchmark::State &state) {
+    CMove move(enumSquare::e7, enumSquare::e8, Constants::N_PROMO_FLAG + 3);
+    char buffer[CMove::UCI_BUFFER_SIZE];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(move.toUci(buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_MoveToUci);
+
+static void BM_MoveToSan(benchmark::State &state) {
+    CBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+    char buffer[CMove::SAN_BUFFER_SIZE];
+
+    for (auto _ : state) {
+        for (auto move : moves) benchmark::DoNotOptimize(move.toSan(&board, buffer));
+    }
+
+    state.SetItemsProcessed(state.iterations() * moves.size());
+}
+BENCHMARK(BM_MoveToSan);
+
+static void BM_MoveFromSan(benchmark::State &state) {
+    CBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CMove::fromSan(board, "Nxf7"));
+    }
+}
+BENCHMARK(BM_MoveFromSan);
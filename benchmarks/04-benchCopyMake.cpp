@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/position.h"
+
+static const std::string KIWIPETE_POSITION = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+
+// Every legal move of Kiwipete made and taken back per iteration
+static void BM_MakeUnmake(benchmark::State &state) {
+    CBoard board(KIWIPETE_POSITION);
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+
+    for (auto _ : state) {
+        for (auto move : moves) {
+            board.makeMove(move);
+            benchmark::DoNotOptimize(board.getKey());
+            board.unmakeMove(move);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * moves.size());
+}
+BENCHMARK(BM_MakeUnmake);
+
+static void BM_CopyMake(benchmark::State &state) {
+    CBoard board(KIWIPETE_POSITION);
+    Position position(board);
+    std::vector<CMove> moves;
+    position.generateLegalMoves(&moves);
+
+    for (auto _ : state) {
+        for (auto move : moves) {
+            Position next = position;
+            next.makeMove(move);
+            benchmark::DoNotOptimize(next.key);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * moves.size());
+}
+BENCHMARK(BM_CopyMake);
+
+static void BM_PerftMakeUnmake(benchmark::State &state) {
+    CBoard board(KIWIPETE_POSITION);
+    U64 nodes = 0;
+
+    for (auto _ : state) {
+        nodes = board.perft(state.range(0));
+        benchmark::DoNotOptimize(nodes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+BENCHMARK(BM_PerftMakeUnmake)->Arg(3)->Unit(benchmark::kMillisecond);
+
+static void BM_PerftCopyMake(benchmark::State &state) {
+    CBoard board(KIWIPETE_POSITION);
+    Position position(board);
+    U64 nodes = 0;
+
+    for (auto _ : state) {
+        nodes = position.perft(state.range(0));
+        benchmark::DoNotOptimize(nodes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+BENCHMARK(BM_PerftCopyMake)->Arg(3)->Unit(benchmark::kMillisecond);
+
+// Depth 4 with 1 to 8 threads
+static void BM_PerftParallel(benchmark::State &state) {
+    CBoard board(KIWIPETE_POSITION);
+    Position position(board);
+    U64 nodes = 0;
+
+    for (auto _ : state) {
+        nodes = position.perftParallel(4, state.range(0));
+        benchmark::DoNotOptimize(nodes);
+    }
+
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+BENCHMARK(BM_PerftParallel)->RangeMultiplier(2)->Range(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
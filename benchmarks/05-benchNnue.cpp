@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "chessbot/bench.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CNnue.h"
+#include "chessbot/CTrainingData.h"
+#include "chessbot/nnue.h"
+
+static const std::vector<std::string> FEATURE_POSITIONS = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+};
+
+// A batch of 16384 packed positions turned into HalfKP features, args are the threads
+static void BM_ExtractFeatures(benchmark::State &state) {
+    constexpr std::size_t BATCH = 16384;
+
+    std::vector<TrainingEntry> entries;
+    for (std::size_t i = 0; i < BATCH; ++i) entries.push_back(CTrainingData::pack(CBoard(FEATURE_POSITIONS[i % 4]), 0, 0));
+
+    std::vector<int32_t> white(BATCH * Nnue::MAX_ACTIVE), black(BATCH * Nnue::MAX_ACTIVE);
+    std::vector<uint8_t> sideToMove(BATCH);
+    std::vector<float> score(BATCH), result(BATCH);
+    Nnue::FeatureBatch batch = { white.data(), black.data(), sideToMove.data(), score.data(), result.data() };
+
+    for (auto _ : state) {
+        Nnue::extract(entries.data(), BATCH, Nnue::halfKP, batch, state.range(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+BENCHMARK(BM_ExtractFeatures)->Arg(1)->Arg(4)->UseRealTime();
+
+static std::vector<CBoard> benchBoards() {
+    std::vector<CBoard> boards;
+    for (const auto &fen : Bench::POSITIONS) boards.emplace_back(fen);
+
+    return boards;
+}
+
+// Every bench position evaluated one at a time, the dense layers as matrix-vector products
+static void BM_NnueEvaluate(benchmark::State &state) {
+    CNnue network;
+    network.randomise(1);
+    std::vector<CBoard> boards = benchBoards();
+
+    for (auto _ : state) {
+        for (const auto &board : boards) benchmark::DoNotOptimize(network.evaluate(board));
+    }
+
+    state.SetItemsProcessed(state.iterations() * boards.size());
+}
+BENCHMARK(BM_NnueEvaluate);
+
+// The same positions as one batch, args are the threads
+static void BM_NnueEvaluateBatch(benchmark::State &state) {
+    CNnue network;
+    network.randomise(1);
+    std::vector<CBoard> boards = benchBoards();
+    std::vector<int> scores(boards.size());
+
+    for (auto _ : state) {
+        network.evaluate(boards.data(), boards.size(), scores.data(), state.range(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * boards.size());
+}
+BENCHMARK(BM_NnueEvaluateBatch)->Arg(1)->UseRealTime();
@@ -1,20 +1,102 @@
+#ifndef CBOARD_H
+#define CBOARD_H
+
 #include <array>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "CMove.h"
 #include "enums.h"
 #include "types.h"
 
+// Check and pin information for the side to move
+// Computed once per position when it is reached, so the move generator and search can share it
+struct CheckInfo {
+    // Enemy pieces giving check
+    U64 checkers;
+
+    // Our pieces pinned to our king
+    U64 pinned;
+
+    // Our pieces which give a discovered check if they move off the line to the enemy king
+    U64 discoverers;
+
+    // Squares from which each of our piece types would attack the enemy king, indexed by enumPiece
+    std::array<U64, 8> checkSquares;
+};
+
+// Everything needed to undo a move which cannot be recovered from the move itself
+struct BoardState {
+    uint8_t captured;
+    int castling;
+    enumSquare enPassant;
+    int halfmoves;
+
+    // Zobrist key of the position before the move
+    U64 key;
+
+    // Check information of the position before the move
+    CheckInfo checkInfo;
+};
+
 class CBoard {
     public:
         // Constructors
         CBoard();
         CBoard(std::string fen);
 
+        // Replaces the position without regenerating the precomputed movesets
+        void setFen(std::string fen);
+
+        // Generates the precomputed movesets on the first call, the constructors call it
+        // Only code which uses the movesets without constructing a board needs to
+        static void initMovesets();
+
         // Game related functions
         void changeTurn();
 
+        // Moves are assumed to be pseudo-legal for the side to move
+        void makeMove(CMove move);
+        void unmakeMove(CMove move);
+
+        // Passes the turn, used by null move pruning
+        // The halfmove clock is reset so repetition detection does not look back past the null move
+        void makeNullMove();
+        void unmakeNullMove();
+
+        // Draw detection, ply is the distance from the search root
+        // Repetitions inside the search tree count as a draw straight away, earlier ones need to occur twice
+        // The fifty move rule does not check whether the final move delivered mate
+        bool isFiftyMoveDraw() const;
+        bool isRepetition(int ply) const;
+        bool isDraw(int ply) const;
+
+        // Whether the side to move has a reversible move which repeats an earlier position,
+        // letting search score the node as a draw a ply early
+        bool hasUpcomingRepetition(int ply) const;
+
+        // Attack queries
+        // attackersTo returns attackers of both colours given an arbitrary occupancy
+        U64 attackersTo(enumSquare square, U64 occupied) const;
+        bool isSquareAttacked(enumSquare square, enumPiece byColour) const;
+        bool isInCheck() const;
+        U64 getCheckers() const;
+        U64 getPinnedPieces() const;
+        bool givesCheck(CMove move) const;
+
+        // Move generation
+        // generateMoves is pseudo-legal, isLegal filters out moves which leave the king in check
+        // The templated form generates one kind of move, evasions only when the side to move is in check
+        template <enumGenType Type> void generateMoves(std::vector<CMove> *moves) const;
+        void generateMoves(std::vector<CMove> *moves) const;
+        void generateLegalMoves(std::vector<CMove> *moves) const;
+        bool isLegal(CMove move) const;
+
+        // Counts leaf nodes of the legal move tree, for validating move generation
+        U64 perft(int depth);
+
         // Utility functions
         U64 getOccupiedSquares() const;
         U64 getEmptySquares() const;
@@ -22,6 +104,9 @@ class CBoard {
         U64 getPieceSet(enumPiece piece) const;
         U64 getPieceSet(enumPiece piece, enumPiece colour) const;
 
+        // Every bitboard at once, indexed by enumPiece
+        const std::array<U64, 8> &getPieceSets() const;
+
         bool getSquare(U64 board, enumSquare square) const;
         bool getSquare(enumPiece board, enumSquare square) const;
 
@@ -31,19 +116,59 @@ class CBoard {
         void unsetSquare(U64 *board, enumSquare square) const;
         void unsetSquare(enumPiece board, enumSquare square);
 
+        // Mailbox lookups, see Constants::PIECE_TYPE_MASK for the encoding
+        uint8_t pieceOn(enumSquare square) const;
+        enumPiece pieceTypeOn(enumSquare square) const;
+        enumPiece pieceColourOn(enumSquare square) const;
+
+        // Checks that the mailbox agrees with pieceBB_, that no square holds more than one piece
+        // and that the incrementally updated Zobrist key matches one computed from scratch
+        bool isConsistent() const;
+
         // Getters
+        U64 getKey() const;
+        enumColour getSideToMove() const;
         int getCastleState() const;
+        enumSquare getEnPassantSquare() const;
+        int getHalfmoves() const;
+        int getFullmoves() const;
 
         const Movesets *getKnightMovesets() const;
         const Movesets *getKingMovesets() const;
-        const U64 getKnightMoveset(enumSquare square, U64 friendlyPieces);
-        const U64 getKingMoveset(enumSquare square, U64 friendlyPieces);
+        static const U64 getKnightMoveset(enumSquare square, U64 friendlyPieces);
+        static const U64 getKingMoveset(enumSquare square, U64 friendlyPieces);
 
         const Movesets *getBishopBlockerMasks() const;
         const Movesets *getRookBlockerMasks() const;
-        const U64 getBishopMoveset(enumSquare square, U64 blockers, U64 friendlyPieces);
-        const U64 getRookMoveset(enumSquare square, U64 blockers, U64 friendlyPieces);
-        const U64 getQueenMoveset(enumSquare square, U64 blockers, U64 friendlyPieces);
+        static const U64 getBishopMoveset(enumSquare square, U64 blockers, U64 friendlyPieces);
+        static const U64 getRookMoveset(enumSquare square, U64 blockers, U64 friendlyPieces);
+        static const U64 getQueenMoveset(enumSquare square, U64 blockers, U64 friendlyPieces);
+
+        // Squares attacked by pawns of the given colour standing on the squares in pawns
+        static U64 pawnAttacks(enumPiece colour, U64 pawns);
+
+        // Set-wise pawn pushes of the given colour
+        template <enumColour Us> U64 pawnPushTargets() const;
+        template <enumColour Us> U64 pawnDoublePushTargets() const;
+        template <enumColour Us> U64 pawnsCanPush() const;
+        template <enumColour Us> U64 pawnsCanDoublePush() const;
+
+        // Set-wise pawn attacks, regardless of whether there is anything to capture
+        // East and west are as seen from White for both colours
+        template <enumColour Us> U64 pawnEastAttacks() const;
+        template <enumColour Us> U64 pawnWestAttacks() const;
+        template <enumColour Us> U64 pawnAnyAttacks() const;
+
+        // Attacked squares holding an enemy piece
+        template <enumColour Us> U64 pawnEastCaptureTargets() const;
+        template <enumColour Us> U64 pawnWestCaptureTargets() const;
+
+        // Attacked squares matching the en passant target square
+        template <enumColour Us> U64 pawnEastEnPassantTargets() const;
+        template <enumColour Us> U64 pawnWestEnPassantTargets() const;
+
+        // Appends all pseudo-legal pawn moves for the side to move, including promotions and en passant
+        void generatePawnMoves(std::vector<CMove> *moves) const;
 
         // Printing bitboards
         void printBB(U64 board);
@@ -52,48 +177,58 @@ class CBoard {
         void parseFen(std::string fen);
         void parseFENPieces(std::string fen);
 
-        enumSquare getSquareFromCoords(int rank, int file);
+        static enumSquare getSquareFromCoords(int rank, int file);
+
+        U64 getEnPassantSet() const;
+
+        U64 computeKey() const;
+
+        // Update pieceBB_ and the mailbox together
+        void putPiece(enumPiece colour, enumPiece piece, enumSquare square);
+        void removePiece(enumSquare square);
+        void movePiece(enumSquare from, enumSquare to);
+        void rehashSquare(enumSquare square, uint8_t previous);
 
-        U64 shiftNorthOne(U64 bitboard);
-        U64 shiftSouthOne(U64 bitboard);
+        // Pieces of either colour which are the only piece between square and a slider in snipers
+        U64 sliderBlockers(enumSquare square, U64 snipers) const;
 
-        U64 wPawnPushTargets();
-        U64 bPawnPushTargets();
-        U64 wPawnDoublePushTargets();
-        U64 bPawnDoublePushTargets();
-        U64 wPawnsCanPush();
-        U64 bPawnsCanPush();
-        U64 wPawnsCanDoublePush();
-        U64 bPawnsCanDoublePush();
+        void updateCheckInfo();
 
-        void generateNonSlidingMovesets(const int *deltaRank, const int *deltaFile, Movesets *moveset);
-        void generateKnightMovesets();
-        void generateKingMovesets();
+        // Move generation specialised for the side to move, so colour and piece branches are resolved at compile time
+        template <enumColour Us, enumGenType Type> void generateColourMoves(std::vector<CMove> *moves) const;
+        template <enumColour Us, enumGenType Type> void generatePawnMoves(U64 targets, std::vector<CMove> *moves) const;
+        template <enumColour Us, enumPiece Piece> void generatePieceMoves(U64 targets, std::vector<CMove> *moves) const;
+        template <enumColour Us> void generateCastlingMoves(std::vector<CMove> *moves) const;
+        template <enumPiece Piece> U64 pieceAttacks(enumSquare square, U64 occupied) const;
+
+        void serialisePawnMoves(U64 targets, int fromOffset, unsigned int flags, std::vector<CMove> *moves) const;
+        void serialisePromotions(U64 targets, int fromOffset, unsigned int knightFlag, std::vector<CMove> *moves) const;
+
+        static void generateNonSlidingMovesets(const int *deltaRank, const int *deltaFile, Movesets *moveset);
+        static void generateKnightMovesets();
+        static void generateKingMovesets();
 
         // Masks generated using the classical rays technique
-        void generateBlockerMasks(enumPiece piece);
+        template <enumPiece Piece> static void generateBlockerMasks();
 
-        U64 clearEdges(U64 bb, enumSquare square);
+        static U64 clearEdges(U64 bb, enumSquare square);
 
-        bool isLegalSquare(int rank, int file);
-        bool isEdge(enumSquare square);
-        bool isCorner(enumSquare square);
-        bool isOrthogonallyAdjacent(enumSquare s1, enumSquare s2);
+        static bool isLegalSquare(int rank, int file);
+        static bool isEdge(enumSquare square);
+        static bool isCorner(enumSquare square);
+        static bool isOrthogonallyAdjacent(enumSquare s1, enumSquare s2);
 
-        void generateSlidingMovesets(enumPiece piece);
-        void getCombination(std::vector<BlockerVector> *combinations, BlockerVector *blockers, int nBlockers);
-        void getCombinationRecurse(
-            std::vector<BlockerVector> *combinations,
-            BlockerVector *blockers,
-            BlockerVector *currCombination,
-            int start, int end, int currCombIdx, int combSize
-        );
-        U64 getMovesetFromBlockers(enumSquare square, enumPiece piece, U64 blockerBB);
+        template <enumPiece Piece> static void generateSlidingMovesets();
+        template <enumPiece Piece> static U64 getMovesetFromBlockers(enumSquare square, U64 blockerBB);
 
         // Elements correspond to enum enumPiece
         // i.e. pieceBB_[0] is a bitboard representing all White pieces
         std::array<U64, 8> pieceBB_;
 
+        // Piece on each square, kept in sync with pieceBB_
+        // Encoded as described at Constants::PIECE_TYPE_MASK
+        std::array<uint8_t, 64> mailbox_;
+
         // Current side to move (White or Black)
         enumColour sideToMove_;
 
@@ -113,13 +248,23 @@ class CBoard {
         // Incremented after Black's move
         int fullmoves_;
 
-        // TODO
-        // Repeated positions count (for stalemates)
+        // Zobrist key of the current position, updated incrementally
+        U64 key_;
+
+        // Check information of the current position
+        CheckInfo checkInfo_;
+
+        // One entry per move made, popped by unmakeMove
+        // Also serves as the key history for repetition detection
+        std::vector<BoardState> history_;
+
+        // Precomputed movesets, generated once by initMovesets and shared by every board, so boards are cheap
+        // to construct and copy. Position and the bitbase generator look up their attacks here too
 
         // Precomputed non-sliding piece movesets
         // Pawns can be calculated because dealing with different colours is hard
-        Movesets knightMovesets_;
-        Movesets kingMovesets_;
+        static Movesets knightMovesets_;
+        static Movesets kingMovesets_;
 
         // Precomputed sliding piece moveset generators
         // https://stackoverflow.com/questions/16925204/sliding-move-generation-using-magic-bitboard
@@ -129,15 +274,13 @@ class CBoard {
 
         // Note: The edges do not have to be included because the piece is able to
         // move to an edge square regardless of whether there is a piece there or not
-        Movesets bishopBlockerMasks_;
-        Movesets rookBlockerMasks_;
-
-        // Blockers in vector of squares form, to simplify generation of all possble blockers.
-        std::array<BlockerVector, 64> bishopBlockerVectors_;
-        std::array<BlockerVector, 64> rookBlockerVectors_;
+        static Movesets bishopBlockerMasks_;
+        static Movesets rookBlockerMasks_;
 
         // Bitboards representing the attack set of a bishop/rook given a particular square and
         // an index derived from hashing the current blocking pieces via the magic numbers in magics_64.h
-        std::array<std::unordered_map<U64, U64>, 64> bishopMovesets_;
-        std::array<std::unordered_map<U64, U64>, 64> rookMovesets_;
+        static std::array<std::unordered_map<U64, U64>, 64> bishopMovesets_;
+        static std::array<std::unordered_map<U64, U64>, 64> rookMovesets_;
 };
+
+#endif
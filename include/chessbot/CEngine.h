@@ -0,0 +1,109 @@
+#ifndef CENGINE_H
+#define CENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CBoard.h"
+#include "CSearch.h"
+#include "CTranspositionTable.h"
+#include "types.h"
+
+struct EngineConfig {
+    // Searches run at once, each thread owns a searcher
+    int threads = 1;
+
+    // Size of the transposition table shared by every search
+    std::size_t hashMegabytes = 16;
+};
+
+// Cancels the searches it is given to, copies share the same flag
+class CCancelToken {
+    public:
+        CCancelToken();
+
+        void cancel();
+        bool isCancelled() const;
+    private:
+        std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+// Engine for use as a library, searches are queued from any thread and run on the engine's own threads
+// A search ends on its limits or once cancelled, a search without limits only ends once cancelled
+// Cancelled searches still return the best move found so far, or CMove() with depth 0 if they never started
+class CEngine {
+    public:
+        // Called on an engine thread, with each completed iteration and its principal variation
+        using InfoCallback = std::function<void(const SearchInfo &info)>;
+
+        // Called on an engine thread with the result, just before the future becomes ready
+        using ResultCallback = std::function<void(const SearchResult &result)>;
+
+        CEngine(const EngineConfig &config = EngineConfig());
+
+        // Cancels every search and waits for the threads
+        ~CEngine();
+
+        CEngine(const CEngine &) = delete;
+        CEngine &operator=(const CEngine &) = delete;
+
+        // Queues a search of a copy of board, searches start in the order they are queued
+        // Exceptions thrown by the callbacks are passed on through the future
+        std::future<SearchResult> search(const CBoard &board, const SearchLimits &limits, CCancelToken token = CCancelToken(),
+                                         InfoCallback onInfo = nullptr, ResultCallback onResult = nullptr);
+
+        // Cancels every search queued or running
+        void cancelAll();
+
+        // Blocks until no search is queued or running
+        void wait();
+
+        // Waits for the searches, then forgets the transposition table and move ordering statistics
+        void newGame();
+
+        // Applies to searches started afterwards, the tables must outlive them
+        void setTablebases(const TablebaseConfig &config);
+
+        int getThreads() const;
+
+        // Searches queued but not started
+        std::size_t getQueued() const;
+    private:
+        struct Job {
+            CBoard board;
+            SearchLimits limits;
+            CCancelToken token;
+            InfoCallback onInfo;
+            ResultCallback onResult;
+            std::promise<SearchResult> promise;
+
+            // Value of epoch_ when queued, cancelAll moves epoch_ on
+            U64 epoch;
+        };
+
+        void workerLoop(CSearch *search);
+
+        std::unique_ptr<CTranspositionTable> tt_;
+        std::vector<std::unique_ptr<CSearch>> searches_;
+        std::vector<std::thread> threads_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable queueReady_;
+        std::condition_variable idle_;
+        std::deque<Job> queue_;
+        int running_;
+        bool stopping_;
+        TablebaseConfig tbConfig_;
+
+        std::atomic<U64> epoch_;
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef CENGINECLIENT_H
+#define CENGINECLIENT_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Blocking client for one session of CEngineService
+class CEngineClient {
+    public:
+        CEngineClient();
+
+        // Throws std::invalid_argument if the service cannot be reached
+        CEngineClient(const std::string &socketPath);
+
+        ~CEngineClient();
+
+        CEngineClient(const CEngineClient &) = delete;
+        CEngineClient &operator=(const CEngineClient &) = delete;
+
+        bool connect(const std::string &socketPath);
+        void close();
+        bool isConnected() const;
+
+        // Sends text as is, each command must end in a new line
+        bool send(std::string_view text);
+
+        // Next line from the service without its new line, false once the service has closed the session
+        bool readLine(std::string *line);
+
+        // Sends commands then reads lines up to and including the first starting with reply, which are added to lines
+        // Returns false if the session ends first
+        bool request(std::string_view commands, std::string_view reply, std::vector<std::string> *lines);
+    private:
+        int fd_;
+
+        // Received but not yet returned by readLine
+        std::string buffer_;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef CENGINESERVICE_H
+#define CENGINESERVICE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "CBoard.h"
+#include "CMove.h"
+#include "CSearch.h"
+#include "CTranspositionTable.h"
+#include "stats.h"
+#include "types.h"
+
+struct ServiceConfig {
+    // Path of the Unix domain socket, replaced if it already exists
+    std::string socketPath;
+
+    // Searches run at once, each worker owns a board and a searcher
+    int workers = 1;
+
+    // Size of the transposition table shared by every game
+    std::size_t hashMegabytes = 64;
+
+    // Connections beyond this are told so and closed
+    std::size_t maxSessions = 256;
+
+    // Budgets in milliseconds and nodes for each request, zero means no cap
+    // A request without a limit of its own, or asking for an infinite search, gets defaultMovetime
+    long long defaultMovetime = 1000;
+    long long maxMovetime = 0;
+    U64 maxNodes = 0;
+};
+
+// Long running engine serving many games over a Unix domain socket
+// Each connection is a game session speaking a subset of UCI, one command per line:
+//   uci, isready, ucinewgame, position [startpos | fen <fen>] [moves <move>...],
+//   go [depth <d>] [nodes <n>] [movetime <ms>] [wtime <ms> btime <ms> [winc <ms> binc <ms>] [movestogo <n>]],
+//   stop, latency, quit
+// go is answered by "info depth <d> score cp <s> nodes <n> time <ms> queue <us> latency <us>" and "bestmove <move>",
+// latency by "latency " and LatencyHistogram::toString of every request so far
+// Sessions only keep their starting position and moves, a worker sets its own board up from them for each search,
+// and the transposition table exists once per service
+class CEngineService {
+    public:
+        CEngineService(const ServiceConfig &config);
+        ~CEngineService();
+
+        CEngineService(const CEngineService &) = delete;
+        CEngineService &operator=(const CEngineService &) = delete;
+
+        // Binds the socket and starts the connection thread and workers, returns false if the socket cannot be bound
+        bool start();
+
+        // Finishes the searches in progress, closes every session and removes the socket
+        void stop();
+
+        bool isRunning() const;
+
+        // Time from reading each go to its search finishing, over all sessions
+        LatencyHistogram getLatency() const;
+
+        std::size_t getSessionCount() const;
+    private:
+        struct Session;
+
+        // A go request with a copy of its session's game, so the session may move on while it waits
+        struct Job {
+            std::shared_ptr<Session> session;
+            std::string fen;
+            std::vector<CMove> moves;
+            SearchLimits limits;
+            std::chrono::steady_clock::time_point received;
+        };
+
+        // Polls the listening socket and the sessions, handling every command but go itself
+        void ioLoop();
+        void workerLoop();
+
+        void acceptSessions();
+
+        // Returns false once the session should be closed
+        bool readSession(const std::shared_ptr<Session> &session);
+        bool handleCommand(const std::shared_ptr<Session> &session, const std::string &line);
+
+        void queueSearch(const std::shared_ptr<Session> &session, std::istream &in);
+        void closeSession(const std::shared_ptr<Session> &session);
+
+        // Applies the configured budgets to a request
+        SearchLimits budget(SearchLimits limits) const;
+
+        ServiceConfig config_;
+
+        std::unique_ptr<CTranspositionTable> tt_;
+
+        int listenFd_;
+
+        // Written to by stop() to wake the connection thread
+        int wakeFds_[2];
+
+        std::atomic<bool> running_;
+        std::thread ioThread_;
+        std::vector<std::thread> workers_;
+
+        // Only used by the connection thread, sessions by socket and a board to check their positions
+        std::unordered_map<int, std::shared_ptr<Session>> sessions_;
+        CBoard board_;
+        std::atomic<std::size_t> sessionCount_;
+
+        // Searches waiting for a worker, at most one per session
+        std::mutex queueMutex_;
+        std::condition_variable queueReady_;
+        std::deque<Job> queue_;
+
+        // Requests taken by the workers, for ageing the shared table
+        std::atomic<U64> requests_;
+
+        mutable std::mutex latencyMutex_;
+        LatencyHistogram latency_;
+};
+
+#endif
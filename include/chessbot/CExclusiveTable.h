@@ -0,0 +1,37 @@
+#ifndef CEXCLUSIVETABLE_H
+#define CEXCLUSIVETABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "CMove.h"
+#include "types.h"
+
+// Moves some thread of a parallel search is currently searching, for ABDADA's exclusive search of younger brothers
+// A slot holds one position and move, a collision overwrites it, which at worst has two threads search the same move
+class CExclusiveTable {
+    public:
+        CExclusiveTable(std::size_t slots = DEFAULT_SLOTS);
+
+        // Whether another thread is searching move from the position with this key
+        bool isBusy(U64 key, CMove move) const;
+
+        // Marks the move as being searched until left again
+        void enter(U64 key, CMove move);
+        void leave(U64 key, CMove move);
+
+        void clear();
+
+        std::size_t getSize() const;
+
+        static constexpr std::size_t DEFAULT_SLOTS = 1 << 15;
+    private:
+        static U64 moveKey(U64 key, CMove move);
+        std::atomic<U64> &slotFor(U64 moveKey) const;
+
+        std::unique_ptr<std::atomic<U64>[]> slots_;
+        std::size_t size_;
+};
+
+#endif
@@ -1,7 +1,19 @@
+#ifndef CMOVE_H
+#define CMOVE_H
+
+#include <cstddef>
+#include <string_view>
+
 #include "enums.h"
 
+class CBoard;
+
 class CMove {
     public:
+        // Longest strings plus the terminating NUL, e.g. "e7e8q" and "exd8=Q#"
+        static constexpr std::size_t UCI_BUFFER_SIZE = 6;
+        static constexpr std::size_t SAN_BUFFER_SIZE = 8;
+
         CMove(enumSquare from = enumSquare::a1,
               enumSquare to = enumSquare::a1,
               unsigned int flags = 0
@@ -16,6 +28,26 @@ class CMove {
         void setFlags(unsigned int flags);
 
         bool isCapture() const;
+
+        // Text conversions write into the caller's buffer, NUL-terminate it and return the length
+        // They do not allocate once each thread's scratch move list has grown, except to report errors
+
+        // Coordinate notation, e.g. e2e4 or e7e8q, "0000" for CMove()
+        std::size_t toUci(char *buffer) const;
+
+        // Standard algebraic notation with disambiguation and the check or mate suffix, "--" for CMove()
+        // The move must be legal, it is made and unmade on board to detect mate
+        std::size_t toSan(CBoard *board, char *buffer) const;
+
+        // The legal move matching the text, throw std::invalid_argument if there is none
+        // fromSan ignores check, mate and annotation suffixes, accepts castling written with zeros
+        // and also throws if the move is ambiguous
+        static CMove fromUci(const CBoard &board, std::string_view uci);
+        static CMove fromSan(const CBoard &board, std::string_view san);
+
+        bool operator==(const CMove &other) const = default;
     private:
         unsigned int move_;
-};
\ No newline at end of file
+};
+
+#endif
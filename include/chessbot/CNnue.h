@@ -0,0 +1,73 @@
+#ifndef CNNUE_H
+#define CNNUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CBoard.h"
+#include "nnue.h"
+#include "types.h"
+
+// NNUE network over HalfKP features, for scoring large numbers of unrelated positions
+// Features -> 2 x L1 accumulator (int16) -> clipped ReLU -> L2 -> clipped ReLU -> L3 -> clipped ReLU -> 1
+// The side to move's accumulator comes first, the output is in centipawns from its point of view
+// Batches run the dense layers as matrix-matrix products over tiles of positions, so each weight is loaded
+// once per tile rather than once per position
+class CNnue {
+    public:
+        static constexpr int L1 = 128;
+        static constexpr int L2 = 32;
+        static constexpr int L3 = 32;
+
+        // Accumulator value which the clipped ReLU maps to 1
+        static constexpr int FT_SCALE = 127;
+
+        // Every weight zero, so every position scores 0
+        CNnue();
+
+        // Throws std::invalid_argument if the file cannot be loaded
+        CNnue(const std::string &path);
+
+        // Files are a header followed by each layer's biases and weights in native byte order
+        bool load(const std::string &path);
+        bool save(const std::string &path) const;
+
+        // Small random weights from seed, for benchmarks and tests until a trained network is loaded
+        void randomise(U64 seed);
+
+        // The board needs exactly one king a side and at most Nnue::MAX_ACTIVE other pieces, which every legal
+        // position has. Throws std::invalid_argument for a board without, as setFen accepts some
+        int evaluate(const CBoard &board) const;
+
+        // Writes the score of each of count boards, the same as evaluate would give
+        // Throws std::invalid_argument once every thread has finished if any board fails the check above
+        void evaluate(const CBoard *boards, std::size_t count, int *scores, int threads = 1) const;
+    private:
+        // Accumulator of one perspective, sums of the feature transformer rows
+        // False, leaving the accumulator alone, when Nnue::activeFeatures rejects the board
+        bool accumulate(const CBoard &board, enumColour perspective, int16_t *accumulator) const;
+
+        // Input of the first dense layer for one position, each value written lanes times
+        // False, with every input zero, when the board is rejected
+        bool transform(const CBoard &board, float *input, int lanes) const;
+
+        // Scores rows positions whose first layer inputs are in input
+        template <int ROWS>
+        void propagate(const float *input, int *scores) const;
+
+        // Feature transformer, HALFKP_FEATURES rows of L1
+        std::vector<int16_t> ftWeights_;
+        std::vector<int16_t> ftBiases_;
+
+        // Dense layers, stored input-major: weight of input i to output o is at i * outputs + o
+        std::vector<float> l1Weights_;
+        std::vector<float> l1Biases_;
+        std::vector<float> l2Weights_;
+        std::vector<float> l2Biases_;
+        std::vector<float> outWeights_;
+        float outBias_;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef CPARALLELSEARCH_H
+#define CPARALLELSEARCH_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "CBoard.h"
+#include "CExclusiveTable.h"
+#include "CSearch.h"
+#include "CTranspositionTable.h"
+#include "types.h"
+
+// How the threads of a parallel search divide the work
+enum enumSmpMode {
+    // Every thread searches the whole tree, they only help each other through the transposition table
+    smpSharedHash,
+
+    // As above, but a move being searched by one thread is put off by the others until they have nothing else left
+    smpAbdada
+};
+
+// Several threads searching one position together, sharing a transposition table
+// The main thread decides when to stop and its result is returned, helpers are stopped once it is done
+// With one thread this is exactly a CSearch
+class CParallelSearch {
+    public:
+        CParallelSearch(CTranspositionTable *tt, int threads = 1, enumSmpMode mode = enumSmpMode::smpSharedHash);
+
+        // Helpers search their own copies, the board is searched in place by the main thread and left as it was given
+        // The node count is the total over every thread
+        SearchResult search(CBoard &board, const SearchLimits &limits);
+
+        // May be called from any thread, a stop sent before the search has started still ends it at once
+        // Stays set until resetStop
+        void stop();
+
+        // Called before starting the thread which will search, not by search itself, so a stop sent meanwhile is kept
+        void resetStop();
+
+        void clearHistory();
+
+        // Called by the main thread only, so its node counts are the main thread's
+        void setInfoCallback(std::function<void(const SearchInfo &)> callback);
+        void setTablebases(const TablebaseConfig &config);
+
+        // Not while searching
+        void setThreads(int threads);
+        void setMode(enumSmpMode mode);
+
+        int getThreads() const;
+        enumSmpMode getMode() const;
+
+        // Statistics of the main thread in the last search
+        const SearchStats &getStats() const;
+    private:
+        CTranspositionTable *tt_;
+        enumSmpMode mode_;
+        CExclusiveTable exclusive_;
+
+        // The first is the main thread, run on the caller's thread
+        std::vector<std::unique_ptr<CSearch>> searches_;
+
+        std::function<void(const SearchInfo &)> infoCallback_;
+        TablebaseConfig tbConfig_;
+
+        // Set once the main thread is done, checked by the helpers
+        std::atomic<bool> done_;
+
+        // Set by stop, checked by the main thread
+        std::atomic<bool> stopped_;
+};
+
+#endif
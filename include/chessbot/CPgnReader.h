@@ -0,0 +1,89 @@
+#ifndef CPGNREADER_H
+#define CPGNREADER_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CBoard.h"
+#include "CMove.h"
+#include "types.h"
+
+// One game of a PGN file, viewing the mapped file so it is only valid while the reader stays open
+struct PgnGame {
+    // The tag pair section and the movetext, neither is parsed until asked for
+    std::string_view tags;
+    std::string_view movetext;
+
+    // Byte offset of the game in the file, for reporting malformed games
+    std::size_t offset = 0;
+
+    // Value of the named tag as written, with any escapes left in, empty if the tag is missing
+    std::string_view tag(std::string_view name) const;
+};
+
+struct PgnStats {
+    U64 games = 0;
+    U64 malformed = 0;
+    U64 moves = 0;
+    U64 bytes = 0;
+    double seconds = 0.0;
+
+    double gamesPerSecond() const;
+};
+
+// Streaming reader for PGN files of any size
+// The file is memory mapped and read sequentially in place, pages behind the reader are released
+// so memory use stays constant. Games are separated by a blank line followed by a tag pair
+class CPgnReader {
+    public:
+        // Called with each well formed game, its moves and a board at the game's starting position
+        // The board belongs to the calling thread and may be changed, it is reset before the next game
+        using GameCallback = std::function<void(const PgnGame &game, const std::vector<CMove> &moves, CBoard *board)>;
+
+        CPgnReader();
+
+        // Throws std::invalid_argument if the file cannot be opened
+        CPgnReader(const std::string &path);
+
+        ~CPgnReader();
+
+        CPgnReader(const CPgnReader &) = delete;
+        CPgnReader &operator=(const CPgnReader &) = delete;
+
+        bool open(const std::string &path);
+        void close();
+        bool isOpen() const;
+
+        // Size of the file in bytes
+        std::size_t size() const;
+
+        // Splits off the next game, returns false at the end of the file
+        bool nextGame(PgnGame *game);
+        void rewind();
+
+        // Sets board to the game's starting position, from the FEN tag if there is one, and resolves its moves
+        // Returns false if the game is malformed, otherwise board is left at the final position
+        static bool parseGame(const PgnGame &game, CBoard *board, std::vector<CMove> *moves);
+
+        // Parses every game, splitting the file between threads at game boundaries
+        // The callback may be called from several threads at once, malformed games are counted and skipped
+        PgnStats forEachGame(const GameCallback &callback, int threads = 1) const;
+    private:
+        // Start of the first game beginning after the line containing p, end if there is none
+        static const char *nextGameStart(const char *p, const char *end);
+
+        // Splits off the game at *cursor, stopping at end
+        bool splitGame(const char **cursor, const char *end, PgnGame *game) const;
+
+        const char *data_;
+        std::size_t length_;
+
+        // Position of nextGame and the start of the pages not yet released
+        const char *cursor_;
+        const char *released_;
+};
+
+#endif
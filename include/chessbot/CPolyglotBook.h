@@ -0,0 +1,68 @@
+#ifndef CPOLYGLOTBOOK_H
+#define CPOLYGLOTBOOK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "CBoard.h"
+#include "CMove.h"
+#include "types.h"
+
+// Read-only Polyglot (.bin) opening book
+// The file is memory mapped and searched in place, lookups do not allocate
+// Entries are 16 bytes, big-endian: key 64 bits, move 16, weight 16, learn 32, sorted by key
+class CPolyglotBook {
+    public:
+        // More book moves than this for one position are ignored
+        static constexpr int MAX_MOVES = 64;
+
+        CPolyglotBook();
+
+        // Throws std::invalid_argument if the file cannot be opened or is not a whole number of entries
+        CPolyglotBook(const std::string &path);
+
+        ~CPolyglotBook();
+
+        CPolyglotBook(const CPolyglotBook &) = delete;
+        CPolyglotBook &operator=(const CPolyglotBook &) = delete;
+
+        bool open(const std::string &path);
+        void close();
+        bool isOpen() const;
+
+        // Number of entries in the book
+        std::size_t size() const;
+
+        // Key of the position as defined by the Polyglot format, which differs from CBoard::getKey
+        // The en passant file only counts when a pawn of the side to move can make the capture
+        static U64 computeKey(const CBoard &board);
+
+        // Writes up to maxMoves legal book moves for the position and their weights, returns how many were written
+        int probe(const CBoard &board, CMove *moves, uint16_t *weights, int maxMoves) const;
+
+        // Highest weighted book move, CMove() if the position is not in the book
+        CMove bestMove(const CBoard &board) const;
+
+        // Book move chosen with probability proportional to its weight, random is any uniformly distributed value
+        CMove weightedMove(const CBoard &board, U64 random) const;
+    private:
+        // Index of the first entry with a key not less than key
+        std::size_t lowerBound(U64 key) const;
+
+        U64 keyAt(std::size_t index) const;
+        uint16_t moveAt(std::size_t index) const;
+        uint16_t weightAt(std::size_t index) const;
+
+        // Squares the piece on from could move to, ignoring castling and checks
+        static U64 reachableSquares(const CBoard &board, enumSquare from);
+
+        // Converts a Polyglot move into a CMove with the flags from Constants, CMove() if it is not legal
+        static CMove decodeMove(const CBoard &board, uint16_t move);
+
+        const unsigned char *data_;
+        std::size_t length_;
+        std::size_t entries_;
+};
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef CSEARCH_H
+#define CSEARCH_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "CBoard.h"
+#include "CExclusiveTable.h"
+#include "CMove.h"
+#include "CSyzygy.h"
+#include "CTranspositionTable.h"
+#include "constants.h"
+#include "stats.h"
+#include "types.h"
+
+// Limits for a single search, zero means no limit
+// Times are in milliseconds, time and increment are indexed by enumColour
+struct SearchLimits {
+    int depth = Constants::MAX_PLY - 1;
+    U64 nodes = 0;
+    long long movetime = 0;
+    std::array<long long, 2> time = { 0, 0 };
+    std::array<long long, 2> increment = { 0, 0 };
+    int movestogo = 0;
+    bool infinite = false;
+};
+
+// Endgame tablebase probing, off while tablebases is null
+// Positions with fewer pieces than probeLimit are probed at any depth, ones with exactly probeLimit from probeDepth
+struct TablebaseConfig {
+    const CSyzygy *tablebases = nullptr;
+    int probeDepth = 1;
+    int probeLimit = CSyzygy::MAX_PIECES;
+
+    // Scores cursed wins and blessed losses as draws
+    bool rule50 = true;
+};
+
+// Reported after every completed iteration
+struct SearchInfo {
+    int depth;
+    int selDepth;
+    int score;
+    U64 nodes;
+    long long time;
+    int hashfull;
+    U64 tbHits;
+    std::vector<CMove> pv;
+};
+
+struct SearchResult {
+    // CMove() when the side to move has no legal moves
+    CMove bestMove;
+    int score;
+    int depth;
+    U64 nodes;
+};
+
+// Iterative deepening principal variation search with a quiescence search at the leaves
+// A CSearch is used by one thread at a time, stop() may be called from any thread
+class CSearch {
+    public:
+        CSearch(CTranspositionTable *tt);
+
+        // The board is searched in place and left as it was given
+        SearchResult search(CBoard &board, const SearchLimits &limits);
+
+        // Quiescence search only, pv is set to the captures leading to the quiet position it settles on
+        // The score is from the side to move's point of view and the board is left as it was given
+        int resolve(CBoard &board, std::vector<CMove> *pv);
+
+        void stop();
+
+        // Forget move ordering statistics, for a new game
+        void clearHistory();
+
+        void setInfoCallback(std::function<void(const SearchInfo &)> callback);
+
+        // Polled with the clock every few thousand nodes and when a search starts, the search stops once it returns true
+        // Unlike stop() it cannot be missed by a search which has not started yet
+        void setCancelCheck(std::function<bool()> check);
+
+        void setTablebases(const TablebaseConfig &config);
+
+        // Searches younger brothers exclusively with the other threads using the table (ABDADA), off while null
+        void setExclusiveTable(CExclusiveTable *table);
+
+        // One of several threads searching the same position, the transposition table is aged by their owner instead
+        void setShared(bool shared);
+
+        U64 getNodes() const;
+        U64 getTbHits() const;
+
+        // Statistics of the last search, all zero unless built with CHESSBOT_STATS
+        const SearchStats &getStats() const;
+    private:
+        int negamax(CBoard &board, int alpha, int beta, int depth, int ply, bool nullAllowed);
+        int quiescence(CBoard &board, int alpha, int beta, int ply);
+
+        // Cuts the root moves down to the ones keeping the tablebase result, when the root is in the tables
+        void probeRoot(CBoard &board);
+
+        // Wrappers which count and time calls when statistics are enabled
+        template <enumGenType Type> void generateMoves(const CBoard &board, std::vector<CMove> *moves);
+        int evaluate(const CBoard &board);
+
+        // Higher scores are searched first
+        void scoreMoves(const CBoard &board, const std::vector<CMove> &moves, CMove ttMove, int ply, std::vector<int> *scores) const;
+
+        // Swaps the best scoring move from index onwards into index
+        static CMove pickMove(std::vector<CMove> *moves, std::vector<int> *scores, std::size_t index);
+
+        void updateQuietStats(const CBoard &board, CMove best, const std::vector<CMove> &triedQuiets, int depth, int ply);
+        void updatePv(int ply, CMove move);
+
+        // Checks the clock and node limit every few thousand nodes, sets stop_ when either runs out
+        bool shouldStop();
+        long long elapsed() const;
+
+        static int scoreToTT(int score, int ply);
+        static int scoreFromTT(int score, int ply);
+
+        CTranspositionTable *tt_;
+        CExclusiveTable *exclusive_;
+        bool shared_;
+
+        std::atomic<bool> stop_;
+        SearchLimits limits_;
+        std::chrono::steady_clock::time_point start_;
+
+        // Time the search aims to use, 0 if it only stops on depth, nodes or stop()
+        long long allocatedTime_;
+
+        U64 nodes_;
+        int selDepth_;
+
+        TablebaseConfig tbConfig_;
+
+        // Largest piece count probed inside the tree, 0 once the root has been ranked with DTZ
+        int tbCardinality_;
+        U64 tbHits_;
+
+        // Legal root moves, cut down to the ones keeping the tablebase result when the root is in the tables
+        std::vector<CMove> rootMoves_;
+        bool rootInTb_;
+        int rootTbScore_;
+
+        SearchStats stats_;
+
+        // Quiet moves which caused a beta cutoff, two per ply
+        std::array<std::array<CMove, 2>, Constants::MAX_PLY> killers_;
+
+        // Quiet move success indexed by enumColour, from and to square
+        std::array<std::array<std::array<int, 64>, 64>, 2> history_;
+
+        // Triangular principal variation table
+        std::array<std::array<CMove, Constants::MAX_PLY + 1>, Constants::MAX_PLY + 1> pv_;
+        std::array<int, Constants::MAX_PLY + 1> pvLength_;
+
+        // Move lists reused at each ply so the search does not allocate
+        std::array<std::vector<CMove>, Constants::MAX_PLY + 1> moveLists_;
+        std::array<std::vector<int>, Constants::MAX_PLY + 1> moveScores_;
+        std::array<std::vector<CMove>, Constants::MAX_PLY + 1> triedQuiets_;
+
+        // Moves left until last because another thread was searching them
+        std::array<std::vector<CMove>, Constants::MAX_PLY + 1> deferredMoves_;
+
+        // Move lists for tablebase probes in the search, for the same reason
+        CSyzygy::MoveLists tbMoveLists_;
+
+        std::function<void(const SearchInfo &)> infoCallback_;
+        std::function<bool()> cancelCheck_;
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef CSYZYGY_H
+#define CSYZYGY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CBoard.h"
+#include "CMove.h"
+#include "types.h"
+
+// Win/draw/loss from the side to move's view
+// Cursed wins and blessed losses are decided by the fifty move rule
+enum enumWdl : int {
+    wdlLoss = -2,
+    wdlBlessedLoss = -1,
+    wdlDraw = 0,
+    wdlCursedWin = 1,
+    wdlWin = 2
+};
+
+// Read-only Syzygy endgame tablebases (.rtbw for win/draw/loss, .rtbz for distance to zeroing move)
+// Tables are memory mapped and their headers parsed by init, so probing does not allocate for the
+// tables themselves and several threads may probe at once
+// Positions with castling rights are never in the tables
+class CSyzygy {
+    public:
+        // Largest tables the index encoding supports
+        static constexpr int MAX_PIECES = 7;
+
+        // Move lists for each level of a probe, kept by the caller so probing in the search does not allocate
+        // Probes recurse a capture at a time, so a board with MAX_PIECES pieces needs at most this many levels,
+        // a probe of a bigger board which would need more fails
+        static constexpr int PROBE_DEPTH = MAX_PIECES + 2;
+        typedef std::array<std::vector<CMove>, PROBE_DEPTH> MoveLists;
+
+        CSyzygy();
+        ~CSyzygy();
+
+        CSyzygy(const CSyzygy &) = delete;
+        CSyzygy &operator=(const CSyzygy &) = delete;
+
+        // Loads every table found in a colon separated list of directories, replacing any loaded before
+        // Files which are not valid tables are skipped, returns the number of WDL tables loaded
+        int init(const std::string &paths);
+        void clear();
+
+        // Piece count of the largest WDL table loaded, 0 if there are none
+        int maxPieces() const;
+
+        // The board is searched in place and left as it was given
+        // Both return false if a table needed for the answer is missing
+        // Without lists they use their own, which allocates
+        bool probeWdl(CBoard &board, int *wdl) const;
+        bool probeWdl(CBoard &board, int *wdl, MoveLists *lists) const;
+
+        // Plies to the next capture or pawn move with best play, positive when winning, 0 for a draw
+        // Off by one at most, see the Syzygy documentation
+        bool probeDtz(CBoard &board, int *dtz) const;
+        bool probeDtz(CBoard &board, int *dtz, MoveLists *lists) const;
+
+        // Keeps only the root moves which preserve the best tablebase result
+        // score is set from the side to move's view, tablebase wins are scored as TB_WIN_SCORE
+        // rootProbe ranks with DTZ so the kept moves make progress, rootProbeWdl only needs the WDL tables
+        bool rootProbe(CBoard &board, std::vector<CMove> *moves, bool rule50, int *score) const;
+        bool rootProbeWdl(CBoard &board, std::vector<CMove> *moves, bool rule50, int *score) const;
+    private:
+        struct Table;
+
+        enum ProbeState {
+            probeFail,
+            probeOk,
+            // DTZ table holds the other side to move
+            probeChangeStm,
+            // Best move is a capture or pawn move, so DTZ is known without the table
+            probeZeroingBestMove
+        };
+
+        bool loadTable(const std::string &path, const std::string &name, bool dtz);
+
+        // Material key counting pieces of each type and colour, mirrored swaps the colours
+        static U64 materialKey(const CBoard &board, bool mirrored);
+
+        // Value stored for the position, which can be wrong if a capture is the best move
+        int probeTable(const CBoard &board, bool dtz, int wdl, ProbeState *state) const;
+
+        // Resolves captures (and pawn moves when checkZeroing is set) before trusting the table
+        // Both generate moves into lists level ply and recurse a level down
+        int searchZeroing(CBoard &board, bool checkZeroing, ProbeState *state, MoveLists *lists, int ply) const;
+
+        int probeDtz(CBoard &board, ProbeState *state, MoveLists *lists, int ply) const;
+
+        std::vector<std::unique_ptr<Table>> tables_;
+
+        // Tables indexed by both of their material keys
+        std::unordered_map<U64, Table *> wdlTables_;
+        std::unordered_map<U64, Table *> dtzTables_;
+
+        int maxPieces_;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef CTRAININGDATA_H
+#define CTRAININGDATA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "CBoard.h"
+#include "types.h"
+
+// A labelled position packed into 32 bytes
+struct TrainingEntry {
+    U64 occupied;
+
+    // One nibble per occupied square from a8 onwards, low nibble first: colour << 3 | (piece - nPawn)
+    std::array<uint8_t, 16> pieces;
+
+    // Centipawns from the side to move's point of view
+    int16_t score;
+
+    // 1 win, 0 draw, -1 loss for the side to move
+    int8_t result;
+
+    // enumColour
+    uint8_t sideToMove;
+
+    uint32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<TrainingEntry>);
+static_assert(sizeof(TrainingEntry) == 32);
+
+// Read-only file of training entries, memory mapped so batches are read straight out of it
+// The file is nothing but entries in native byte order
+class CTrainingData {
+    public:
+        CTrainingData();
+
+        // Throws std::invalid_argument if the file cannot be opened or is not a whole number of entries
+        CTrainingData(const std::string &path);
+
+        ~CTrainingData();
+
+        CTrainingData(const CTrainingData &) = delete;
+        CTrainingData &operator=(const CTrainingData &) = delete;
+
+        bool open(const std::string &path);
+        void close();
+        bool isOpen() const;
+
+        std::size_t size() const;
+        const TrainingEntry *data() const;
+        const TrainingEntry &operator[](std::size_t index) const;
+
+        // Positions with more than 32 pieces cannot be packed, they throw std::invalid_argument
+        static TrainingEntry pack(const CBoard &board, int score, int result);
+
+        // Sets pieceBB out as CBoard lays it out
+        // False for an entry no pack could have written, more than 32 pieces or an unknown piece code
+        static bool unpack(const TrainingEntry &entry, std::array<U64, 8> *pieceBB);
+
+        static bool write(const std::string &path, const std::vector<TrainingEntry> &entries);
+    private:
+        const TrainingEntry *entries_;
+        std::size_t size_;
+        std::size_t length_;
+};
+
+#endif
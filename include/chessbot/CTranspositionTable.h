@@ -0,0 +1,141 @@
+#ifndef CTRANSPOSITIONTABLE_H
+#define CTRANSPOSITIONTABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "CMove.h"
+#include "types.h"
+
+enum enumBound : uint8_t {
+    noBound,
+    upperBound,
+    lowerBound,
+    exactBound
+};
+
+// Unpacked contents of a table entry
+struct TTData {
+    CMove move;
+    int score;
+    int eval;
+    int depth;
+    enumBound bound;
+};
+
+// Shared hash table of search results
+// Entries are two words with the key stored xor'ed with the data, a torn write from another thread
+// then fails the key check instead of returning data belonging to a different position,
+// so the table can be shared between threads without locking, including searches of different games
+// It can also be placed in shared memory, where the same holds for several processes
+class CTranspositionTable {
+    public:
+        CTranspositionTable(std::size_t megabytes = 16);
+        ~CTranspositionTable();
+
+        CTranspositionTable(const CTranspositionTable &) = delete;
+        CTranspositionTable &operator=(const CTranspositionTable &) = delete;
+
+        // Discards all entries, a shared table is left to the other processes and replaced by a private one
+        // Throws std::bad_alloc, leaving the table as it was, if there is not enough memory
+        void resize(std::size_t megabytes);
+
+        // Clears a shared table for every process using it
+        void clear();
+
+        // Maps a POSIX shared memory segment ("/name") or a file as the table, shared by every process mapping it
+        // The first process sets up the header and the rest keep the entries already there
+        // Returns false and keeps the current table if it cannot be mapped or holds a different size, version or layout
+        bool openSharedMemory(const std::string &name, std::size_t megabytes);
+        bool openFile(const std::string &path, std::size_t megabytes);
+
+        // Removes a shared memory segment once every process has unmapped it
+        static bool removeSharedMemory(const std::string &name);
+
+        bool isShared() const;
+
+        // Writes every entry of at least minDepth to a compact snapshot file, replacing it only once complete
+        bool saveSnapshot(const std::string &path, int minDepth = 0, std::size_t *saved = nullptr) const;
+
+        // Adds the entries of a snapshot as results of the current search, where they are deeper than what is there
+        // Returns false, adding nothing, if the file is damaged or was written with different Zobrist keys
+        bool loadSnapshot(const std::string &path, std::size_t *loaded = nullptr);
+
+        // Called at the start of each search so entries from earlier searches are replaced first
+        void newSearch();
+
+        bool probe(U64 key, TTData *data) const;
+
+        // Whether the slot for key holds an entry for a different position
+        bool isCollision(U64 key) const;
+        void store(U64 key, CMove move, int score, int eval, int depth, enumBound bound);
+
+        // Permille of the first thousand entries written during the current search, as reported by UCI
+        int hashfull() const;
+
+        std::size_t getSize() const;
+    private:
+        struct Entry {
+            std::atomic<U64> key;
+            std::atomic<U64> data;
+        };
+
+        // Data layout (low to high): move 16 bits, score 16, eval 16, depth 8, bound 2, generation 6
+        static U64 pack(CMove move, int score, int eval, int depth, enumBound bound, uint8_t generation);
+        static uint8_t generationOf(U64 data);
+        static int depthOf(U64 data);
+
+        // Start of a shared table, followed by the entries
+        // Bump SHARED_VERSION whenever the entry encoding or this header changes
+        struct alignas(64) SharedHeader {
+            // Written last, once the rest is set up
+            std::atomic<U64> magic;
+            uint32_t version;
+            uint32_t entrySize;
+            U64 entries;
+            std::atomic<uint8_t> generation;
+        };
+
+        static constexpr U64 SHARED_MAGIC = 0x4854544f42535343ULL;
+        static constexpr uint32_t SHARED_VERSION = 1;
+
+        // Start of a snapshot file, followed by records of the key and the packed data
+        struct SnapshotHeader {
+            U64 magic;
+            uint32_t version;
+            uint32_t recordSize;
+            U64 zobrist;
+            U64 records;
+            U64 checksum;
+        };
+
+        static constexpr U64 SNAPSHOT_MAGIC = 0x50414e53544f4243ULL;
+        static constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+        static U64 checksum(U64 sum, U64 key, U64 data);
+
+        // Takes ownership of fd, which is closed either way
+        bool mapShared(int fd, std::size_t megabytes);
+        void unmapShared();
+
+        static std::size_t entriesFor(std::size_t megabytes);
+
+        Entry &entryFor(U64 key) const;
+
+        // Points into privateEntries_ or into the shared mapping
+        Entry *entries_;
+        std::size_t size_;
+        std::unique_ptr<Entry[]> privateEntries_;
+
+        // The shared header's generation while shared
+        std::atomic<uint8_t> *generation_;
+        std::atomic<uint8_t> privateGeneration_;
+
+        void *mapping_;
+        std::size_t mappingLength_;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "stats.h"
+#include "types.h"
+
+// Fixed depth search over a fixed set of positions
+// Single threaded and cleared between positions, so the node count only changes when the search does
+namespace Bench {
+    constexpr int DEFAULT_DEPTH = 7;
+
+    extern const std::array<std::string, 50> POSITIONS;
+
+    // Prints the nodes for each position followed by the totals, returns the total node count
+    // Search statistics over all positions are added to stats if given
+    U64 run(int depth, std::ostream &out, SearchStats *stats = nullptr);
+
+    constexpr int TTD_DEPTH = 8;
+    constexpr int TTD_POSITIONS = 10;
+
+    struct TimeToDepth {
+        int threads;
+        bool abdada;
+        long long milliseconds;
+        U64 nodes;
+    };
+
+    // Times parallel searches of the first positions to depth with each thread count, shared hash and ABDADA
+    // Prints each run with its speedup over one thread and returns them in the order printed
+    std::vector<TimeToDepth> timeToDepth(int depth, int positions, const std::vector<int> &threads, std::ostream &out);
+
+    struct WarmStart {
+        long long coldMilliseconds;
+        long long warmMilliseconds;
+        U64 coldNodes;
+        U64 warmNodes;
+
+        // Entries written to the snapshot, and the time to load them into an empty table
+        std::size_t entries;
+        long long loadMilliseconds;
+    };
+
+    // Searches the first positions to depth with an empty table, saves it to a snapshot at path,
+    // then searches them again with only the snapshot loaded and prints both times
+    WarmStart warmStart(int depth, int positions, const std::string &path, std::ostream &out);
+}
+
+#endif
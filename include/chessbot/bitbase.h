@@ -0,0 +1,39 @@
+#ifndef BITBASE_H
+#define BITBASE_H
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "CBoard.h"
+#include "types.h"
+
+// Win/draw bitbases of king and one piece against king, generated by retrograde analysis
+// The king and pawn table is embedded in kpk_bitbase.h, regenerate it with chessbot_engine bitbase
+// Tables are from the point of view of the side with the piece, one bit per position, set for a win
+namespace Bitbase {
+    // Index: side to move x piece square x strong king x weak king
+    // Pawns are mirrored onto files a to d and only stand on ranks 2 to 7, so they have 24 squares
+    constexpr std::size_t KPK_POSITIONS = 2 * 24 * 64 * 64;
+    constexpr std::size_t PIECE_POSITIONS = 2 * 64 * 64 * 64;
+
+    constexpr std::size_t KPK_WORDS = KPK_POSITIONS / 64;
+
+    // Index of a position with White as the strong side, a pawn must be on files a to d
+    std::size_t index(enumPiece piece, enumColour sideToMove, int strongKing, int weakKing, int pieceSquare);
+
+    // Solves king and piece (nPawn, nRook or nQueen) against king, slices of each pass run on threads
+    // Solving the pawn table solves the queen and rook tables first, for the promotions
+    std::vector<U64> generate(enumPiece piece, int threads = 1);
+
+    bool isWin(const std::vector<U64> &table, std::size_t index);
+
+    // True when the board is king and pawn against king, win is then whether the side with the pawn wins
+    // A single lookup in the embedded table
+    bool probeKpk(const CBoard &board, bool *win);
+
+    // Writes a table as a replacement for kpk_bitbase.h
+    void writeHeader(const std::vector<U64> &table, std::ostream &out);
+}
+
+#endif
@@ -0,0 +1,152 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <bit>
+#include <cstddef>
+
+#include "constants.h"
+#include "enums.h"
+#include "types.h"
+
+// Header-only bitboard primitives
+// Everything here is constexpr and branch-free, std::popcount and std::countr_zero
+// compile down to single POPCNT/TZCNT instructions when the target supports them
+namespace Bitboard {
+    constexpr U64 squareBB(enumSquare square) {
+        return 1ULL << square;
+    }
+
+    // Unlike CBoard::getSquare, no range checking is done here
+    constexpr bool testSquare(U64 bb, enumSquare square) {
+        return (bb >> square) & 1ULL;
+    }
+
+    constexpr int popcount(U64 bb) {
+        return std::popcount(bb);
+    }
+
+    constexpr bool moreThanOne(U64 bb) {
+        return bb & (bb - 1);
+    }
+
+    // Least and most significant set squares, bb must not be empty
+    constexpr enumSquare lsb(U64 bb) {
+        return static_cast<enumSquare>(std::countr_zero(bb));
+    }
+
+    constexpr enumSquare msb(U64 bb) {
+        return static_cast<enumSquare>(63 - std::countl_zero(bb));
+    }
+
+    // Removes the least significant set square from bb and returns it, bb must not be empty
+    constexpr enumSquare popLsb(U64 &bb) {
+        enumSquare square = lsb(bb);
+        bb &= bb - 1;
+        return square;
+    }
+
+    // Squares are numbered from a8 (bit 0) to h1 (bit 63)
+    // so north is towards the least significant bit and east is towards the most significant bit
+    // Shifts which change file mask off the file the bits would wrap around onto
+    constexpr U64 shiftNorth(U64 bb) {
+        return bb >> 8;
+    }
+
+    constexpr U64 shiftSouth(U64 bb) {
+        return bb << 8;
+    }
+
+    constexpr U64 shiftEast(U64 bb) {
+        return (bb << 1) & ~Constants::FILE_A;
+    }
+
+    constexpr U64 shiftWest(U64 bb) {
+        return (bb >> 1) & ~Constants::FILE_H;
+    }
+
+    constexpr U64 shiftNorthEast(U64 bb) {
+        return (bb >> 7) & ~Constants::FILE_A;
+    }
+
+    constexpr U64 shiftNorthWest(U64 bb) {
+        return (bb >> 9) & ~Constants::FILE_H;
+    }
+
+    constexpr U64 shiftSouthEast(U64 bb) {
+        return (bb << 9) & ~Constants::FILE_A;
+    }
+
+    constexpr U64 shiftSouthWest(U64 bb) {
+        return (bb << 7) & ~Constants::FILE_H;
+    }
+
+    // Squares strictly between s1 and s2 if they share a rank, file or diagonal, 0 otherwise
+    constexpr U64 between(enumSquare s1, enumSquare s2) {
+        int deltaRank = s2 / 8 - s1 / 8;
+        int deltaFile = s2 % 8 - s1 % 8;
+
+        if (deltaRank != 0 and deltaFile != 0 and deltaRank != deltaFile and deltaRank != -deltaFile) return 0ULL;
+
+        int step = ((deltaRank > 0) - (deltaRank < 0)) * 8 + (deltaFile > 0) - (deltaFile < 0);
+        U64 bb = 0ULL;
+
+        for (int square = s1 + step; square != s2; square += step) bb |= 1ULL << square;
+
+        return bb;
+    }
+
+    // Whether s2 and s3 lie on the same rank, file or diagonal through s1
+    constexpr bool aligned(enumSquare s1, enumSquare s2, enumSquare s3) {
+        int deltaRank2 = s2 / 8 - s1 / 8;
+        int deltaFile2 = s2 % 8 - s1 % 8;
+        int deltaRank3 = s3 / 8 - s1 / 8;
+        int deltaFile3 = s3 % 8 - s1 % 8;
+
+        bool isLine = deltaRank2 == 0 or deltaFile2 == 0 or deltaRank2 == deltaFile2 or deltaRank2 == -deltaFile2;
+
+        return isLine and deltaRank2 * deltaFile3 == deltaRank3 * deltaFile2;
+    }
+
+    // Forward iterator over the set squares of a bitboard, from a8 towards h1
+    class SquareIterator {
+        public:
+            using value_type = enumSquare;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr SquareIterator(U64 bb = 0ULL) : bb_(bb) {}
+
+            constexpr enumSquare operator*() const { return lsb(bb_); }
+
+            constexpr SquareIterator &operator++() {
+                bb_ &= bb_ - 1;
+                return *this;
+            }
+
+            constexpr SquareIterator operator++(int) {
+                SquareIterator prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            constexpr bool operator==(const SquareIterator &other) const { return bb_ == other.bb_; }
+        private:
+            U64 bb_;
+    };
+
+    class SquareRange {
+        public:
+            constexpr SquareRange(U64 bb) : bb_(bb) {}
+
+            constexpr SquareIterator begin() const { return SquareIterator(bb_); }
+            constexpr SquareIterator end() const { return SquareIterator(0ULL); }
+        private:
+            U64 bb_;
+    };
+
+    // Usage: for (auto square : Bitboard::squares(bb)) { ... }
+    constexpr SquareRange squares(U64 bb) {
+        return SquareRange(bb);
+    }
+}
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef CONSTANTS_H
 #define CONSTANTS_H
 
-#include <string>
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
 
 #include "enums.h"
 #include "types.h"
@@ -23,11 +25,36 @@ namespace Constants {
     constexpr unsigned int R_PROMO_CAPTURE_FLAG = 14;
     constexpr unsigned int Q_PROMO_CAPTURE_FLAG = 15;
 
+    // Bits of the move flags which mark promotions and captures,
+    // the promotion piece is indexed by the lowest two bits of the flags
+    constexpr unsigned int PROMO_FLAG_MASK = 8;
+    constexpr std::array<enumPiece, 4> PROMOTION_PIECES = {
+        enumPiece::nKnight, enumPiece::nBishop, enumPiece::nRook, enumPiece::nQueen
+    };
+
     constexpr unsigned int WHITE_KINGSIDE_CASTLE = 8;
     constexpr unsigned int WHITE_QUEENSIDE_CASTLE = 4;
     constexpr unsigned int BLACK_KINGSIDE_CASTLE = 2;
     constexpr unsigned int BLACK_QUEENSIDE_CASTLE = 1;
 
+    // Mailbox entries hold the piece type (enumPiece nPawn - nKing) in the low 3 bits
+    // and the colour (enumPiece nWhite or nBlack) in the bit above, 0 means the square is empty
+    constexpr uint8_t NO_PIECE = 0;
+    constexpr uint8_t PIECE_TYPE_MASK = 0x7;
+    constexpr int PIECE_COLOUR_SHIFT = 3;
+
+    // Castling rights which are lost once a piece moves from or to the given square
+    constexpr std::array<int, 64> CASTLING_RIGHTS_LOST = [] {
+        std::array<int, 64> rightsLost = {};
+        rightsLost[enumSquare::e1] = WHITE_KINGSIDE_CASTLE | WHITE_QUEENSIDE_CASTLE;
+        rightsLost[enumSquare::h1] = WHITE_KINGSIDE_CASTLE;
+        rightsLost[enumSquare::a1] = WHITE_QUEENSIDE_CASTLE;
+        rightsLost[enumSquare::e8] = BLACK_KINGSIDE_CASTLE | BLACK_QUEENSIDE_CASTLE;
+        rightsLost[enumSquare::h8] = BLACK_KINGSIDE_CASTLE;
+        rightsLost[enumSquare::a8] = BLACK_QUEENSIDE_CASTLE;
+        return rightsLost;
+    }();
+
     /* Binary version of mask
         11111111
         10000001
@@ -52,55 +79,73 @@ namespace Constants {
     */
     constexpr U64 CORNER_MASK = 9295429630892703873ULL;
 
-    const std::unordered_map<char, int> CASTLE_STRING_TO_INT_MAP = {
-        {'K', WHITE_KINGSIDE_CASTLE},
-        {'Q', WHITE_QUEENSIDE_CASTLE},
-        {'k', BLACK_KINGSIDE_CASTLE},
-        {'q', BLACK_QUEENSIDE_CASTLE}
-    };
+    // Lookups indexed by ASCII code, replacing hash maps so nothing runs at static initialisation
 
-    const std::unordered_map<char, enumPiece> PIECE_TO_ENUM_MAP = {
-        {'k', enumPiece::nKing},
-        {'q', enumPiece::nQueen},
-        {'b', enumPiece::nBishop},
-        {'n', enumPiece::nKnight},
-        {'r', enumPiece::nRook},
-        {'p', enumPiece::nPawn}
-    };
+    // FEN castling letter to its castling right, 0 for any other character
+    constexpr std::array<int, 128> CASTLE_CHAR_TO_RIGHTS = [] {
+        std::array<int, 128> rights = {};
+        rights['K'] = WHITE_KINGSIDE_CASTLE;
+        rights['Q'] = WHITE_QUEENSIDE_CASTLE;
+        rights['k'] = BLACK_KINGSIDE_CASTLE;
+        rights['q'] = BLACK_QUEENSIDE_CASTLE;
+        return rights;
+    }();
 
-    const std::unordered_map<std::string, enumSquare> SQUARE_STRING_TO_ENUM_MAP = {
-        {"a8", enumSquare::a8}, {"b8", enumSquare::b8}, {"c8", enumSquare::c8}, {"d8", enumSquare::d8}, {"e8", enumSquare::e8}, {"f8", enumSquare::f8}, {"g8", enumSquare::g8}, {"h8", enumSquare::h8},
-        {"a7", enumSquare::a7}, {"b7", enumSquare::b7}, {"c7", enumSquare::c7}, {"d7", enumSquare::d7}, {"e7", enumSquare::e7}, {"f7", enumSquare::f7}, {"g7", enumSquare::g7}, {"h7", enumSquare::h7},
-        {"a6", enumSquare::a6}, {"b6", enumSquare::b6}, {"c6", enumSquare::c6}, {"d6", enumSquare::d6}, {"e6", enumSquare::e6}, {"f6", enumSquare::f6}, {"g6", enumSquare::g6}, {"h6", enumSquare::h6},
-        {"a5", enumSquare::a5}, {"b5", enumSquare::b5}, {"c5", enumSquare::c5}, {"d5", enumSquare::d5}, {"e5", enumSquare::e5}, {"f5", enumSquare::f5}, {"g5", enumSquare::g5}, {"h5", enumSquare::h5},
-        {"a4", enumSquare::a4}, {"b4", enumSquare::b4}, {"c4", enumSquare::c4}, {"d4", enumSquare::d4}, {"e4", enumSquare::e4}, {"f4", enumSquare::f4}, {"g4", enumSquare::g4}, {"h4", enumSquare::h4},
-        {"a3", enumSquare::a3}, {"b3", enumSquare::b3}, {"c3", enumSquare::c3}, {"d3", enumSquare::d3}, {"e3", enumSquare::e3}, {"f3", enumSquare::f3}, {"g3", enumSquare::g3}, {"h3", enumSquare::h3},
-        {"a2", enumSquare::a2}, {"b2", enumSquare::b2}, {"c2", enumSquare::c2}, {"d2", enumSquare::d2}, {"e2", enumSquare::e2}, {"f2", enumSquare::f2}, {"g2", enumSquare::g2}, {"h2", enumSquare::h2},
-        {"a1", enumSquare::a1}, {"b1", enumSquare::b1}, {"c1", enumSquare::c1}, {"d1", enumSquare::d1}, {"e1", enumSquare::e1}, {"f1", enumSquare::f1}, {"g1", enumSquare::g1}, {"h1", enumSquare::h1},
-    };
+    // Lower case FEN piece letter to its piece type, nWhite for any other character
+    constexpr std::array<enumPiece, 128> PIECE_CHAR_TO_ENUM = [] {
+        std::array<enumPiece, 128> pieces = {};
+        pieces['p'] = enumPiece::nPawn;
+        pieces['b'] = enumPiece::nBishop;
+        pieces['n'] = enumPiece::nKnight;
+        pieces['r'] = enumPiece::nRook;
+        pieces['q'] = enumPiece::nQueen;
+        pieces['k'] = enumPiece::nKing;
+        return pieces;
+    }();
 
-    const std::unordered_map<enumSquare, std::pair<int, int>> ENUM_TO_COORDS_MAP = {
-        {enumSquare::a8, {0, 0}}, {enumSquare::b8, {0, 1}}, {enumSquare::c8, {0, 2}}, {enumSquare::d8, {0, 3}}, {enumSquare::e8, {0, 4}}, {enumSquare::f8, {0, 5}}, {enumSquare::g8, {0, 6}}, {enumSquare::h8, {0, 7}},
-        {enumSquare::a7, {1, 0}}, {enumSquare::b7, {1, 1}}, {enumSquare::c7, {1, 2}}, {enumSquare::d7, {1, 3}}, {enumSquare::e7, {1, 4}}, {enumSquare::f7, {1, 5}}, {enumSquare::g7, {1, 6}}, {enumSquare::h7, {1, 7}},
-        {enumSquare::a6, {2, 0}}, {enumSquare::b6, {2, 1}}, {enumSquare::c6, {2, 2}}, {enumSquare::d6, {2, 3}}, {enumSquare::e6, {2, 4}}, {enumSquare::f6, {2, 5}}, {enumSquare::g6, {2, 6}}, {enumSquare::h6, {2, 7}},
-        {enumSquare::a5, {3, 0}}, {enumSquare::b5, {3, 1}}, {enumSquare::c5, {3, 2}}, {enumSquare::d5, {3, 3}}, {enumSquare::e5, {3, 4}}, {enumSquare::f5, {3, 5}}, {enumSquare::g5, {3, 6}}, {enumSquare::h5, {3, 7}},
-        {enumSquare::a4, {4, 0}}, {enumSquare::b4, {4, 1}}, {enumSquare::c4, {4, 2}}, {enumSquare::d4, {4, 3}}, {enumSquare::e4, {4, 4}}, {enumSquare::f4, {4, 5}}, {enumSquare::g4, {4, 6}}, {enumSquare::h4, {4, 7}},
-        {enumSquare::a3, {5, 0}}, {enumSquare::b3, {5, 1}}, {enumSquare::c3, {5, 2}}, {enumSquare::d3, {5, 3}}, {enumSquare::e3, {5, 4}}, {enumSquare::f3, {5, 5}}, {enumSquare::g3, {5, 6}}, {enumSquare::h3, {5, 7}},
-        {enumSquare::a2, {6, 0}}, {enumSquare::b2, {6, 1}}, {enumSquare::c2, {6, 2}}, {enumSquare::d2, {6, 3}}, {enumSquare::e2, {6, 4}}, {enumSquare::f2, {6, 5}}, {enumSquare::g2, {6, 6}}, {enumSquare::h2, {6, 7}},
-        {enumSquare::a1, {7, 0}}, {enumSquare::b1, {7, 1}}, {enumSquare::c1, {7, 2}}, {enumSquare::d1, {7, 3}}, {enumSquare::e1, {7, 4}}, {enumSquare::f1, {7, 5}}, {enumSquare::g1, {7, 6}}, {enumSquare::h1, {7, 7}},
-    };
+    // Square named in algebraic notation, e.g. "e4", no_sq if the name is not a square
+    constexpr enumSquare squareFromString(std::string_view name) {
+        if (name.size() != 2 or name[0] < 'a' or name[0] > 'h' or name[1] < '1' or name[1] > '8') return enumSquare::no_sq;
+
+        return static_cast<enumSquare>(('8' - name[1]) * 8 + (name[0] - 'a'));
+    }
+
+    // Rank and file indices of a square, counting from a8 as getSquareFromCoords does
+    constexpr std::pair<int, int> squareToCoords(enumSquare square) {
+        return { square / 8, square % 8 };
+    }
 
     // square & rankN == 1 means that square is in the corresponding rank
-    constexpr U64 RANK_1 = 0x00000000000000FFULL;
-    constexpr U64 RANK_4 = 0x00000000FF000000ULL;
-    constexpr U64 RANK_5 = 0x000000FF00000000ULL;
-    constexpr U64 RANK_8 = 0xFF00000000000000ULL;
+    // Squares are numbered from a8 (bit 0) to h1 (bit 63), so rank 8 is the lowest byte
+    constexpr U64 RANK_1 = 0xFF00000000000000ULL;
+    constexpr U64 RANK_2 = 0x00FF000000000000ULL;
+    constexpr U64 RANK_3 = 0x0000FF0000000000ULL;
+    constexpr U64 RANK_4 = 0x000000FF00000000ULL;
+    constexpr U64 RANK_5 = 0x00000000FF000000ULL;
+    constexpr U64 RANK_6 = 0x0000000000FF0000ULL;
+    constexpr U64 RANK_7 = 0x000000000000FF00ULL;
+    constexpr U64 RANK_8 = 0x00000000000000FFULL;
+
+    // square & fileN == 1 means that square is in the corresponding file
+    // Used as wrap masks when shifting bitboards east or west
+    constexpr U64 FILE_A = 0x0101010101010101ULL;
+    constexpr U64 FILE_H = 0x8080808080808080ULL;
+
+    // Rank and file steps of each sliding direction
+    constexpr std::array<std::pair<int, int>, 4> BISHOP_RAYS = { { { 1, 1 }, { 1, -1 }, { -1, -1 }, { -1, 1 } } };
+    constexpr std::array<std::pair<int, int>, 4> ROOK_RAYS = { { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } } };
 
-    constexpr U64 FILE_1 = 0x8080808080808080ULL;
-    constexpr U64 FILE_8 = 0x0101010101010101ULL;
+    // Search scores in centipawns
+    // Mate scores count down from MATE_SCORE by the number of plies to the mate
+    constexpr int MAX_PLY = 128;
+    constexpr int DRAW_SCORE = 0;
+    constexpr int MATE_SCORE = 32000;
+    constexpr int MATE_IN_MAX_PLY = MATE_SCORE - MAX_PLY;
+    constexpr int INFINITE_SCORE = 32001;
 
-    const std::vector<std::pair<int, int>> BISHOP_RAYS = { { { 1, 1 }, { 1, -1 }, { -1, -1 }, { -1, 1 } } };
-    const std::vector<std::pair<int, int>> ROOK_RAYS = { { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } } };
+    // Tablebase wins count down the same way, below any mate score
+    constexpr int TB_WIN_SCORE = MATE_IN_MAX_PLY - 1;
+    constexpr int TB_WIN_IN_MAX_PLY = TB_WIN_SCORE - MAX_PLY;
 }
 
 #endif
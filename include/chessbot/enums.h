@@ -17,6 +17,16 @@ enum enumColour {
     black
 };
 
+// Kinds of pseudo-legal moves to generate
+// Captures include en passant and every promotion, quiets are everything else
+// Evasions are the moves which may get the side to move out of check
+enum enumGenType {
+    genCaptures,
+    genQuiets,
+    genEvasions,
+    genAll
+};
+
 enum enumSquare {
     a8, b8, c8, d8, e8, f8, g8, h8,
     a7, b7, c7, d7, e7, f7, g7, h7,
@@ -0,0 +1,12 @@
+#ifndef EVALUATE_H
+#define EVALUATE_H
+
+#include "CBoard.h"
+
+// Static evaluation, weights are in eval_weights.h
+namespace Evaluation {
+    // Tapered material and piece-square score in centipawns, from the side to move's point of view
+    int evaluate(const CBoard &board);
+}
+
+#endif
@@ -0,0 +1,783 @@
+#ifndef KPK_BITBASE_H
+#define KPK_BITBASE_H
+
+#include <array>
+
+#include "types.h"
+
+// King and pawn against king, one bit per position in the order of Bitbase::index, set where the pawn wins
+// Generated by chessbot_engine bitbase, do not edit
+namespace KpkBitbase {
+    constexpr std::array<U64, 3072> BITS = {
+        0xfffffffffffff8f8ULL, 0xfffffffffffff8f8ULL, 0xfffffffffffff0f0ULL, 0xffffffffffffe0e0ULL,
+        0xffffffffffffc4c4ULL, 0xffffffffffff8c8cULL, 0xffffffffffff1c1cULL, 0xffffffffffff3c3cULL,
+        0x0000000000000000ULL, 0xfffffffffff8f8f8ULL, 0xfffffffffff1f0f0ULL, 0xffffffffffe3e0e0ULL,
+        0xffffffffffc7c4c4ULL, 0xffffffffff8f8c8cULL, 0xffffffffff1f1c1cULL, 0xffffffffff3f3c3cULL,
+        0xfffffffffcfcfcfcULL, 0xfffffffff8f8f8fcULL, 0xfffffffff1f1f0fcULL, 0xffffffffe3e3e0fcULL,
+        0xffffffffc7c7c4fcULL, 0xffffffff8f8f8cfcULL, 0xffffffff1f1f1cfcULL, 0xffffffff3f3f3cfcULL,
+        0xfffffffcfcfcfcfcULL, 0xfffffff8f8f8fcfcULL, 0xfffffff1f1f1fcfcULL, 0xffffffe3e3e3fcfcULL,
+        0xffffffc7c7c7fcfcULL, 0xffffff8f8f8ffcfcULL, 0xffffff1f1f1ffcfcULL, 0xffffff3f3f3ffcfcULL,
+        0xfffffcfcfcfffcfcULL, 0xfffff8f8f8fffcfcULL, 0xfffff1f1f1fffcfcULL, 0xffffe3e3e3fffcfcULL,
+        0xffffc7c7c7fffcfcULL, 0xffff8f8f8ffffcfcULL, 0xffff1f1f1ffffcfcULL, 0xffff3f3f3ffffcfcULL,
+        0xfffcfcfcfffffcfcULL, 0xfff8f8f8fffffcfcULL, 0xfff1f1f1fffffcfcULL, 0xffe3e3e3fffffcfcULL,
+        0xffc7c7c7fffffcfcULL, 0xff8f8f8ffffffcfcULL, 0xff1f1f1ffffffcfcULL, 0xff3f3f3ffffffcfcULL,
+        0xfcfcfcfffffffcfcULL, 0xf8f8f8fffffffcfcULL, 0xf1f1f1fffffffcfcULL, 0xe3e3e3fffffffcfcULL,
+        0xc7c7c7fffffffcfcULL, 0x8f8f8ffffffffcfcULL, 0x1f1f1ffffffffcfcULL, 0x3f3f3ffffffffcfcULL,
+        0xfcfcfffffffffcfcULL, 0xf8f8fffffffffcfcULL, 0xf1f1fffffffffcfcULL, 0xe3e3fffffffffcfcULL,
+        0xc7c7fffffffffcfcULL, 0x8f8ffffffffffcfcULL, 0x1f1ffffffffffcfcULL, 0x3f3ffffffffffcfcULL,
+        0xfffffffffffffcf8ULL, 0xfffffffffffff8f8ULL, 0xfffffffffffff1f0ULL, 0xffffffffffffe1e0ULL,
+        0xffffffffffffc0c0ULL, 0xffffffffffff8888ULL, 0xffffffffffff1818ULL, 0xffffffffffff3838ULL,
+        0xfffffffffffcfcf8ULL, 0x0000000000000000ULL, 0xfffffffffff1f1f0ULL, 0xffffffffffe3e1e2ULL,
+        0xffffffffffc7c0c0ULL, 0xffffffffff8f8888ULL, 0xffffffffff1f1818ULL, 0xffffffffff3f3838ULL,
+        0xfffffffffcfcfcf8ULL, 0xfffffffff8f8f8faULL, 0xfffffffff1f1f1f8ULL, 0xffffffffe3e3e1faULL,
+        0xffffffffc7c7c0f8ULL, 0xffffffff8f8f88f8ULL, 0xffffffff1f1f18f8ULL, 0xffffffff3f3f38f8ULL,
+        0xfffffffcfcfcf8faULL, 0xfffffff8f8f8f8faULL, 0xfffffff1f1f1f8faULL, 0xffffffe3e3e3f8faULL,
+        0xffffffc7c7c7f8f8ULL, 0xffffff8f8f8ff8f8ULL, 0xffffff1f1f1ff8f8ULL, 0xffffff3f3f3ff8f8ULL,
+        0xfffffcfcfcfff8f8ULL, 0xfffff8f8f8fff8f8ULL, 0xfffff1f1f1fff8f8ULL, 0xffffe3e3e3fff8f8ULL,
+        0xffffc7c7c7fff8f8ULL, 0xffff8f8f8ffff8f8ULL, 0xffff1f1f1ffff8f8ULL, 0xffff3f3f3ffff8f8ULL,
+        0xfffcfcfcfffff8f8ULL, 0xfff8f8f8fffff8f8ULL, 0xfff1f1f1fffff8f8ULL, 0xffe3e3e3fffff8f8ULL,
+        0xffc7c7c7fffff8f8ULL, 0xff8f8f8ffffff8f8ULL, 0xff1f1f1ffffff8f8ULL, 0xff3f3f3ffffff8f8ULL,
+        0xfcfcfcfffffff8f8ULL, 0xf8f8f8fffffff8f8ULL, 0xf1f1f1fffffff8f8ULL, 0xe3e3e3fffffff8f8ULL,
+        0xc7c7c7fffffff8f8ULL, 0x8f8f8ffffffff8f8ULL, 0x1f1f1ffffffff8f8ULL, 0x3f3f3ffffffff8f8ULL,
+        0xfcfcfffffffff8f8ULL, 0xf8f8fffffffff8f8ULL, 0xf1f1fffffffff8f8ULL, 0xe3e3fffffffff8f8ULL,
+        0xc7c7fffffffff8f8ULL, 0x8f8ffffffffff8f8ULL, 0x1f1ffffffffff8f8ULL, 0x3f3ffffffffff8f8ULL,
+        0xfffffffffffff8f0ULL, 0xfffffffffffff8f0ULL, 0xfffffffffffff1f1ULL, 0xffffffffffffe3e1ULL,
+        0xffffffffffffc3c1ULL, 0xffffffffffff8181ULL, 0xffffffffffff1111ULL, 0xffffffffffff3131ULL,
+        0xfffffffffffcf8f4ULL, 0xfffffffffff8f8f0ULL, 0x0000000000000000ULL, 0xffffffffffe3e3e1ULL,
+        0xffffffffffc7c3c5ULL, 0xffffffffff8f8181ULL, 0xffffffffff1f1111ULL, 0xffffffffff3f3131ULL,
+        0xfffffffffcfcf8f5ULL, 0xfffffffff8f8f8f1ULL, 0xfffffffff1f1f1f5ULL, 0xffffffffe3e3e3f1ULL,
+        0xffffffffc7c7c3f5ULL, 0xffffffff8f8f81f1ULL, 0xffffffff1f1f11f1ULL, 0xffffffff3f3f31f1ULL,
+        0xfffffffcfcfcf1f5ULL, 0xfffffff8f8f8f1f5ULL, 0xfffffff1f1f1f1f5ULL, 0xffffffe3e3e3f1f5ULL,
+        0xffffffc7c7c7f1f5ULL, 0xffffff8f8f8ff1f1ULL, 0xffffff1f1f1ff1f1ULL, 0xffffff3f3f3ff1f1ULL,
+        0xfffffcfcfcfff1f1ULL, 0xfffff8f8f8fff1f1ULL, 0xfffff1f1f1fff1f1ULL, 0xffffe3e3e3fff1f1ULL,
+        0xffffc7c7c7fff1f1ULL, 0xffff8f8f8ffff1f1ULL, 0xffff1f1f1ffff1f1ULL, 0xffff3f3f3ffff1f1ULL,
+        0xfffcfcfcfffff1f1ULL, 0xfff8f8f8fffff1f1ULL, 0xfff1f1f1fffff1f1ULL, 0xffe3e3e3fffff1f1ULL,
+        0xffc7c7c7fffff1f1ULL, 0xff8f8f8ffffff1f1ULL, 0xff1f1f1ffffff1f1ULL, 0xff3f3f3ffffff1f1ULL,
+        0xfcfcfcfffffff1f1ULL, 0xf8f8f8fffffff1f1ULL, 0xf1f1f1fffffff1f1ULL, 0xe3e3e3fffffff1f1ULL,
+        0xc7c7c7fffffff1f1ULL, 0x8f8f8ffffffff1f1ULL, 0x1f1f1ffffffff1f1ULL, 0x3f3f3ffffffff1f1ULL,
+        0xfcfcfffffffff1f1ULL, 0xf8f8fffffffff1f1ULL, 0xf1f1fffffffff1f1ULL, 0xe3e3fffffffff1f1ULL,
+        0xc7c7fffffffff1f1ULL, 0x8f8ffffffffff1f1ULL, 0x1f1ffffffffff1f1ULL, 0x3f3ffffffffff1f1ULL,
+        0xffffffffffffe0e0ULL, 0xfffffffffffff0e0ULL, 0xfffffffffffff1e1ULL, 0xffffffffffffe3e3ULL,
+        0xffffffffffffc7c3ULL, 0xffffffffffff8783ULL, 0xffffffffffff0303ULL, 0xffffffffffff2323ULL,
+        0xfffffffffffce0e0ULL, 0xfffffffffff8f0e8ULL, 0xfffffffffff1f1e1ULL, 0x0000000000000000ULL,
+        0xffffffffffc7c7c3ULL, 0xffffffffff8f878bULL, 0xffffffffff1f0303ULL, 0xffffffffff3f2323ULL,
+        0xfffffffffcfce0e3ULL, 0xfffffffff8f8f0ebULL, 0xfffffffff1f1f1e3ULL, 0xffffffffe3e3e3ebULL,
+        0xffffffffc7c7c7e3ULL, 0xffffffff8f8f87ebULL, 0xffffffff1f1f03e3ULL, 0xffffffff3f3f23e3ULL,
+        0xfffffffcfcfce3e3ULL, 0xfffffff8f8f8e3ebULL, 0xfffffff1f1f1e3ebULL, 0xffffffe3e3e3e3ebULL,
+        0xffffffc7c7c7e3ebULL, 0xffffff8f8f8fe3ebULL, 0xffffff1f1f1fe3e3ULL, 0xffffff3f3f3fe3e3ULL,
+        0xfffffcfcfcffe3e3ULL, 0xfffff8f8f8ffe3e3ULL, 0xfffff1f1f1ffe3e3ULL, 0xffffe3e3e3ffe3e3ULL,
+        0xffffc7c7c7ffe3e3ULL, 0xffff8f8f8fffe3e3ULL, 0xffff1f1f1fffe3e3ULL, 0xffff3f3f3fffe3e3ULL,
+        0xfffcfcfcffffe3e3ULL, 0xfff8f8f8ffffe3e3ULL, 0xfff1f1f1ffffe3e3ULL, 0xffe3e3e3ffffe3e3ULL,
+        0xffc7c7c7ffffe3e3ULL, 0xff8f8f8fffffe3e3ULL, 0xff1f1f1fffffe3e3ULL, 0xff3f3f3fffffe3e3ULL,
+        0xfcfcfcffffffe3e3ULL, 0xf8f8f8ffffffe3e3ULL, 0xf1f1f1ffffffe3e3ULL, 0xe3e3e3ffffffe3e3ULL,
+        0xc7c7c7ffffffe3e3ULL, 0x8f8f8fffffffe3e3ULL, 0x1f1f1fffffffe3e3ULL, 0x3f3f3fffffffe3e3ULL,
+        0xfcfcffffffffe3e3ULL, 0xf8f8ffffffffe3e3ULL, 0xf1f1ffffffffe3e3ULL, 0xe3e3ffffffffe3e3ULL,
+        0xc7c7ffffffffe3e3ULL, 0x8f8fffffffffe3e3ULL, 0x1f1fffffffffe3e3ULL, 0x3f3fffffffffe3e3ULL,
+        0xfffffffffffcf8f8ULL, 0xfffffffffffef8f8ULL, 0xfffffffffffcf0f0ULL, 0xfffffffffff8e0e0ULL,
+        0xfffffffffff8c0c0ULL, 0xfffffffffff88888ULL, 0xfffffffffff81818ULL, 0xfffffffffff83838ULL,
+        0xfffffffffffcf8f8ULL, 0xfffffffffff8f8f8ULL, 0xfffffffffff0f0f0ULL, 0xffffffffffe0e0e0ULL,
+        0xffffffffffc0c0c0ULL, 0xffffffffff888888ULL, 0xffffffffff181818ULL, 0xffffffffff383838ULL,
+        0x0000000000000000ULL, 0xfffffffff8f8f8fcULL, 0xfffffffff1f0f0fcULL, 0xffffffffe3e0e0f8ULL,
+        0xffffffffc7c0c0f8ULL, 0xffffffff8f8888f8ULL, 0xffffffff1f1818f8ULL, 0xffffffff3f3838f8ULL,
+        0xfffffffcfcf8f8f8ULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff1f1f0f8f8ULL, 0xffffffe3e3e0f8f8ULL,
+        0xffffffc7c7c0f8f8ULL, 0xffffff8f8f88f8f8ULL, 0xffffff1f1f18f8f8ULL, 0xffffff3f3f38f8f8ULL,
+        0xfffffcfcfcf8f8f8ULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff1f1f1f8f8f8ULL, 0xffffe3e3e3f8f8f8ULL,
+        0xffffc7c7c7f8f8f8ULL, 0xffff8f8f8ff8f8f8ULL, 0xffff1f1f1ff8f8f8ULL, 0xffff3f3f3ff8f8f8ULL,
+        0xfffcfcfcfff8f8f8ULL, 0xfff8f8f8fff8f8f8ULL, 0xfff1f1f1fff8f8f8ULL, 0xffe3e3e3fff8f8f8ULL,
+        0xffc7c7c7fff8f8f8ULL, 0xff8f8f8ffff8f8f8ULL, 0xff1f1f1ffff8f8f8ULL, 0xff3f3f3ffff8f8f8ULL,
+        0xfcfcfcfffff8f8f8ULL, 0xf8f8f8fffff8f8f8ULL, 0xf1f1f1fffff8f8f8ULL, 0xe3e3e3fffff8f8f8ULL,
+        0xc7c7c7fffff8f8f8ULL, 0x8f8f8ffffff8f8f8ULL, 0x1f1f1ffffff8f8f8ULL, 0x3f3f3ffffff8f8f8ULL,
+        0xfcfcfffffff8f8f8ULL, 0xf8f8fffffff8f8f8ULL, 0xf1f1fffffff8f8f8ULL, 0xe3e3fffffff8f8f8ULL,
+        0xc7c7fffffff8f8f8ULL, 0x8f8ffffffff8f8f8ULL, 0x1f1ffffffff8f8f8ULL, 0x3f3ffffffff8f8f8ULL,
+        0xfffffffffffdf8fcULL, 0xfffffffffffdf8f8ULL, 0xfffffffffffdf0f1ULL, 0xfffffffffff9e0e0ULL,
+        0xfffffffffff0c0c0ULL, 0xfffffffffff08080ULL, 0xfffffffffff01010ULL, 0xfffffffffff03030ULL,
+        0xfffffffffffcf8fcULL, 0xfffffffffff8f8f8ULL, 0xfffffffffff1f0f1ULL, 0xffffffffffe1e0e1ULL,
+        0xffffffffffc0c0c0ULL, 0xffffffffff808080ULL, 0xffffffffff101010ULL, 0xffffffffff303030ULL,
+        0xfffffffffcfcf8feULL, 0x0000000000000000ULL, 0xfffffffff1f1f0faULL, 0xffffffffe3e1e0fdULL,
+        0xffffffffc7c0c0f8ULL, 0xffffffff8f8080f0ULL, 0xffffffff1f1010f0ULL, 0xffffffff3f3030f0ULL,
+        0xfffffffcfcfcf8fdULL, 0xfffffff8f8f8f8fdULL, 0xfffffff1f1f1f8fdULL, 0xffffffe3e3e1f8fdULL,
+        0xffffffc7c7c0f8f8ULL, 0xffffff8f8f80f0f0ULL, 0xffffff1f1f10f0f0ULL, 0xffffff3f3f30f0f0ULL,
+        0xfffffcfcfcf8f8f8ULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff1f1f1f8f8f8ULL, 0xffffe3e3e3f0f8f8ULL,
+        0xffffc7c7c7f0f8f8ULL, 0xffff8f8f8ff0f0f0ULL, 0xffff1f1f1ff0f0f0ULL, 0xffff3f3f3ff0f0f0ULL,
+        0xfffcfcfcfff0f0f0ULL, 0xfff8f8f8fff0f0f0ULL, 0xfff1f1f1fff0f0f0ULL, 0xffe3e3e3fff0f0f0ULL,
+        0xffc7c7c7fff0f0f0ULL, 0xff8f8f8ffff0f0f0ULL, 0xff1f1f1ffff0f0f0ULL, 0xff3f3f3ffff0f0f0ULL,
+        0xfcfcfcfffff0f0f0ULL, 0xf8f8f8fffff0f0f0ULL, 0xf1f1f1fffff0f0f0ULL, 0xe3e3e3fffff0f0f0ULL,
+        0xc7c7c7fffff0f0f0ULL, 0x8f8f8ffffff0f0f0ULL, 0x1f1f1ffffff0f0f0ULL, 0x3f3f3ffffff0f0f0ULL,
+        0xfcfcfffffff0f0f0ULL, 0xf8f8fffffff0f0f0ULL, 0xf1f1fffffff0f0f0ULL, 0xe3e3fffffff0f0f0ULL,
+        0xc7c7fffffff0f0f0ULL, 0x8f8ffffffff0f0f0ULL, 0x1f1ffffffff0f0f0ULL, 0x3f3ffffffff0f0f0ULL,
+        0xfffffffffff9f0f8ULL, 0xfffffffffffbf0f8ULL, 0xfffffffffffbf1f1ULL, 0xfffffffffffbe1e3ULL,
+        0xfffffffffff3c1c3ULL, 0xffffffffffe18181ULL, 0xffffffffffe00000ULL, 0xffffffffffe02020ULL,
+        0xfffffffffff8f0f8ULL, 0xfffffffffff8f0f8ULL, 0xfffffffffff1f1f1ULL, 0xffffffffffe3e1e3ULL,
+        0xffffffffffc3c1c3ULL, 0xffffffffff818181ULL, 0xffffffffff000000ULL, 0xffffffffff202020ULL,
+        0xfffffffffcf8f0fbULL, 0xfffffffff8f8f0fdULL, 0x0000000000000000ULL, 0xffffffffe3e3e1f7ULL,
+        0xffffffffc7c3c1fbULL, 0xffffffff8f8181f1ULL, 0xffffffff1f0000e0ULL, 0xffffffff3f2020e0ULL,
+        0xfffffffcfcf8f1fbULL, 0xfffffff8f8f8f1fbULL, 0xfffffff1f1f1f1fbULL, 0xffffffe3e3e3f1fbULL,
+        0xffffffc7c7c3f1fbULL, 0xffffff8f8f81f1f1ULL, 0xffffff1f1f00e0e0ULL, 0xffffff3f3f20e0e0ULL,
+        0xfffffcfcfcf0f1f1ULL, 0xfffff8f8f8f1f1f1ULL, 0xfffff1f1f1f1f1f1ULL, 0xffffe3e3e3f1f1f1ULL,
+        0xffffc7c7c7e1f1f1ULL, 0xffff8f8f8fe1f1f1ULL, 0xffff1f1f1fe0e0e0ULL, 0xffff3f3f3fe0e0e0ULL,
+        0xfffcfcfcffe0e0e0ULL, 0xfff8f8f8ffe0e0e0ULL, 0xfff1f1f1ffe0e0e0ULL, 0xffe3e3e3ffe0e0e0ULL,
+        0xffc7c7c7ffe0e0e0ULL, 0xff8f8f8fffe0e0e0ULL, 0xff1f1f1fffe0e0e0ULL, 0xff3f3f3fffe0e0e0ULL,
+        0xfcfcfcffffe0e0e0ULL, 0xf8f8f8ffffe0e0e0ULL, 0xf1f1f1ffffe0e0e0ULL, 0xe3e3e3ffffe0e0e0ULL,
+        0xc7c7c7ffffe0e0e0ULL, 0x8f8f8fffffe0e0e0ULL, 0x1f1f1fffffe0e0e0ULL, 0x3f3f3fffffe0e0e0ULL,
+        0xfcfcffffffe0e0e0ULL, 0xf8f8ffffffe0e0e0ULL, 0xf1f1ffffffe0e0e0ULL, 0xe3e3ffffffe0e0e0ULL,
+        0xc7c7ffffffe0e0e0ULL, 0x8f8fffffffe0e0e0ULL, 0x1f1fffffffe0e0e0ULL, 0x3f3fffffffe0e0e0ULL,
+        0xffffffffffe1e0e0ULL, 0xfffffffffff3e0f0ULL, 0xfffffffffff7e1f1ULL, 0xfffffffffff7e3e3ULL,
+        0xfffffffffff7c3c7ULL, 0xffffffffffe78387ULL, 0xffffffffffc30303ULL, 0xffffffffffc10101ULL,
+        0xffffffffffe0e0e0ULL, 0xfffffffffff0e0f0ULL, 0xfffffffffff1e1f1ULL, 0xffffffffffe3e3e3ULL,
+        0xffffffffffc7c3c7ULL, 0xffffffffff878387ULL, 0xffffffffff030303ULL, 0xffffffffff010101ULL,
+        0xfffffffffce0e0e3ULL, 0xfffffffff8f0e0f7ULL, 0xfffffffff1f1e1fbULL, 0x0000000000000000ULL,
+        0xffffffffc7c7c3efULL, 0xffffffff8f8783f7ULL, 0xffffffff1f0303e3ULL, 0xffffffff3f0101c1ULL,
+        0xfffffffcfce0e3e3ULL, 0xfffffff8f8f0e3f7ULL, 0xfffffff1f1f1e3f7ULL, 0xffffffe3e3e3e3f7ULL,
+        0xffffffc7c7c7e3f7ULL, 0xffffff8f8f87e3f7ULL, 0xffffff1f1f03e3e3ULL, 0xffffff3f3f01c1c1ULL,
+        0xfffffcfcfce1e3e3ULL, 0xfffff8f8f8e1e3e3ULL, 0xfffff1f1f1e3e3e3ULL, 0xffffe3e3e3e3e3e3ULL,
+        0xffffc7c7c7e3e3e3ULL, 0xffff8f8f8fc3e3e3ULL, 0xffff1f1f1fc3e3e3ULL, 0xffff3f3f3fc1c1c1ULL,
+        0xfffcfcfcffc1c1c1ULL, 0xfff8f8f8ffc1c1c1ULL, 0xfff1f1f1ffc1c1c1ULL, 0xffe3e3e3ffc1c1c1ULL,
+        0xffc7c7c7ffc1c1c1ULL, 0xff8f8f8fffc1c1c1ULL, 0xff1f1f1fffc1c1c1ULL, 0xff3f3f3fffc1c1c1ULL,
+        0xfcfcfcffffc1c1c1ULL, 0xf8f8f8ffffc1c1c1ULL, 0xf1f1f1ffffc1c1c1ULL, 0xe3e3e3ffffc1c1c1ULL,
+        0xc7c7c7ffffc1c1c1ULL, 0x8f8f8fffffc1c1c1ULL, 0x1f1f1fffffc1c1c1ULL, 0x3f3f3fffffc1c1c1ULL,
+        0xfcfcffffffc1c1c1ULL, 0xf8f8ffffffc1c1c1ULL, 0xf1f1ffffffc1c1c1ULL, 0xe3e3ffffffc1c1c1ULL,
+        0xc7c7ffffffc1c1c1ULL, 0x8f8fffffffc1c1c1ULL, 0x1f1fffffffc1c1c1ULL, 0x3f3fffffffc1c1c1ULL,
+        0xfffffffffcf8f8f8ULL, 0xfffffffffcfcf8f8ULL, 0xfffffffffcf8f0f0ULL, 0xfffffffff8f0e0e0ULL,
+        0xfffffffff0f0c0c0ULL, 0xfffffffff0f08080ULL, 0xfffffffff0f01010ULL, 0xfffffffff0f03030ULL,
+        0xfffffffffef8f8f8ULL, 0xfffffffffef8f8f8ULL, 0xfffffffffcf0f0f0ULL, 0xfffffffff8e0e0e0ULL,
+        0xfffffffff0c0c0c0ULL, 0xfffffffff0808080ULL, 0xfffffffff0101010ULL, 0xfffffffff0303030ULL,
+        0xfffffffffcf8f8f8ULL, 0xfffffffff8f8f8f8ULL, 0xfffffffff0f0f0f8ULL, 0xffffffffe0e0e0f0ULL,
+        0xffffffffc0c0c0f0ULL, 0xffffffff808080f0ULL, 0xffffffff101010f0ULL, 0xffffffff303030f0ULL,
+        0x0000000000000000ULL, 0xfffffff8f8f8f0f0ULL, 0xfffffff1f0f0f0f0ULL, 0xffffffe3e0e0f0f0ULL,
+        0xffffffc7c0c0f0f0ULL, 0xffffff8f8080f0f0ULL, 0xffffff1f1010f0f0ULL, 0xffffff3f3030f0f0ULL,
+        0xfffffcfcf8f0f0f0ULL, 0xfffff8f8f8f0f0f0ULL, 0xfffff1f1f0f0f0f0ULL, 0xffffe3e3e0f0f0f0ULL,
+        0xffffc7c7c0f0f0f0ULL, 0xffff8f8f80f0f0f0ULL, 0xffff1f1f10f0f0f0ULL, 0xffff3f3f30f0f0f0ULL,
+        0xfffcfcfcf0f0f0f0ULL, 0xfff8f8f8f0f0f0f0ULL, 0xfff1f1f1f0f0f0f0ULL, 0xffe3e3e3f0f0f0f0ULL,
+        0xffc7c7c7f0f0f0f0ULL, 0xff8f8f8ff0f0f0f0ULL, 0xff1f1f1ff0f0f0f0ULL, 0xff3f3f3ff0f0f0f0ULL,
+        0xfcfcfcfff0f0f0f0ULL, 0xf8f8f8fff0f0f0f0ULL, 0xf1f1f1fff0f0f0f0ULL, 0xe3e3e3fff0f0f0f0ULL,
+        0xc7c7c7fff0f0f0f0ULL, 0x8f8f8ffff0f0f0f0ULL, 0x1f1f1ffff0f0f0f0ULL, 0x3f3f3ffff0f0f0f0ULL,
+        0xfcfcfffff0f0f0f0ULL, 0xf8f8fffff0f0f0f0ULL, 0xf1f1fffff0f0f0f0ULL, 0xe3e3fffff0f0f0f0ULL,
+        0xc7c7fffff0f0f0f0ULL, 0x8f8ffffff0f0f0f0ULL, 0x1f1ffffff0f0f0f0ULL, 0x3f3ffffff0f0f0f0ULL,
+        0xfffffffff8f8fcfcULL, 0xfffffffff8f8f8f8ULL, 0xfffffffff8f8f1f1ULL, 0xfffffffff8f0e1e1ULL,
+        0xfffffffff0e0c0c0ULL, 0xffffffffe0e08080ULL, 0xffffffffe0e00000ULL, 0xffffffffe0e02020ULL,
+        0xfffffffffdf8fcfcULL, 0xfffffffffdf8f8f8ULL, 0xfffffffffdf0f1f1ULL, 0xfffffffff9e0e1e3ULL,
+        0xfffffffff0c0c0c0ULL, 0xffffffffe0808080ULL, 0xffffffffe0000000ULL, 0xffffffffe0202020ULL,
+        0xfffffffffcf8fcffULL, 0xfffffffff8f8f8ffULL, 0xfffffffff1f0f1ffULL, 0xffffffffe1e0e1ffULL,
+        0xffffffffc0c0c0f8ULL, 0xffffffff808080f0ULL, 0xffffffff000000e0ULL, 0xffffffff202020e0ULL,
+        0xfffffffcfcf8fcffULL, 0x0000000000000000ULL, 0xfffffff1f1f0f9ffULL, 0xffffffe3e1e0f9ffULL,
+        0xffffffc7c0c0f0f8ULL, 0xffffff8f8080e0f0ULL, 0xffffff1f0000e0e0ULL, 0xffffff3f2020e0e0ULL,
+        0xfffffcfcfcf8f8f8ULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff1f1f1f0f0f0ULL, 0xffffe3e3e1f0f0f0ULL,
+        0xffffc7c7c0e0f0f0ULL, 0xffff8f8f80e0e0e0ULL, 0xffff1f1f00e0e0e0ULL, 0xffff3f3f20e0e0e0ULL,
+        0xfffcfcfcf8f0f0f0ULL, 0xfff8f8f8f8f0f0f0ULL, 0xfff1f1f1f8f0f0f0ULL, 0xffe3e3e3e0e0e0e0ULL,
+        0xffc7c7c7e0e0e0e0ULL, 0xff8f8f8fe0e0e0e0ULL, 0xff1f1f1fe0e0e0e0ULL, 0xff3f3f3fe0e0e0e0ULL,
+        0xfcfcfcffe0e0e0e0ULL, 0xf8f8f8ffe0e0e0e0ULL, 0xf1f1f1ffe0e0e0e0ULL, 0xe3e3e3ffe0e0e0e0ULL,
+        0xc7c7c7ffe0e0e0e0ULL, 0x8f8f8fffe0e0e0e0ULL, 0x1f1f1fffe0e0e0e0ULL, 0x3f3f3fffe0e0e0e0ULL,
+        0xfcfcffffe0e0e0e0ULL, 0xf8f8ffffe0e0e0e0ULL, 0xf1f1ffffe0e0e0e0ULL, 0xe3e3ffffe0e0e0e0ULL,
+        0xc7c7ffffe0e0e0e0ULL, 0x8f8fffffe0e0e0e0ULL, 0x1f1fffffe0e0e0e0ULL, 0x3f3fffffe0e0e0e0ULL,
+        0xfffffffff1f0f8f8ULL, 0xfffffffff1f1f8f8ULL, 0xfffffffff1f1f1f1ULL, 0xfffffffff1f1e3e3ULL,
+        0xfffffffff1e1c3c3ULL, 0xffffffffe1c18181ULL, 0xffffffffc0c00000ULL, 0xffffffffc0c00000ULL,
+        0xfffffffff9f0f8fcULL, 0xfffffffffbf0f8f8ULL, 0xfffffffffbf1f1f1ULL, 0xfffffffffbe1e3e3ULL,
+        0xfffffffff3c1c3c7ULL, 0xffffffffe1818181ULL, 0xffffffffc0000000ULL, 0xffffffffc0000000ULL,
+        0xfffffffff8f0f8ffULL, 0xfffffffff8f0f8ffULL, 0xfffffffff1f1f1ffULL, 0xffffffffe3e1e3ffULL,
+        0xffffffffc3c1c3ffULL, 0xffffffff818181f1ULL, 0xffffffff000000e0ULL, 0xffffffff000000c0ULL,
+        0xfffffffcf8f0f9ffULL, 0xfffffff8f8f0f9ffULL, 0x0000000000000000ULL, 0xffffffe3e3e1f3ffULL,
+        0xffffffc7c3c1f3ffULL, 0xffffff8f8181e1f1ULL, 0xffffff1f0000c0e0ULL, 0xffffff3f0000c0c0ULL,
+        0xfffffcfcf8f0f0f0ULL, 0xfffff8f8f8f0f0f0ULL, 0xfffff1f1f1f1f1f1ULL, 0xffffe3e3e3e1e1e1ULL,
+        0xffffc7c7c3e1e1e1ULL, 0xffff8f8f81c1e1e1ULL, 0xffff1f1f00c0c0c0ULL, 0xffff3f3f00c0c0c0ULL,
+        0xfffcfcfcf0e0e0e0ULL, 0xfff8f8f8f1e0e0e0ULL, 0xfff1f1f1f1e0e0e0ULL, 0xffe3e3e3f1e0e0e0ULL,
+        0xffc7c7c7c1c0c0c0ULL, 0xff8f8f8fc1c0c0c0ULL, 0xff1f1f1fc0c0c0c0ULL, 0xff3f3f3fc0c0c0c0ULL,
+        0xfcfcfcffc0c0c0c0ULL, 0xf8f8f8ffc0c0c0c0ULL, 0xf1f1f1ffc0c0c0c0ULL, 0xe3e3e3ffc0c0c0c0ULL,
+        0xc7c7c7ffc0c0c0c0ULL, 0x8f8f8fffc0c0c0c0ULL, 0x1f1f1fffc0c0c0c0ULL, 0x3f3f3fffc0c0c0c0ULL,
+        0xfcfcffffc0c0c0c0ULL, 0xf8f8ffffc0c0c0c0ULL, 0xf1f1ffffc0c0c0c0ULL, 0xe3e3ffffc0c0c0c0ULL,
+        0xc7c7ffffc0c0c0c0ULL, 0x8f8fffffc0c0c0c0ULL, 0x1f1fffffc0c0c0c0ULL, 0x3f3fffffc0c0c0c0ULL,
+        0xffffffffe1e0e0e0ULL, 0xffffffffe3e1f0f0ULL, 0xffffffffe3e3f1f1ULL, 0xffffffffe3e3e3e3ULL,
+        0xffffffffe3e3c7c7ULL, 0xffffffffe3c38787ULL, 0xffffffffc3830303ULL, 0xffffffff81810101ULL,
+        0xffffffffe1e0e0e0ULL, 0xfffffffff3e0f0f8ULL, 0xfffffffff7e1f1f1ULL, 0xfffffffff7e3e3e3ULL,
+        0xfffffffff7c3c7c7ULL, 0xffffffffe783878fULL, 0xffffffffc3030303ULL, 0xffffffff81010101ULL,
+        0xffffffffe0e0e0e3ULL, 0xfffffffff0e0f0ffULL, 0xfffffffff1e1f1ffULL, 0xffffffffe3e3e3ffULL,
+        0xffffffffc7c3c7ffULL, 0xffffffff878387ffULL, 0xffffffff030303e3ULL, 0xffffffff010101c1ULL,
+        0xfffffffce0e0e1e3ULL, 0xfffffff8f0e0f3ffULL, 0xfffffff1f1e1f3ffULL, 0x0000000000000000ULL,
+        0xffffffc7c7c3e7ffULL, 0xffffff8f8783e7ffULL, 0xffffff1f0303c3e3ULL, 0xffffff3f010181c1ULL,
+        0xfffffcfce0e0e1e1ULL, 0xfffff8f8f0e1e1e1ULL, 0xfffff1f1f1e1e1e1ULL, 0xffffe3e3e3e3e3e3ULL,
+        0xffffc7c7c7c3c3c3ULL, 0xffff8f8f87c3c3c3ULL, 0xffff1f1f0383c3c3ULL, 0xffff3f3f01818181ULL,
+        0xfffcfcfce0c0c0c0ULL, 0xfff8f8f8e0c0c0c0ULL, 0xfff1f1f1e3c1c1c1ULL, 0xffe3e3e3e3c1c1c1ULL,
+        0xffc7c7c7e3c1c1c1ULL, 0xff8f8f8f83818181ULL, 0xff1f1f1f83818181ULL, 0xff3f3f3f81818181ULL,
+        0xfcfcfcff80808080ULL, 0xf8f8f8ff80808080ULL, 0xf1f1f1ff80808080ULL, 0xe3e3e3ff80808080ULL,
+        0xc7c7c7ff80808080ULL, 0x8f8f8fff80808080ULL, 0x1f1f1fff80808080ULL, 0x3f3f3fff80808080ULL,
+        0xfcfcffff80808080ULL, 0xf8f8ffff80808080ULL, 0xf1f1ffff80808080ULL, 0xe3e3ffff80808080ULL,
+        0xc7c7ffff80808080ULL, 0x8f8fffff80808080ULL, 0x1f1fffff80808080ULL, 0x3f3fffff80808080ULL,
+        0xfffffff8f8f8f8f8ULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff8f8f8f0f0ULL, 0xfffffff0f0f0e0e0ULL,
+        0xffffffe0e0e0c0c0ULL, 0xffffffe0e0e08080ULL, 0xffffffe0e0e00000ULL, 0xffffffe0e0e02020ULL,
+        0xfffffffcf8f8f8f8ULL, 0xfffffffcfcf8f8f8ULL, 0xfffffffcf8f0f0f0ULL, 0xfffffff8f0e0e0e0ULL,
+        0xfffffff0e0c0c0c0ULL, 0xffffffe0e0808080ULL, 0xffffffe0e0000000ULL, 0xffffffe0e0202020ULL,
+        0xfffffffef8f8f8f8ULL, 0xfffffffef8f8f8f8ULL, 0xfffffffcf0f0f0f8ULL, 0xfffffff8e0e0e0f0ULL,
+        0xfffffff0c0c0c0e0ULL, 0xffffffe0808080e0ULL, 0xffffffe0000000e0ULL, 0xffffffe0202020e0ULL,
+        0xfffffffcf8f8f0f0ULL, 0xfffffff8f8f8f0f0ULL, 0xfffffff0f0f0f0f0ULL, 0xffffffe0e0e0f0f0ULL,
+        0xffffffc0c0c0e0e0ULL, 0xffffff808080e0e0ULL, 0xffffff000000e0e0ULL, 0xffffff202020e0e0ULL,
+        0x0000000000000000ULL, 0xfffff8f8f8e0e0e0ULL, 0xfffff1f0f0e0e0e0ULL, 0xffffe3e0e0e0e0e0ULL,
+        0xffffc7c0c0e0e0e0ULL, 0xffff8f8080e0e0e0ULL, 0xffff1f0000e0e0e0ULL, 0xffff3f2020e0e0e0ULL,
+        0xfffcfcf8e0e0e0e0ULL, 0xfff8f8f8e0e0e0e0ULL, 0xfff1f1f0e0e0e0e0ULL, 0xffe3e3e0e0e0e0e0ULL,
+        0xffc7c7c0e0e0e0e0ULL, 0xff8f8f80e0e0e0e0ULL, 0xff1f1f00e0e0e0e0ULL, 0xff3f3f20e0e0e0e0ULL,
+        0xfcfcfce0e0e0e0e0ULL, 0xf8f8f8e0e0e0e0e0ULL, 0xf1f1f1e0e0e0e0e0ULL, 0xe3e3e3e0e0e0e0e0ULL,
+        0xc7c7c7e0e0e0e0e0ULL, 0x8f8f8fe0e0e0e0e0ULL, 0x1f1f1fe0e0e0e0e0ULL, 0x3f3f3fe0e0e0e0e0ULL,
+        0xfcfcffe0e0e0e0e0ULL, 0xf8f8ffe0e0e0e0e0ULL, 0xf1f1ffe0e0e0e0e0ULL, 0xe3e3ffe0e0e0e0e0ULL,
+        0xc7c7ffe0e0e0e0e0ULL, 0x8f8fffe0e0e0e0e0ULL, 0x1f1fffe0e0e0e0e0ULL, 0x3f3fffe0e0e0e0e0ULL,
+        0xfffffff0f0f8fcfcULL, 0xfffffff0f0f8f8f8ULL, 0xfffffff0f0f8f1f1ULL, 0xfffffff0f0f0e1e1ULL,
+        0xffffffe0e0e0c0c0ULL, 0xffffffc0c0c08080ULL, 0xffffffc0c0c00000ULL, 0xffffffc0c0c00000ULL,
+        0xfffffff8f8fcfcfcULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff8f8f1f1f1ULL, 0xfffffff8f0e1e1e3ULL,
+        0xfffffff0e0c0c0c0ULL, 0xffffffe0c0808080ULL, 0xffffffc0c0000000ULL, 0xffffffc0c0000000ULL,
+        0xfffffffdf8fcfcffULL, 0xfffffffdf8f8f8ffULL, 0xfffffffdf0f1f1ffULL, 0xfffffff9e0e1e1ffULL,
+        0xfffffff0c0c0c0f8ULL, 0xffffffe0808080f0ULL, 0xffffffc0000000e0ULL, 0xffffffc0000000c0ULL,
+        0xfffffffcf8fcfeffULL, 0xfffffff8f8f8fdffULL, 0xfffffff1f0f1fbffULL, 0xffffffe1e0e1f5ffULL,
+        0xffffffc0c0c0e8f8ULL, 0xffffff808080d0f0ULL, 0xffffff000000e0e0ULL, 0xffffff000000c0c0ULL,
+        0xfffffcfcf8fcfffcULL, 0x0000000000000000ULL, 0xfffff1f1f0f9fff9ULL, 0xffffe3e1e0f1fdf1ULL,
+        0xffffc7c0c0e0f8e0ULL, 0xffff8f8080c0f0c0ULL, 0xffff1f0000c0e0c0ULL, 0xffff3f0000c0c0c0ULL,
+        0xfffcfcfcf8f8f8f8ULL, 0xfff8f8f8f8f8f8f8ULL, 0xfff1f1f1f0f0f0f0ULL, 0xffe3e3e1f0f0f0f0ULL,
+        0xffc7c7c0e0e0e0e0ULL, 0xff8f8f80c0c0c0c0ULL, 0xff1f1f00c0c0c0c0ULL, 0xff3f3f00c0c0c0c0ULL,
+        0xfcfcfcf8f0f0f0f0ULL, 0xf8f8f8f8f0f0f0f0ULL, 0xf1f1f1f8f0f0f0f0ULL, 0xe3e3e3e0e0e0e0e0ULL,
+        0xc7c7c7e0e0e0e0e0ULL, 0x8f8f8fc0c0c0c0c0ULL, 0x1f1f1fc0c0c0c0c0ULL, 0x3f3f3fc0c0c0c0c0ULL,
+        0xfcfcffe0e0e0e0e0ULL, 0xf8f8ffe0e0e0e0e0ULL, 0xf1f1ffe0e0e0e0e0ULL, 0xe3e3ffe0e0e0e0e0ULL,
+        0xc7c7ffc0c0c0c0c0ULL, 0x8f8fffc0c0c0c0c0ULL, 0x1f1fffc0c0c0c0c0ULL, 0x3f3fffc0c0c0c0c0ULL,
+        0xffffffe0e0f0f8f8ULL, 0xffffffe0e0f1f8f8ULL, 0xffffffe0e0f1f1f1ULL, 0xffffffe0e0f1e3e3ULL,
+        0xffffffe0e0e1c3c3ULL, 0xffffffc0c0c18181ULL, 0xffffff8080800000ULL, 0xffffff8080800000ULL,
+        0xfffffff1f0f8f8fcULL, 0xfffffff1f1f8f8f8ULL, 0xfffffff1f1f1f1f1ULL, 0xfffffff1f1e3e3e3ULL,
+        0xfffffff1e1c3c3c7ULL, 0xffffffe1c1818181ULL, 0xffffffc080000000ULL, 0xffffff8080000000ULL,
+        0xfffffff9f0f8f8ffULL, 0xfffffffbf0f8f8ffULL, 0xfffffffbf1f1f1ffULL, 0xfffffffbe1e3e3ffULL,
+        0xfffffff3c1c3c3ffULL, 0xffffffe1818181f1ULL, 0xffffffc0000000e0ULL, 0xffffff80000000c0ULL,
+        0xfffffff8f0f8faffULL, 0xfffffff8f0f8fdffULL, 0xfffffff1f1f1fbffULL, 0xffffffe3e1e3f7ffULL,
+        0xffffffc3c1c3ebffULL, 0xffffff818181d1f1ULL, 0xffffff000000a0e0ULL, 0xffffff000000c0c0ULL,
+        0xfffffcf8f0f8fbf8ULL, 0xfffff8f8f0f9fff9ULL, 0x0000000000000000ULL, 0xffffe3e3e1f3fff3ULL,
+        0xffffc7c3c1e3fbe3ULL, 0xffff8f8181c1f1c1ULL, 0xffff1f000080e080ULL, 0xffff3f000080c080ULL,
+        0xfffcfcf8f0f0f0f0ULL, 0xfff8f8f8f0f0f0f0ULL, 0xfff1f1f1f1f1f1f1ULL, 0xffe3e3e3e1e1e1e1ULL,
+        0xffc7c7c3e1e1e1e1ULL, 0xff8f8f81c1c1c1c1ULL, 0xff1f1f0080808080ULL, 0xff3f3f0080808080ULL,
+        0xfcfcfcf0e0e0e0e0ULL, 0xf8f8f8f1e0e0e0e0ULL, 0xf1f1f1f1e0e0e0e0ULL, 0xe3e3e3f1e0e0e0e0ULL,
+        0xc7c7c7c1c0c0c0c0ULL, 0x8f8f8fc1c0c0c0c0ULL, 0x1f1f1f8080808080ULL, 0x3f3f3f8080808080ULL,
+        0xfcfcffc0c0c0c0c0ULL, 0xf8f8ffc0c0c0c0c0ULL, 0xf1f1ffc0c0c0c0c0ULL, 0xe3e3ffc0c0c0c0c0ULL,
+        0xc7c7ffc0c0c0c0c0ULL, 0x8f8fff8080808080ULL, 0x1f1fff8080808080ULL, 0x3f3fff8080808080ULL,
+        0xffffffc0c0e0e0e0ULL, 0xffffffc1c1e1f0f0ULL, 0xffffffc1c1e3f1f1ULL, 0xffffffc1c1e3e3e3ULL,
+        0xffffffc1c1e3c7c7ULL, 0xffffffc1c1c38787ULL, 0xffffff8181830303ULL, 0xffffff0101010101ULL,
+        0xffffffe1e0e0e0e0ULL, 0xffffffe3e1f0f0f8ULL, 0xffffffe3e3f1f1f1ULL, 0xffffffe3e3e3e3e3ULL,
+        0xffffffe3e3c7c7c7ULL, 0xffffffe3c387878fULL, 0xffffffc383030303ULL, 0xffffff8101010101ULL,
+        0xffffffe1e0e0e0e3ULL, 0xfffffff3e0f0f0ffULL, 0xfffffff7e1f1f1ffULL, 0xfffffff7e3e3e3ffULL,
+        0xfffffff7c3c7c7ffULL, 0xffffffe7838787ffULL, 0xffffffc3030303e3ULL, 0xffffff81010101c1ULL,
+        0xffffffe0e0e0e2e3ULL, 0xfffffff0e0f0f5ffULL, 0xfffffff1e1f1fbffULL, 0xffffffe3e3e3f7ffULL,
+        0xffffffc7c3c7efffULL, 0xffffff878387d7ffULL, 0xffffff030303a3e3ULL, 0xffffff01010141c1ULL,
+        0xfffffce0e0e0e3e0ULL, 0xfffff8f0e0f1f7f1ULL, 0xfffff1f1e1f3fff3ULL, 0x0000000000000000ULL,
+        0xffffc7c7c3e7ffe7ULL, 0xffff8f8783c7f7c7ULL, 0xffff1f030383e383ULL, 0xffff3f010101c101ULL,
+        0xfffcfce0e0e0e0e0ULL, 0xfff8f8f0e1e1e1e1ULL, 0xfff1f1f1e1e1e1e1ULL, 0xffe3e3e3e3e3e3e3ULL,
+        0xffc7c7c7c3c3c3c3ULL, 0xff8f8f87c3c3c3c3ULL, 0xff1f1f0383838383ULL, 0xff3f3f0101010101ULL,
+        0xfcfcfce0c0c0c0c0ULL, 0xf8f8f8e0c0c0c0c0ULL, 0xf1f1f1e3c1c1c1c1ULL, 0xe3e3e3e3c1c1c1c1ULL,
+        0xc7c7c7e3c1c1c1c1ULL, 0x8f8f8f8381818181ULL, 0x1f1f1f8381818181ULL, 0x3f3f3f0101010101ULL,
+        0xfcfcff8080808080ULL, 0xf8f8ff8080808080ULL, 0xf1f1ff8080808080ULL, 0xe3e3ff8080808080ULL,
+        0xc7c7ff8080808080ULL, 0x8f8fff8080808080ULL, 0x1f1fff0000000000ULL, 0x3f3fff0000000000ULL,
+        0xfffff0f0f0f0f8f8ULL, 0xfffff0f0f0f0f8f8ULL, 0xfffff0f0f0f0f0f0ULL, 0xfffff0f0f0f0e0e0ULL,
+        0xffffe0e0e0e0c0c0ULL, 0xffffc0c0c0c08080ULL, 0xffffc0c0c0c00000ULL, 0xffffc0c0c0c00000ULL,
+        0xfffff8f8f8f8f8f8ULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff8f8f8f0f0f0ULL, 0xfffff0f0f0e0e0e0ULL,
+        0xffffe0e0e0c0c0c0ULL, 0xffffc0c0c0808080ULL, 0xffffc0c0c0000000ULL, 0xffffc0c0c0000000ULL,
+        0xfffffcf8f8f8f8f8ULL, 0xfffffcfcf8f8f8f8ULL, 0xfffffcf8f0f0f0f8ULL, 0xfffff8f0e0e0e0f0ULL,
+        0xfffff0e0c0c0c0e0ULL, 0xffffe0c0808080c0ULL, 0xffffc0c0000000c0ULL, 0xffffc0c0000000c0ULL,
+        0xfffffef8f8f8f0f0ULL, 0xfffffef8f8f8f0f0ULL, 0xfffffcf0f0f0f0f0ULL, 0xfffff8e0e0e0f0f0ULL,
+        0xfffff0c0c0c0e0e0ULL, 0xffffe0808080c0c0ULL, 0xffffc0000000c0c0ULL, 0xffffc0000000c0c0ULL,
+        0xfffffcf8f8e0e0e0ULL, 0xfffff8f8f8e0e0e0ULL, 0xfffff0f0f0e0e0e0ULL, 0xffffe0e0e0e0e0e0ULL,
+        0xffffc0c0c0e0e0e0ULL, 0xffff808080c0c0c0ULL, 0xffff000000c0c0c0ULL, 0xffff000000c0c0c0ULL,
+        0x0000000000000000ULL, 0xfff8f8f8c0c0c0c0ULL, 0xfff1f0f0c0c0c0c0ULL, 0xffe3e0e0c0c0c0c0ULL,
+        0xffc7c0c0c0c0c0c0ULL, 0xff8f8080c0c0c0c0ULL, 0xff1f0000c0c0c0c0ULL, 0xff3f0000c0c0c0c0ULL,
+        0xfcfcf8c0c0c0c0c0ULL, 0xf8f8f8c0c0c0c0c0ULL, 0xf1f1f0c0c0c0c0c0ULL, 0xe3e3e0c0c0c0c0c0ULL,
+        0xc7c7c0c0c0c0c0c0ULL, 0x8f8f80c0c0c0c0c0ULL, 0x1f1f00c0c0c0c0c0ULL, 0x3f3f00c0c0c0c0c0ULL,
+        0xfcfcc0c0c0c0c0c0ULL, 0xf8f8c0c0c0c0c0c0ULL, 0xf1f1c0c0c0c0c0c0ULL, 0xe3e3c0c0c0c0c0c0ULL,
+        0xc7c7c0c0c0c0c0c0ULL, 0x8f8fc0c0c0c0c0c0ULL, 0x1f1fc0c0c0c0c0c0ULL, 0x3f3fc0c0c0c0c0c0ULL,
+        0xffffe0e0e0f0fcfcULL, 0xffffe0e0e0f0f8f8ULL, 0xffffe0e0e0f0f1f1ULL, 0xffffe0e0e0f0e1e1ULL,
+        0xffffe0e0e0e0c0c0ULL, 0xffffc0c0c0c08080ULL, 0xffff808080800000ULL, 0xffff808080800000ULL,
+        0xfffff0f0f8fcfcfcULL, 0xfffff0f0f8f8f8f8ULL, 0xfffff0f0f8f1f1f1ULL, 0xfffff0f0f0e1e1e3ULL,
+        0xffffe0e0e0c0c0c7ULL, 0xffffc0c0c0808080ULL, 0xffff808080000000ULL, 0xffff808080000000ULL,
+        0xfffff8f8fcfcfcffULL, 0xfffff8f8f8f8f8ffULL, 0xfffff8f8f1f1f1ffULL, 0xfffff8f0e1e1e3ffULL,
+        0xfffff0e0c0c0c0ffULL, 0xffffe0c0808080f0ULL, 0xffffc080000000e0ULL, 0xffff8080000000c0ULL,
+        0xfffffdf8fcfcffffULL, 0xfffffdf8f8f8ffffULL, 0xfffffdf0f1f1ffffULL, 0xfffff9e0e1e1ffffULL,
+        0xfffff0c0c0c0f8ffULL, 0xffffe0808080f0f0ULL, 0xffffc0000000e0e0ULL, 0xffff80000000c0c0ULL,
+        0xfffffcf8fcfeffffULL, 0xfffff8f8f8fdffffULL, 0xfffff1f0f1fbffffULL, 0xffffe1e0e1f5ffffULL,
+        0xffffc0c0c0e8f8ffULL, 0xffff808080d0f0f0ULL, 0xffff000000a0e0e0ULL, 0xffff000000c0c0c0ULL,
+        0xfffcfcf8fcfffcffULL, 0x0000000000000000ULL, 0xfff1f1f0f9fff9ffULL, 0xffe3e1e0f1fdf1ffULL,
+        0xffc7c0c0e0f8e0ffULL, 0xff8f8080c0f0c0f0ULL, 0xff1f000080e080e0ULL, 0xff3f000080c080c0ULL,
+        0xfcfcfcf8f8f8f8f8ULL, 0xf8f8f8f8f8f8f8f8ULL, 0xf1f1f1f0f0f0f0f0ULL, 0xe3e3e1f0f0f0f0f0ULL,
+        0xc7c7c0e0e0e0e0e0ULL, 0x8f8f80c0c0c0c0c0ULL, 0x1f1f008080808080ULL, 0x3f3f008080808080ULL,
+        0xfcfcf8f0f0f0f0f0ULL, 0xf8f8f8f0f0f0f0f0ULL, 0xf1f1f8f0f0f0f0f0ULL, 0xe3e3e0e0e0e0e0e0ULL,
+        0xc7c7e0e0e0e0e0e0ULL, 0x8f8fc0c0c0c0c0c0ULL, 0x1f1f808080808080ULL, 0x3f3f808080808080ULL,
+        0xffffc0c0c0e0f8f8ULL, 0xffffc0c0c0e0f8f8ULL, 0xffffc0c0c0e0f1f1ULL, 0xffffc0c0c0e0e3e3ULL,
+        0xffffc0c0c0e0c3c3ULL, 0xffffc0c0c0c08181ULL, 0xffff808080800000ULL, 0xffff000000000000ULL,
+        0xffffe0e0f0f8f8fcULL, 0xffffe0e0f1f8f8f8ULL, 0xffffe0e0f1f1f1f1ULL, 0xffffe0e0f1e3e3e3ULL,
+        0xffffe0e0e1c3c3c7ULL, 0xffffc0c0c181818fULL, 0xffff808080000000ULL, 0xffff000000000000ULL,
+        0xfffff1f0f8f8fcffULL, 0xfffff1f1f8f8f8ffULL, 0xfffff1f1f1f1f1ffULL, 0xfffff1f1e3e3e3ffULL,
+        0xfffff1e1c3c3c7ffULL, 0xffffe1c1818181ffULL, 0xffffc080000000e0ULL, 0xffff8000000000c0ULL,
+        0xfffff9f0f8f8ffffULL, 0xfffffbf0f8f8ffffULL, 0xfffffbf1f1f1ffffULL, 0xfffffbe1e3e3ffffULL,
+        0xfffff3c1c3c3ffffULL, 0xffffe1818181f1ffULL, 0xffffc0000000e0e0ULL, 0xffff80000000c0c0ULL,
+        0xfffff8f0f8faffffULL, 0xfffff8f0f8fdffffULL, 0xfffff1f1f1fbffffULL, 0xffffe3e1e3f7ffffULL,
+        0xffffc3c1c3ebffffULL, 0xffff818181d1f1ffULL, 0xffff000000a0e0e0ULL, 0xffff00000040c0c0ULL,
+        0xfffcf8f0f8fbf8ffULL, 0xfff8f8f0f9fff9ffULL, 0x0000000000000000ULL, 0xffe3e3e1f3fff3ffULL,
+        0xffc7c3c1e3fbe3ffULL, 0xff8f8181c1f1c1ffULL, 0xff1f000080e080e0ULL, 0xff3f000000c000c0ULL,
+        0xfcfcf8f0f0f0f0f0ULL, 0xf8f8f8f0f0f0f0f0ULL, 0xf1f1f1f1f1f1f1f1ULL, 0xe3e3e3e1e1e1e1e1ULL,
+        0xc7c7c3e1e1e1e1e1ULL, 0x8f8f81c1c1c1c1c1ULL, 0x1f1f008080808080ULL, 0x3f3f000000000000ULL,
+        0xfcfcf0e0e0e0e0e0ULL, 0xf8f8f1e0e0e0e0e0ULL, 0xf1f1f1e0e0e0e0e0ULL, 0xe3e3f1e0e0e0e0e0ULL,
+        0xc7c7c1c0c0c0c0c0ULL, 0x8f8fc1c0c0c0c0c0ULL, 0x1f1f808080808080ULL, 0x3f3f000000000000ULL,
+        0xffff808080c0e0e0ULL, 0xffff808080c1f0f0ULL, 0xffff808080c1f1f1ULL, 0xffff808080c1e3e3ULL,
+        0xffff808080c1c7c7ULL, 0xffff808080c18787ULL, 0xffff808080810303ULL, 0xffff000000010101ULL,
+        0xffffc0c0e0e0e0fcULL, 0xffffc1c1e1f0f0f8ULL, 0xffffc1c1e3f1f1f1ULL, 0xffffc1c1e3e3e3e3ULL,
+        0xffffc1c1e3c7c7c7ULL, 0xffffc1c1c387878fULL, 0xffff81818303031fULL, 0xffff010101010101ULL,
+        0xffffe1e0e0e0e0ffULL, 0xffffe3e1f0f0f8ffULL, 0xffffe3e3f1f1f1ffULL, 0xffffe3e3e3e3e3ffULL,
+        0xffffe3e3c7c7c7ffULL, 0xffffe3c387878fffULL, 0xffffc383030303ffULL, 0xffff8101010101c1ULL,
+        0xffffe1e0e0e0e3ffULL, 0xfffff3e0f0f0ffffULL, 0xfffff7e1f1f1ffffULL, 0xfffff7e3e3e3ffffULL,
+        0xfffff7c3c7c7ffffULL, 0xffffe7838787ffffULL, 0xffffc3030303e3ffULL, 0xffff81010101c1c1ULL,
+        0xffffe0e0e0e2e3ffULL, 0xfffff0e0f0f5ffffULL, 0xfffff1e1f1fbffffULL, 0xffffe3e3e3f7ffffULL,
+        0xffffc7c3c7efffffULL, 0xffff878387d7ffffULL, 0xffff030303a3e3ffULL, 0xffff01010141c1c1ULL,
+        0xfffce0e0e0e3e0ffULL, 0xfff8f0e0f1f7f1ffULL, 0xfff1f1e1f3fff3ffULL, 0x0000000000000000ULL,
+        0xffc7c7c3e7ffe7ffULL, 0xff8f8783c7f7c7ffULL, 0xff1f030383e383ffULL, 0xff3f010101c101c1ULL,
+        0xfcfce0e0e0e0e0e0ULL, 0xf8f8f0e1e1e1e1e1ULL, 0xf1f1f1e1e1e1e1e1ULL, 0xe3e3e3e3e3e3e3e3ULL,
+        0xc7c7c7c3c3c3c3c3ULL, 0x8f8f87c3c3c3c3c3ULL, 0x1f1f038383838383ULL, 0x3f3f010101010101ULL,
+        0xfcfce0c0c0c0c0c0ULL, 0xf8f8e0c0c0c0c0c0ULL, 0xf1f1e3c1c1c1c1c1ULL, 0xe3e3e3c1c1c1c1c1ULL,
+        0xc7c7e3c1c1c1c1c1ULL, 0x8f8f838181818181ULL, 0x1f1f838181818181ULL, 0x3f3f010101010101ULL,
+        0xfffef0f0f0f0f8f8ULL, 0xfffef0f0f0f0f8f8ULL, 0xfffef0f0f0f0f0f0ULL, 0xfffef0f0f0f0e0e0ULL,
+        0xfffee0e0e0e0c0c0ULL, 0xfffec0c0c0c08080ULL, 0xfffec0c0c0c00000ULL, 0xfffec0c0c0c00000ULL,
+        0xfffef8f8f8f8f8f8ULL, 0xfffef8f8f8f8f8f8ULL, 0xfffef8f8f8f0f0f0ULL, 0xfffef0f0f0e0e0e0ULL,
+        0xfffee0e0e0c0c0c0ULL, 0xfffec0c0c0808080ULL, 0xfffec0c0c0000000ULL, 0xfffec0c0c0000000ULL,
+        0xfffefcf8f8f8f8f8ULL, 0xfffefcfcf8f8f8f8ULL, 0xfffefcf8f0f0f0f8ULL, 0xfffefcf0e0e0e0f0ULL,
+        0xfffef8e0c0c0c0e0ULL, 0xfffef0c0808080c0ULL, 0xfffee0c0000000c0ULL, 0xfffec0c0000000c0ULL,
+        0xfffefcf8f8f8f0f0ULL, 0xfffefcf8f8f8f0f0ULL, 0xfffefcf0f0f0f0f0ULL, 0xfffefce0e0e0f0f0ULL,
+        0xfffef8c0c0c0e0e0ULL, 0xfffef0808080c0c0ULL, 0xfffee0000000c0c0ULL, 0xfffec0000000c0c0ULL,
+        0xfffefcf8f8e0e0e0ULL, 0xfffef8f8f8e0e0e0ULL, 0xfffef0f0f0e0e0e0ULL, 0xfffee0e0e0e0e0e0ULL,
+        0xfffec0c0c0e0e0e0ULL, 0xfffe808080c0c0c0ULL, 0xfffe000000c0c0c0ULL, 0xfffe000000c0c0c0ULL,
+        0xfffcf8f8c0c0c0c0ULL, 0xfff8f8f8c0c0c0c0ULL, 0xfff0f0f0c0c0c0c0ULL, 0xffe2e0e0c0c0c0c0ULL,
+        0xffc6c0c0c0c0c0c0ULL, 0xff8e8080c0c0c0c0ULL, 0xff1e0000c0c0c0c0ULL, 0xff3e0000c0c0c0c0ULL,
+        0x0000000000000000ULL, 0xf8f8f8c0c0c0c0c0ULL, 0xf1f0f0c0c0c0c0c0ULL, 0xe3e2e0c0c0c0c0c0ULL,
+        0xc7c6c0c0c0c0c0c0ULL, 0x8f8e80c0c0c0c0c0ULL, 0x1f1e00c0c0c0c0c0ULL, 0x3f3e00c0c0c0c0c0ULL,
+        0xfcfcc0c0c0c0c0c0ULL, 0xf8f8c0c0c0c0c0c0ULL, 0xf1f0c0c0c0c0c0c0ULL, 0xe3e2c0c0c0c0c0c0ULL,
+        0xc7c6c0c0c0c0c0c0ULL, 0x8f8ec0c0c0c0c0c0ULL, 0x1f1ec0c0c0c0c0c0ULL, 0x3f3ec0c0c0c0c0c0ULL,
+        0xfffde0e0e0e0fcfcULL, 0xfffde0e0e0e0f8f8ULL, 0xfffde0e0e0e0f1f1ULL, 0xfffde0e0e0e0e1e1ULL,
+        0xfffde0e0e0e0c0c0ULL, 0xfffdc0c0c0c08080ULL, 0xfffd808080800000ULL, 0xfffd808080800000ULL,
+        0xfffdf0f0f0fcfcfcULL, 0xfffdf0f0f0f8f8f8ULL, 0xfffdf0f0f0f1f1f1ULL, 0xfffdf0f0f0e1e1e3ULL,
+        0xfffde0e0e0c0c0c7ULL, 0xfffdc0c0c080808fULL, 0xfffd808080000000ULL, 0xfffd808080000000ULL,
+        0xfffdf8f8fcfcfcffULL, 0xfffdf8f8f8f8f8ffULL, 0xfffdf8f8f1f1f1ffULL, 0xfffdf8f0e1e1e3ffULL,
+        0xfffdf8e0c0c0c7ffULL, 0xfffdf0c0808080ffULL, 0xfffde080000000e0ULL, 0xfffdc080000000c0ULL,
+        0xfffdf8fcfcfcffffULL, 0xfffdf8f8f8f8ffffULL, 0xfffdf8f1f1f1ffffULL, 0xfffdf8e1e1e3ffffULL,
+        0xfffdf8c0c0c0ffffULL, 0xfffdf0808080f0ffULL, 0xfffde0000000e0e0ULL, 0xfffdc0000000c0c0ULL,
+        0xfffdf8fcfcffffffULL, 0xfffdf8f8f8ffffffULL, 0xfffdf0f1f1ffffffULL, 0xfffde0e1e1ffffffULL,
+        0xfffdc0c0c0f8ffffULL, 0xfffd808080f0f0ffULL, 0xfffd000000e0e0e0ULL, 0xfffd000000c0c0c0ULL,
+        0xfffcf8fcfeffffffULL, 0xfff8f8f8fdffffffULL, 0xfff1f0f1fbffffffULL, 0xffe1e0e1f5ffffffULL,
+        0xffc5c0c0e8f8ffffULL, 0xff8d8080d0f0f0ffULL, 0xff1d0000a0e0e0e0ULL, 0xff3d0000c0c0c0c0ULL,
+        0xfcfcf8fcfffcffffULL, 0x0000000000000000ULL, 0xf1f1f0f9fff9ffffULL, 0xe3e1e0f1fdf1ffffULL,
+        0xc7c5c0e0f8e0ffffULL, 0x8f8d80c0f0c0f0ffULL, 0x1f1d0080e080e0e0ULL, 0x3f3d0080c080c0c0ULL,
+        0xfcfcf8f8f8f8f8ffULL, 0xf8f8f8f8f8f8f8ffULL, 0xf1f1f0f0f0f0f0ffULL, 0xe3e1f0f0f0f0f0ffULL,
+        0xc7c5e0e0e0e0e0ffULL, 0x8f8dc0c0c0c0c0ffULL, 0x1f1d8080808080e0ULL, 0x3f3d8080808080c0ULL,
+        0xfffbc0c0c0c0f8f8ULL, 0xfffbc0c0c0c0f8f8ULL, 0xfffbc0c0c0c0f1f1ULL, 0xfffbc0c0c0c0e3e3ULL,
+        0xfffbc0c0c0c0c3c3ULL, 0xfffbc0c0c0c08181ULL, 0xfffb808080800000ULL, 0xfffb000000000000ULL,
+        0xfffbe0e0e0f8f8fcULL, 0xfffbe0e0e0f8f8f8ULL, 0xfffbe0e0e0f1f1f1ULL, 0xfffbe0e0e0e3e3e3ULL,
+        0xfffbe0e0e0c3c3c7ULL, 0xfffbc0c0c081818fULL, 0xfffb80808000001fULL, 0xfffb000000000000ULL,
+        0xfffbf1f0f8f8fcffULL, 0xfffbf1f1f8f8f8ffULL, 0xfffbf1f1f1f1f1ffULL, 0xfffbf1f1e3e3e3ffULL,
+        0xfffbf1e1c3c3c7ffULL, 0xfffbf1c181818fffULL, 0xfffbe080000000ffULL, 0xfffbc000000000c0ULL,
+        0xfffbf1f8f8fcffffULL, 0xfffbf1f8f8f8ffffULL, 0xfffbf1f1f1f1ffffULL, 0xfffbf1e3e3e3ffffULL,
+        0xfffbf1c3c3c7ffffULL, 0xfffbf1818181ffffULL, 0xfffbe0000000e0ffULL, 0xfffbc0000000c0c0ULL,
+        0xfffbf0f8f8ffffffULL, 0xfffbf0f8f8ffffffULL, 0xfffbf1f1f1ffffffULL, 0xfffbe1e3e3ffffffULL,
+        0xfffbc1c3c3ffffffULL, 0xfffb818181f1ffffULL, 0xfffb000000e0e0ffULL, 0xfffb000000c0c0c0ULL,
+        0xfff8f0f8faffffffULL, 0xfff8f0f8fdffffffULL, 0xfff1f1f1fbffffffULL, 0xffe3e1e3f7ffffffULL,
+        0xffc3c1c3ebffffffULL, 0xff8b8181d1f1ffffULL, 0xff1b0000a0e0e0ffULL, 0xff3b000040c0c0c0ULL,
+        0xfcf8f0f8fbf8ffffULL, 0xf8f8f0f9fff9ffffULL, 0x0000000000000000ULL, 0xe3e3e1f3fff3ffffULL,
+        0xc7c3c1e3fbe3ffffULL, 0x8f8b81c1f1c1ffffULL, 0x1f1b0080e080e0ffULL, 0x3f3b0000c000c0c0ULL,
+        0xfcf8f0f0f0f0f0ffULL, 0xf8f8f0f0f0f0f0ffULL, 0xf1f1f1f1f1f1f1ffULL, 0xe3e3e1e1e1e1e1ffULL,
+        0xc7c3e1e1e1e1e1ffULL, 0x8f8bc1c1c1c1c1ffULL, 0x1f1b8080808080ffULL, 0x3f3b0000000000c0ULL,
+        0xfff780808080e0e0ULL, 0xfff780808080f0f0ULL, 0xfff780808080f1f1ULL, 0xfff780808080e3e3ULL,
+        0xfff780808080c7c7ULL, 0xfff7808080808787ULL, 0xfff7808080800303ULL, 0xfff7000000000101ULL,
+        0xfff7c0c0c0e0e0fcULL, 0xfff7c1c1c1f0f0f8ULL, 0xfff7c1c1c1f1f1f1ULL, 0xfff7c1c1c1e3e3e3ULL,
+        0xfff7c1c1c1c7c7c7ULL, 0xfff7c1c1c187878fULL, 0xfff781818103031fULL, 0xfff701010101013fULL,
+        0xfff7e3e0e0e0fcffULL, 0xfff7e3e1f0f0f8ffULL, 0xfff7e3e3f1f1f1ffULL, 0xfff7e3e3e3e3e3ffULL,
+        0xfff7e3e3c7c7c7ffULL, 0xfff7e3c387878fffULL, 0xfff7e38303031fffULL, 0xfff7c101010101ffULL,
+        0xfff7e3e0e0e0ffffULL, 0xfff7e3f0f0f8ffffULL, 0xfff7e3f1f1f1ffffULL, 0xfff7e3e3e3e3ffffULL,
+        0xfff7e3c7c7c7ffffULL, 0xfff7e387878fffffULL, 0xfff7e3030303ffffULL, 0xfff7c1010101c1ffULL,
+        0xfff7e0e0e0e3ffffULL, 0xfff7e0f0f0ffffffULL, 0xfff7e1f1f1ffffffULL, 0xfff7e3e3e3ffffffULL,
+        0xfff7c3c7c7ffffffULL, 0xfff7838787ffffffULL, 0xfff7030303e3ffffULL, 0xfff7010101c1c1ffULL,
+        0xfff4e0e0e2e3ffffULL, 0xfff0e0f0f5ffffffULL, 0xfff1e1f1fbffffffULL, 0xffe3e3e3f7ffffffULL,
+        0xffc7c3c7efffffffULL, 0xff878387d7ffffffULL, 0xff170303a3e3ffffULL, 0xff37010141c1c1ffULL,
+        0xfcf4e0e0e3e0ffffULL, 0xf8f0e0f1f7f1ffffULL, 0xf1f1e1f3fff3ffffULL, 0x0000000000000000ULL,
+        0xc7c7c3e7ffe7ffffULL, 0x8f8783c7f7c7ffffULL, 0x1f170383e383ffffULL, 0x3f370101c101c1ffULL,
+        0xfcf4e0e0e0e0e0ffULL, 0xf8f0e1e1e1e1e1ffULL, 0xf1f1e1e1e1e1e1ffULL, 0xe3e3e3e3e3e3e3ffULL,
+        0xc7c7c3c3c3c3c3ffULL, 0x8f87c3c3c3c3c3ffULL, 0x1f178383838383ffULL, 0x3f370101010101ffULL,
+        0xfffffffffff1f0f0ULL, 0xfffffffffffff8f8ULL, 0xfffffffffffcf0f0ULL, 0xfffffffffff8e0e0ULL,
+        0xfffffffffff8c0c0ULL, 0xfffffffffff88888ULL, 0xfffffffffff81818ULL, 0xfffffffffff83838ULL,
+        0x0000000000000000ULL, 0xfffffffffff8f8f8ULL, 0xfffffffffff0f0f0ULL, 0xffffffffffe0e0e0ULL,
+        0xffffffffffc0c0c0ULL, 0xffffffffff888888ULL, 0xffffffffff181818ULL, 0xffffffffff383838ULL,
+        0xfffffffffcfcfcfcULL, 0xfffffffff8f8f8fcULL, 0xfffffffff1f0f0fcULL, 0xffffffffe3e0e0f8ULL,
+        0xffffffffc7c0c0f8ULL, 0xffffffff8f8888f8ULL, 0xffffffff1f1818f8ULL, 0xffffffff3f3838f8ULL,
+        0xfffffffcfcf8f8f8ULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff1f1f0f8f8ULL, 0xffffffe3e3e0f8f8ULL,
+        0xffffffc7c7c0f8f8ULL, 0xffffff8f8f88f8f8ULL, 0xffffff1f1f18f8f8ULL, 0xffffff3f3f38f8f8ULL,
+        0xfffffcfcfcf8f8f8ULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff1f1f1f8f8f8ULL, 0xffffe3e3e3f8f8f8ULL,
+        0xffffc7c7c7f8f8f8ULL, 0xffff8f8f8ff8f8f8ULL, 0xffff1f1f1ff8f8f8ULL, 0xffff3f3f3ff8f8f8ULL,
+        0xfffcfcfcfff8f8f8ULL, 0xfff8f8f8fff8f8f8ULL, 0xfff1f1f1fff8f8f8ULL, 0xffe3e3e3fff8f8f8ULL,
+        0xffc7c7c7fff8f8f8ULL, 0xff8f8f8ffff8f8f8ULL, 0xff1f1f1ffff8f8f8ULL, 0xff3f3f3ffff8f8f8ULL,
+        0xfcfcfcfffff8f8f8ULL, 0xf8f8f8fffff8f8f8ULL, 0xf1f1f1fffff8f8f8ULL, 0xe3e3e3fffff8f8f8ULL,
+        0xc7c7c7fffff8f8f8ULL, 0x8f8f8ffffff8f8f8ULL, 0x1f1f1ffffff8f8f8ULL, 0x3f3f3ffffff8f8f8ULL,
+        0xfcfcfffffff8f8f8ULL, 0xf8f8fffffff8f8f8ULL, 0xf1f1fffffff8f8f8ULL, 0xe3e3fffffff8f8f8ULL,
+        0xc7c7fffffff8f8f8ULL, 0x8f8ffffffff8f8f8ULL, 0x1f1ffffffff8f8f8ULL, 0x3f3ffffffff8f8f8ULL,
+        0xfffffffffffffcfcULL, 0xfffffffffffff8f8ULL, 0xfffffffffffff1f1ULL, 0xfffffffffff8e0e0ULL,
+        0xfffffffffff0c0c0ULL, 0xfffffffffff08080ULL, 0xfffffffffff01010ULL, 0xfffffffffff03030ULL,
+        0xfffffffffffcfcfcULL, 0x0000000000000000ULL, 0xfffffffffff1f1f1ULL, 0xffffffffffe0e0e0ULL,
+        0xffffffffffc0c0c0ULL, 0xffffffffff808080ULL, 0xffffffffff101010ULL, 0xffffffffff303030ULL,
+        0xfffffffffcfcf8faULL, 0xfffffffff8f8f8fdULL, 0xfffffffff1f1f0faULL, 0xffffffffe3e0e0f8ULL,
+        0xffffffffc7c0c0f0ULL, 0xffffffff8f8080f0ULL, 0xffffffff1f1010f0ULL, 0xffffffff3f3030f0ULL,
+        0xfffffffcfcf0f0f0ULL, 0xfffffff8f8f0f0f0ULL, 0xfffffff1f1f0f0f0ULL, 0xffffffe3e3e0f0f0ULL,
+        0xffffffc7c7c0f0f0ULL, 0xffffff8f8f80f0f0ULL, 0xffffff1f1f10f0f0ULL, 0xffffff3f3f30f0f0ULL,
+        0xfffffcfcfcf0f0f0ULL, 0xfffff8f8f8f0f0f0ULL, 0xfffff1f1f1f0f0f0ULL, 0xffffe3e3e3f0f0f0ULL,
+        0xffffc7c7c7f0f0f0ULL, 0xffff8f8f8ff0f0f0ULL, 0xffff1f1f1ff0f0f0ULL, 0xffff3f3f3ff0f0f0ULL,
+        0xfffcfcfcfff0f0f0ULL, 0xfff8f8f8fff0f0f0ULL, 0xfff1f1f1fff0f0f0ULL, 0xffe3e3e3fff0f0f0ULL,
+        0xffc7c7c7fff0f0f0ULL, 0xff8f8f8ffff0f0f0ULL, 0xff1f1f1ffff0f0f0ULL, 0xff3f3f3ffff0f0f0ULL,
+        0xfcfcfcfffff0f0f0ULL, 0xf8f8f8fffff0f0f0ULL, 0xf1f1f1fffff0f0f0ULL, 0xe3e3e3fffff0f0f0ULL,
+        0xc7c7c7fffff0f0f0ULL, 0x8f8f8ffffff0f0f0ULL, 0x1f1f1ffffff0f0f0ULL, 0x3f3f3ffffff0f0f0ULL,
+        0xfcfcfffffff0f0f0ULL, 0xf8f8fffffff0f0f0ULL, 0xf1f1fffffff0f0f0ULL, 0xe3e3fffffff0f0f0ULL,
+        0xc7c7fffffff0f0f0ULL, 0x8f8ffffffff0f0f0ULL, 0x1f1ffffffff0f0f0ULL, 0x3f3ffffffff0f0f0ULL,
+        0xfffffffffff1f0f0ULL, 0xfffffffffffff8f8ULL, 0xfffffffffffff1f1ULL, 0xffffffffffffe3e3ULL,
+        0xfffffffffff1c1c1ULL, 0xffffffffffe08080ULL, 0xffffffffffe00000ULL, 0xffffffffffe02020ULL,
+        0xfffffffffff0f0f0ULL, 0xfffffffffff8f8f8ULL, 0x0000000000000000ULL, 0xffffffffffe3e3e3ULL,
+        0xffffffffffc1c1c1ULL, 0xffffffffff808080ULL, 0xffffffffff000000ULL, 0xffffffffff202020ULL,
+        0xfffffffffcf0f0f0ULL, 0xfffffffff8f8f0f4ULL, 0xfffffffff1f1f1fbULL, 0xffffffffe3e3e1f5ULL,
+        0xffffffffc7c1c1f1ULL, 0xffffffff8f8080e0ULL, 0xffffffff1f0000e0ULL, 0xffffffff3f2020e0ULL,
+        0xfffffffcfce0e0e0ULL, 0xfffffff8f8e0e0e0ULL, 0xfffffff1f1e0e0e0ULL, 0xffffffe3e3e0e0e0ULL,
+        0xffffffc7c7c0e0e0ULL, 0xffffff8f8f80e0e0ULL, 0xffffff1f1f00e0e0ULL, 0xffffff3f3f20e0e0ULL,
+        0xfffffcfcfce0e0e0ULL, 0xfffff8f8f8e0e0e0ULL, 0xfffff1f1f1e0e0e0ULL, 0xffffe3e3e3e0e0e0ULL,
+        0xffffc7c7c7e0e0e0ULL, 0xffff8f8f8fe0e0e0ULL, 0xffff1f1f1fe0e0e0ULL, 0xffff3f3f3fe0e0e0ULL,
+        0xfffcfcfcffe0e0e0ULL, 0xfff8f8f8ffe0e0e0ULL, 0xfff1f1f1ffe0e0e0ULL, 0xffe3e3e3ffe0e0e0ULL,
+        0xffc7c7c7ffe0e0e0ULL, 0xff8f8f8fffe0e0e0ULL, 0xff1f1f1fffe0e0e0ULL, 0xff3f3f3fffe0e0e0ULL,
+        0xfcfcfcffffe0e0e0ULL, 0xf8f8f8ffffe0e0e0ULL, 0xf1f1f1ffffe0e0e0ULL, 0xe3e3e3ffffe0e0e0ULL,
+        0xc7c7c7ffffe0e0e0ULL, 0x8f8f8fffffe0e0e0ULL, 0x1f1f1fffffe0e0e0ULL, 0x3f3f3fffffe0e0e0ULL,
+        0xfcfcffffffe0e0e0ULL, 0xf8f8ffffffe0e0e0ULL, 0xf1f1ffffffe0e0e0ULL, 0xe3e3ffffffe0e0e0ULL,
+        0xc7c7ffffffe0e0e0ULL, 0x8f8fffffffe0e0e0ULL, 0x1f1fffffffe0e0e0ULL, 0x3f3fffffffe0e0e0ULL,
+        0xffffffffffc1c0c0ULL, 0xffffffffffe3e0e0ULL, 0xfffffffffffff1f1ULL, 0xffffffffffffe3e3ULL,
+        0xffffffffffffc7c7ULL, 0xffffffffffe38383ULL, 0xffffffffffc10101ULL, 0xffffffffffc10101ULL,
+        0xffffffffffc0c0c0ULL, 0xffffffffffe0e0e0ULL, 0xfffffffffff1f1f1ULL, 0x0000000000000000ULL,
+        0xffffffffffc7c7c7ULL, 0xffffffffff838383ULL, 0xffffffffff010101ULL, 0xffffffffff010101ULL,
+        0xfffffffffcc0c0c1ULL, 0xfffffffff8e0e0e3ULL, 0xfffffffff1f1e1ebULL, 0xffffffffe3e3e3f7ULL,
+        0xffffffffc7c7c3ebULL, 0xffffffff8f8383e3ULL, 0xffffffff1f0101c1ULL, 0xffffffff3f0101c1ULL,
+        0xfffffffcfcc0c1c1ULL, 0xfffffff8f8c0c1c1ULL, 0xfffffff1f1c1c1c1ULL, 0xffffffe3e3c1c1c1ULL,
+        0xffffffc7c7c1c1c1ULL, 0xffffff8f8f81c1c1ULL, 0xffffff1f1f01c1c1ULL, 0xffffff3f3f01c1c1ULL,
+        0xfffffcfcfcc1c1c1ULL, 0xfffff8f8f8c1c1c1ULL, 0xfffff1f1f1c1c1c1ULL, 0xffffe3e3e3c1c1c1ULL,
+        0xffffc7c7c7c1c1c1ULL, 0xffff8f8f8fc1c1c1ULL, 0xffff1f1f1fc1c1c1ULL, 0xffff3f3f3fc1c1c1ULL,
+        0xfffcfcfcffc1c1c1ULL, 0xfff8f8f8ffc1c1c1ULL, 0xfff1f1f1ffc1c1c1ULL, 0xffe3e3e3ffc1c1c1ULL,
+        0xffc7c7c7ffc1c1c1ULL, 0xff8f8f8fffc1c1c1ULL, 0xff1f1f1fffc1c1c1ULL, 0xff3f3f3fffc1c1c1ULL,
+        0xfcfcfcffffc1c1c1ULL, 0xf8f8f8ffffc1c1c1ULL, 0xf1f1f1ffffc1c1c1ULL, 0xe3e3e3ffffc1c1c1ULL,
+        0xc7c7c7ffffc1c1c1ULL, 0x8f8f8fffffc1c1c1ULL, 0x1f1f1fffffc1c1c1ULL, 0x3f3f3fffffc1c1c1ULL,
+        0xfcfcffffffc1c1c1ULL, 0xf8f8ffffffc1c1c1ULL, 0xf1f1ffffffc1c1c1ULL, 0xe3e3ffffffc1c1c1ULL,
+        0xc7c7ffffffc1c1c1ULL, 0x8f8fffffffc1c1c1ULL, 0x1f1fffffffc1c1c1ULL, 0x3f3fffffffc1c1c1ULL,
+        0xfffffffff8f0f0f0ULL, 0xfffffffffcfcf8f8ULL, 0xfffffffff8f8f0f0ULL, 0xfffffffff0f0e0e0ULL,
+        0xfffffffff0f0c0c0ULL, 0xfffffffff0f08080ULL, 0xfffffffff0f01010ULL, 0xfffffffff0f03030ULL,
+        0xfffffffffff0f0f0ULL, 0xfffffffffff8f8f8ULL, 0xfffffffffcf0f0f0ULL, 0xfffffffff8e0e0e0ULL,
+        0xfffffffff0c0c0c0ULL, 0xfffffffff0808080ULL, 0xfffffffff0101010ULL, 0xfffffffff0303030ULL,
+        0x0000000000000000ULL, 0xfffffffff8f8f8f8ULL, 0xfffffffff0f0f0f8ULL, 0xffffffffe0e0e0f0ULL,
+        0xffffffffc0c0c0f0ULL, 0xffffffff808080f0ULL, 0xffffffff101010f0ULL, 0xffffffff303030f0ULL,
+        0xfffffffcf0f0f0f0ULL, 0xfffffff8f8f0f0f0ULL, 0xfffffff1f0f0f0f0ULL, 0xffffffe3e0e0f0f0ULL,
+        0xffffffc7c0c0f0f0ULL, 0xffffff8f8080f0f0ULL, 0xffffff1f1010f0f0ULL, 0xffffff3f3030f0f0ULL,
+        0xfffffcfcf0f0f0f0ULL, 0xfffff8f8f0f0f0f0ULL, 0xfffff1f1f0f0f0f0ULL, 0xffffe3e3e0f0f0f0ULL,
+        0xffffc7c7c0f0f0f0ULL, 0xffff8f8f80f0f0f0ULL, 0xffff1f1f10f0f0f0ULL, 0xffff3f3f30f0f0f0ULL,
+        0xfffcfcfcf0f0f0f0ULL, 0xfff8f8f8f0f0f0f0ULL, 0xfff1f1f1f0f0f0f0ULL, 0xffe3e3e3f0f0f0f0ULL,
+        0xffc7c7c7f0f0f0f0ULL, 0xff8f8f8ff0f0f0f0ULL, 0xff1f1f1ff0f0f0f0ULL, 0xff3f3f3ff0f0f0f0ULL,
+        0xfcfcfcfff0f0f0f0ULL, 0xf8f8f8fff0f0f0f0ULL, 0xf1f1f1fff0f0f0f0ULL, 0xe3e3e3fff0f0f0f0ULL,
+        0xc7c7c7fff0f0f0f0ULL, 0x8f8f8ffff0f0f0f0ULL, 0x1f1f1ffff0f0f0f0ULL, 0x3f3f3ffff0f0f0f0ULL,
+        0xfcfcfffff0f0f0f0ULL, 0xf8f8fffff0f0f0f0ULL, 0xf1f1fffff0f0f0f0ULL, 0xe3e3fffff0f0f0f0ULL,
+        0xc7c7fffff0f0f0f0ULL, 0x8f8ffffff0f0f0f0ULL, 0x1f1ffffff0f0f0f0ULL, 0x3f3ffffff0f0f0f0ULL,
+        0xfffffffff8f8f8fcULL, 0xfffffffff8f8f8f8ULL, 0xfffffffff8f8f0f0ULL, 0xfffffffff0f0e0e0ULL,
+        0xffffffffe0e0c0c0ULL, 0xffffffffe0e08080ULL, 0xffffffffe0e00000ULL, 0xffffffffe0e02020ULL,
+        0xfffffffffffcfcfcULL, 0xfffffffffff8f8f8ULL, 0xfffffffffff1f1f0ULL, 0xfffffffff8e0e0e0ULL,
+        0xfffffffff0c0c0c0ULL, 0xffffffffe0808080ULL, 0xffffffffe0000000ULL, 0xffffffffe0202020ULL,
+        0xfffffffffcfcfcfdULL, 0x0000000000000000ULL, 0xfffffffff1f1f0f5ULL, 0xffffffffe0e0e0f8ULL,
+        0xffffffffc0c0c0f0ULL, 0xffffffff808080e0ULL, 0xffffffff000000e0ULL, 0xffffffff202020e0ULL,
+        0xfffffffcfcf8f8f8ULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff1f1f0f8f8ULL, 0xffffffe3e0e0f8f8ULL,
+        0xffffffc7c0c0f0f0ULL, 0xffffff8f8080e0e0ULL, 0xffffff1f0000e0e0ULL, 0xffffff3f2020e0e0ULL,
+        0xfffffcfcf0f0f0f0ULL, 0xfffff8f8f0f0f0f0ULL, 0xfffff1f1f0f0f0f0ULL, 0xffffe3e3e0e0e0f0ULL,
+        0xffffc7c7c0e0e0f0ULL, 0xffff8f8f80e0e0e0ULL, 0xffff1f1f00e0e0e0ULL, 0xffff3f3f20e0e0e0ULL,
+        0xfffcfcfce0e0e0e0ULL, 0xfff8f8f8e0e0e0e0ULL, 0xfff1f1f1e0e0e0e0ULL, 0xffe3e3e3e0e0e0e0ULL,
+        0xffc7c7c7e0e0e0e0ULL, 0xff8f8f8fe0e0e0e0ULL, 0xff1f1f1fe0e0e0e0ULL, 0xff3f3f3fe0e0e0e0ULL,
+        0xfcfcfcffe0e0e0e0ULL, 0xf8f8f8ffe0e0e0e0ULL, 0xf1f1f1ffe0e0e0e0ULL, 0xe3e3e3ffe0e0e0e0ULL,
+        0xc7c7c7ffe0e0e0e0ULL, 0x8f8f8fffe0e0e0e0ULL, 0x1f1f1fffe0e0e0e0ULL, 0x3f3f3fffe0e0e0e0ULL,
+        0xfcfcffffe0e0e0e0ULL, 0xf8f8ffffe0e0e0e0ULL, 0xf1f1ffffe0e0e0e0ULL, 0xe3e3ffffe0e0e0e0ULL,
+        0xc7c7ffffe0e0e0e0ULL, 0x8f8fffffe0e0e0e0ULL, 0x1f1fffffe0e0e0e0ULL, 0x3f3fffffe0e0e0e0ULL,
+        0xfffffffff0f0f0f0ULL, 0xfffffffff1f1f0f8ULL, 0xfffffffff1f1f1f1ULL, 0xfffffffff1f1e1e3ULL,
+        0xffffffffe1e1c1c1ULL, 0xffffffffc0c08080ULL, 0xffffffffc0c00000ULL, 0xffffffffc0c00000ULL,
+        0xfffffffff1f0f0f0ULL, 0xfffffffffff8f8f8ULL, 0xfffffffffff1f1f1ULL, 0xffffffffffe3e3e3ULL,
+        0xfffffffff1c1c1c1ULL, 0xffffffffe0808080ULL, 0xffffffffc0000000ULL, 0xffffffffc0000000ULL,
+        0xfffffffff0f0f0f1ULL, 0xfffffffff8f8f8faULL, 0x0000000000000000ULL, 0xffffffffe3e3e3ebULL,
+        0xffffffffc1c1c1f1ULL, 0xffffffff808080e0ULL, 0xffffffff000000c0ULL, 0xffffffff000000c0ULL,
+        0xfffffffcf0f0f1f1ULL, 0xfffffff8f8f0f1f1ULL, 0xfffffff1f1f1f1f1ULL, 0xffffffe3e3e1f1f1ULL,
+        0xffffffc7c1c1f1f1ULL, 0xffffff8f8080e0e0ULL, 0xffffff1f0000c0c0ULL, 0xffffff3f0000c0c0ULL,
+        0xfffffcfce0e0e0e0ULL, 0xfffff8f8e0e0e0e0ULL, 0xfffff1f1e0e0e0e0ULL, 0xffffe3e3e0e0e0e0ULL,
+        0xffffc7c7c0c0c0e0ULL, 0xffff8f8f80c0c0e0ULL, 0xffff1f1f00c0c0c0ULL, 0xffff3f3f00c0c0c0ULL,
+        0xfffcfcfcc0c0c0c0ULL, 0xfff8f8f8c0c0c0c0ULL, 0xfff1f1f1c0c0c0c0ULL, 0xffe3e3e3c0c0c0c0ULL,
+        0xffc7c7c7c0c0c0c0ULL, 0xff8f8f8fc0c0c0c0ULL, 0xff1f1f1fc0c0c0c0ULL, 0xff3f3f3fc0c0c0c0ULL,
+        0xfcfcfcffc0c0c0c0ULL, 0xf8f8f8ffc0c0c0c0ULL, 0xf1f1f1ffc0c0c0c0ULL, 0xe3e3e3ffc0c0c0c0ULL,
+        0xc7c7c7ffc0c0c0c0ULL, 0x8f8f8fffc0c0c0c0ULL, 0x1f1f1fffc0c0c0c0ULL, 0x3f3f3fffc0c0c0c0ULL,
+        0xfcfcffffc0c0c0c0ULL, 0xf8f8ffffc0c0c0c0ULL, 0xf1f1ffffc0c0c0c0ULL, 0xe3e3ffffc0c0c0c0ULL,
+        0xc7c7ffffc0c0c0c0ULL, 0x8f8fffffc0c0c0c0ULL, 0x1f1fffffc0c0c0c0ULL, 0x3f3fffffc0c0c0c0ULL,
+        0xffffffffc0c0c0c0ULL, 0xffffffffe1e1e0e0ULL, 0xffffffffe3e3e1f1ULL, 0xffffffffe3e3e3e3ULL,
+        0xffffffffe3e3c3c7ULL, 0xffffffffc3c38383ULL, 0xffffffff81810101ULL, 0xffffffff80800000ULL,
+        0xffffffffc1c0c0c0ULL, 0xffffffffe3e0e0e0ULL, 0xfffffffffff1f1f1ULL, 0xffffffffffe3e3e3ULL,
+        0xffffffffffc7c7c7ULL, 0xffffffffe3838383ULL, 0xffffffffc1010101ULL, 0xffffffff80000000ULL,
+        0xffffffffc0c0c0c1ULL, 0xffffffffe0e0e0e3ULL, 0xfffffffff1f1f1f5ULL, 0x0000000000000000ULL,
+        0xffffffffc7c7c7d7ULL, 0xffffffff838383e3ULL, 0xffffffff010101c1ULL, 0xffffffff00000080ULL,
+        0xfffffffcc0c0c1c1ULL, 0xfffffff8e0e0e3e3ULL, 0xfffffff1f1e1e3e3ULL, 0xffffffe3e3e3e3e3ULL,
+        0xffffffc7c7c3e3e3ULL, 0xffffff8f8383e3e3ULL, 0xffffff1f0101c1c1ULL, 0xffffff3f00008080ULL,
+        0xfffffcfcc0c0c0c1ULL, 0xfffff8f8c0c0c0c1ULL, 0xfffff1f1c1c1c1c1ULL, 0xffffe3e3c1c1c1c1ULL,
+        0xffffc7c7c1c1c1c1ULL, 0xffff8f8f818181c1ULL, 0xffff1f1f018181c1ULL, 0xffff3f3f00808080ULL,
+        0xfffcfcfc80808080ULL, 0xfff8f8f880808080ULL, 0xfff1f1f180808080ULL, 0xffe3e3e380808080ULL,
+        0xffc7c7c780808080ULL, 0xff8f8f8f80808080ULL, 0xff1f1f1f80808080ULL, 0xff3f3f3f80808080ULL,
+        0xfcfcfcff80808080ULL, 0xf8f8f8ff80808080ULL, 0xf1f1f1ff80808080ULL, 0xe3e3e3ff80808080ULL,
+        0xc7c7c7ff80808080ULL, 0x8f8f8fff80808080ULL, 0x1f1f1fff80808080ULL, 0x3f3f3fff80808080ULL,
+        0xfcfcffff80808080ULL, 0xf8f8ffff80808080ULL, 0xf1f1ffff80808080ULL, 0xe3e3ffff80808080ULL,
+        0xc7c7ffff80808080ULL, 0x8f8fffff80808080ULL, 0x1f1fffff80808080ULL, 0x3f3fffff80808080ULL,
+        0xfffffff8f0f0f0f0ULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff8f0f0f0f0ULL, 0xfffffff0e0e0e0e0ULL,
+        0xffffffe0e0e0c0c0ULL, 0xffffffe0e0e08080ULL, 0xffffffe0e0e00000ULL, 0xffffffe0e0e02020ULL,
+        0xfffffffcf0f0f0f0ULL, 0xfffffffcfcf8f8f8ULL, 0xfffffff8f8f0f0f0ULL, 0xfffffff0f0e0e0e0ULL,
+        0xffffffe0e0c0c0c0ULL, 0xffffffe0e0808080ULL, 0xffffffe0e0000000ULL, 0xffffffe0e0202020ULL,
+        0xfffffffff0f0f0f0ULL, 0xfffffffff8f8f0f0ULL, 0xfffffffcf0f0f0f0ULL, 0xfffffff8e0e0e0e0ULL,
+        0xfffffff0c0c0c0e0ULL, 0xffffffe0808080e0ULL, 0xffffffe0000000e0ULL, 0xffffffe0202020e0ULL,
+        0x0000000000000000ULL, 0xfffffff8f8e0e0e0ULL, 0xfffffff0f0e0e0e0ULL, 0xffffffe0e0e0e0e0ULL,
+        0xffffffc0c0c0e0e0ULL, 0xffffff808080e0e0ULL, 0xffffff000000e0e0ULL, 0xffffff202020e0e0ULL,
+        0xfffffcf0e0e0e0e0ULL, 0xfffff8f8e0e0e0e0ULL, 0xfffff1f0e0e0e0e0ULL, 0xffffe3e0e0e0e0e0ULL,
+        0xffffc7c0c0e0e0e0ULL, 0xffff8f8080e0e0e0ULL, 0xffff1f0000e0e0e0ULL, 0xffff3f2020e0e0e0ULL,
+        0xfffcfce0e0e0e0e0ULL, 0xfff8f8e0e0e0e0e0ULL, 0xfff1f1e0e0e0e0e0ULL, 0xffe3e3e0e0e0e0e0ULL,
+        0xffc7c7c0e0e0e0e0ULL, 0xff8f8f80e0e0e0e0ULL, 0xff1f1f00e0e0e0e0ULL, 0xff3f3f20e0e0e0e0ULL,
+        0xfcfcfce0e0e0e0e0ULL, 0xf8f8f8e0e0e0e0e0ULL, 0xf1f1f1e0e0e0e0e0ULL, 0xe3e3e3e0e0e0e0e0ULL,
+        0xc7c7c7e0e0e0e0e0ULL, 0x8f8f8fe0e0e0e0e0ULL, 0x1f1f1fe0e0e0e0e0ULL, 0x3f3f3fe0e0e0e0e0ULL,
+        0xfcfcffe0e0e0e0e0ULL, 0xf8f8ffe0e0e0e0e0ULL, 0xf1f1ffe0e0e0e0e0ULL, 0xe3e3ffe0e0e0e0e0ULL,
+        0xc7c7ffe0e0e0e0e0ULL, 0x8f8fffe0e0e0e0e0ULL, 0x1f1fffe0e0e0e0e0ULL, 0x3f3fffe0e0e0e0e0ULL,
+        0xfffffff0f0f0f8fcULL, 0xfffffff0f0f0f8f8ULL, 0xfffffff0f0f0f0f1ULL, 0xfffffff0e0e0e0e0ULL,
+        0xffffffe0c0c0c0c0ULL, 0xffffffc0c0c08080ULL, 0xffffffc0c0c00000ULL, 0xffffffc0c0c00000ULL,
+        0xfffffff8f8f8fcfcULL, 0xfffffff8f8f8f8f8ULL, 0xfffffff8f8f0f1f1ULL, 0xfffffff0f0e0e0e0ULL,
+        0xffffffe0e0c0c0c0ULL, 0xffffffc0c0808080ULL, 0xffffffc0c0000000ULL, 0xffffffc0c0000000ULL,
+        0xfffffffffcfcfcffULL, 0xfffffffff8f8f8ffULL, 0xfffffffff1f1f1ffULL, 0xfffffff8e0e0e0f8ULL,
+        0xfffffff0c0c0c0f0ULL, 0xffffffe0808080e0ULL, 0xffffffc0000000c0ULL, 0xffffffc0000000c0ULL,
+        0xfffffffcfcf8f8f8ULL, 0x0000000000000000ULL, 0xfffffff1f1f0f0f0ULL, 0xffffffe0e0e0f0f0ULL,
+        0xffffffc0c0c0e0e0ULL, 0xffffff808080c0c0ULL, 0xffffff000000c0c0ULL, 0xffffff000000c0c0ULL,
+        0xfffffcfcf8f0f0f0ULL, 0xfffff8f8f8f0f0f0ULL, 0xfffff1f1e0e0e0e0ULL, 0xffffe3e0e0e0e0e0ULL,
+        0xffffc7c0c0c0c0e0ULL, 0xffff8f8080c0c0c0ULL, 0xffff1f0000c0c0c0ULL, 0xffff3f0000c0c0c0ULL,
+        0xfffcfcf0e0e0e0e0ULL, 0xfff8f8f0e0e0e0e0ULL, 0xfff1f1f0e0e0e0e0ULL, 0xffe3e3c0c0c0c0c0ULL,
+        0xffc7c7c0c0c0c0c0ULL, 0xff8f8f80c0c0c0c0ULL, 0xff1f1f00c0c0c0c0ULL, 0xff3f3f00c0c0c0c0ULL,
+        0xfcfcfcc0c0c0c0c0ULL, 0xf8f8f8c0c0c0c0c0ULL, 0xf1f1f1c0c0c0c0c0ULL, 0xe3e3e3c0c0c0c0c0ULL,
+        0xc7c7c7c0c0c0c0c0ULL, 0x8f8f8fc0c0c0c0c0ULL, 0x1f1f1fc0c0c0c0c0ULL, 0x3f3f3fc0c0c0c0c0ULL,
+        0xfcfcffc0c0c0c0c0ULL, 0xf8f8ffc0c0c0c0c0ULL, 0xf1f1ffc0c0c0c0c0ULL, 0xe3e3ffc0c0c0c0c0ULL,
+        0xc7c7ffc0c0c0c0c0ULL, 0x8f8fffc0c0c0c0c0ULL, 0x1f1fffc0c0c0c0c0ULL, 0x3f3fffc0c0c0c0c0ULL,
+        0xffffffe0e0e0f0f0ULL, 0xffffffe0e0e0f0f8ULL, 0xffffffe0e0e0f1f1ULL, 0xffffffe0e0e0e1e3ULL,
+        0xffffffe0c0c0c1c1ULL, 0xffffffc080808080ULL, 0xffffff8080800000ULL, 0xffffff8080800000ULL,
+        0xfffffff0f0f0f0f0ULL, 0xfffffff1f1f0f8f8ULL, 0xfffffff1f1f1f1f1ULL, 0xfffffff1f1e1e3e3ULL,
+        0xffffffe1e1c1c1c1ULL, 0xffffffc0c0808080ULL, 0xffffff8080000000ULL, 0xffffff8080000000ULL,
+        0xfffffff1f0f0f0f1ULL, 0xfffffffff8f8f8ffULL, 0xfffffffff1f1f1ffULL, 0xffffffffe3e3e3ffULL,
+        0xfffffff1c1c1c1f1ULL, 0xffffffe0808080e0ULL, 0xffffffc0000000c0ULL, 0xffffff8000000080ULL,
+        0xfffffff0f0f0f0f0ULL, 0xfffffff8f8f0f0f0ULL, 0x0000000000000000ULL, 0xffffffe3e3e1e1e1ULL,
+        0xffffffc1c1c1e1e1ULL, 0xffffff808080c0c0ULL, 0xffffff0000008080ULL, 0xffffff0000008080ULL,
+        0xfffffcf0f0e0e0e0ULL, 0xfffff8f8f0e0e0e0ULL, 0xfffff1f1f1e0e0e0ULL, 0xffffe3e3c1c0c0c0ULL,
+        0xffffc7c1c1c0c0c0ULL, 0xffff8f80808080c0ULL, 0xffff1f0000808080ULL, 0xffff3f0000808080ULL,
+        0xfffcfce0c0c0c0c0ULL, 0xfff8f8e0c0c0c0c0ULL, 0xfff1f1e0c0c0c0c0ULL, 0xffe3e3e0c0c0c0c0ULL,
+        0xffc7c78080808080ULL, 0xff8f8f8080808080ULL, 0xff1f1f0080808080ULL, 0xff3f3f0080808080ULL,
+        0xfcfcfc8080808080ULL, 0xf8f8f88080808080ULL, 0xf1f1f18080808080ULL, 0xe3e3e38080808080ULL,
+        0xc7c7c78080808080ULL, 0x8f8f8f8080808080ULL, 0x1f1f1f8080808080ULL, 0x3f3f3f8080808080ULL,
+        0xfcfcff8080808080ULL, 0xf8f8ff8080808080ULL, 0xf1f1ff8080808080ULL, 0xe3e3ff8080808080ULL,
+        0xc7c7ff8080808080ULL, 0x8f8fff8080808080ULL, 0x1f1fff8080808080ULL, 0x3f3fff8080808080ULL,
+        0xffffffc0c0c0c0c0ULL, 0xffffffc1c0c0e0e0ULL, 0xffffffc1c1c1e1f1ULL, 0xffffffc1c1c1e3e3ULL,
+        0xffffffc1c1c1c3c7ULL, 0xffffffc181818383ULL, 0xffffff8101010101ULL, 0xffffff0000000000ULL,
+        0xffffffc0c0c0c0c0ULL, 0xffffffe1e1e0e0e0ULL, 0xffffffe3e3e1f1f1ULL, 0xffffffe3e3e3e3e3ULL,
+        0xffffffe3e3c3c7c7ULL, 0xffffffc3c3838383ULL, 0xffffff8181010101ULL, 0xffffff0000000000ULL,
+        0xffffffc1c0c0c0c1ULL, 0xffffffe3e0e0e0e3ULL, 0xfffffffff1f1f1ffULL, 0xffffffffe3e3e3ffULL,
+        0xffffffffc7c7c7ffULL, 0xffffffe3838383e3ULL, 0xffffffc1010101c1ULL, 0xffffff8000000080ULL,
+        0xffffffc0c0c0c0c0ULL, 0xffffffe0e0e0e1e1ULL, 0xfffffff1f1e1e1e1ULL, 0x0000000000000000ULL,
+        0xffffffc7c7c3c3c3ULL, 0xffffff838383c3c3ULL, 0xffffff0101018181ULL, 0xffffff0000000000ULL,
+        0xfffffcc0c0c0c0c0ULL, 0xfffff8e0e0c0c0c0ULL, 0xfffff1f1e0c0c0c0ULL, 0xffffe3e3e3c1c1c1ULL,
+        0xffffc7c783818181ULL, 0xffff8f8383818181ULL, 0xffff1f0101010181ULL, 0xffff3f0000000000ULL,
+        0xfffcfcc080808080ULL, 0xfff8f8c080808080ULL, 0xfff1f1c180808080ULL, 0xffe3e3c180808080ULL,
+        0xffc7c7c180808080ULL, 0xff8f8f0100000000ULL, 0xff1f1f0100000000ULL, 0xff3f3f0000000000ULL,
+        0xfcfcfc0000000000ULL, 0xf8f8f80000000000ULL, 0xf1f1f10000000000ULL, 0xe3e3e30000000000ULL,
+        0xc7c7c70000000000ULL, 0x8f8f8f0000000000ULL, 0x1f1f1f0000000000ULL, 0x3f3f3f0000000000ULL,
+        0xfcfcff0000000000ULL, 0xf8f8ff0000000000ULL, 0xf1f1ff0000000000ULL, 0xe3e3ff0000000000ULL,
+        0xc7c7ff0000000000ULL, 0x8f8fff0000000000ULL, 0x1f1fff0000000000ULL, 0x3f3fff0000000000ULL,
+        0xfffff0f0f0f0f0f0ULL, 0xfffff0f0f0f0f0f8ULL, 0xfffff0f0f0f0f0f0ULL, 0xffffe0e0e0e0e0e0ULL,
+        0xffffc0c0c0c0c0c0ULL, 0xffffc0c0c0c08080ULL, 0xffffc0c0c0c00000ULL, 0xffffc0c0c0c00000ULL,
+        0xfffff8f0f0f0f0f0ULL, 0xfffff8f8f8f8f8f8ULL, 0xfffff8f0f0f0f0f0ULL, 0xfffff0e0e0e0e0e0ULL,
+        0xffffe0c0c0c0c0c0ULL, 0xffffc0c0c0808080ULL, 0xffffc0c0c0000000ULL, 0xffffc0c0c0000000ULL,
+        0xfffffcf0f0f0f0f0ULL, 0xfffffcfcf8f8f0f0ULL, 0xfffff8f8f0f0f0f0ULL, 0xfffff0f0e0e0e0e0ULL,
+        0xffffe0e0c0c0c0c0ULL, 0xffffc0c0808080c0ULL, 0xffffc0c0000000c0ULL, 0xffffc0c0000000c0ULL,
+        0xfffffff0f0e0e0e0ULL, 0xfffffff8f8e0e0e0ULL, 0xfffffcf0f0e0e0e0ULL, 0xfffff8e0e0e0e0e0ULL,
+        0xfffff0c0c0c0c0c0ULL, 0xffffe0808080c0c0ULL, 0xffffc0000000c0c0ULL, 0xffffc0000000c0c0ULL,
+        0x0000000000000000ULL, 0xfffff8f8c0c0c0c0ULL, 0xfffff0f0c0c0c0c0ULL, 0xffffe0e0c0c0c0c0ULL,
+        0xffffc0c0c0c0c0c0ULL, 0xffff808080c0c0c0ULL, 0xffff000000c0c0c0ULL, 0xffff000000c0c0c0ULL,
+        0xfffcf0c0c0c0c0c0ULL, 0xfff8f8c0c0c0c0c0ULL, 0xfff1f0c0c0c0c0c0ULL, 0xffe3e0c0c0c0c0c0ULL,
+        0xffc7c0c0c0c0c0c0ULL, 0xff8f8080c0c0c0c0ULL, 0xff1f0000c0c0c0c0ULL, 0xff3f0000c0c0c0c0ULL,
+        0xfcfcc0c0c0c0c0c0ULL, 0xf8f8c0c0c0c0c0c0ULL, 0xf1f1c0c0c0c0c0c0ULL, 0xe3e3c0c0c0c0c0c0ULL,
+        0xc7c7c0c0c0c0c0c0ULL, 0x8f8f80c0c0c0c0c0ULL, 0x1f1f00c0c0c0c0c0ULL, 0x3f3f00c0c0c0c0c0ULL,
+        0xfcfcc0c0c0c0c0c0ULL, 0xf8f8c0c0c0c0c0c0ULL, 0xf1f1c0c0c0c0c0c0ULL, 0xe3e3c0c0c0c0c0c0ULL,
+        0xc7c7c0c0c0c0c0c0ULL, 0x8f8fc0c0c0c0c0c0ULL, 0x1f1fc0c0c0c0c0c0ULL, 0x3f3fc0c0c0c0c0c0ULL,
+        0xffffe0e0e0e0f0fcULL, 0xffffe0e0e0e0f0f8ULL, 0xffffe0e0e0e0f0f1ULL, 0xffffe0e0e0e0e0e0ULL,
+        0xffffc0c0c0c0c0c0ULL, 0xffff808080808080ULL, 0xffff808080800000ULL, 0xffff808080800000ULL,
+        0xfffff0f0f0f8fcfcULL, 0xfffff0f0f0f8f8f8ULL, 0xfffff0f0f0f0f1f1ULL, 0xfffff0e0e0e0e0e0ULL,
+        0xffffe0c0c0c0c0c0ULL, 0xffffc08080808080ULL, 0xffff808080000000ULL, 0xffff808080000000ULL,
+        0xfffff8f8f8fcfcffULL, 0xfffff8f8f8f8f8ffULL, 0xfffff8f8f0f1f1ffULL, 0xfffff0f0e0e0e0f8ULL,
+        0xffffe0e0c0c0c0f0ULL, 0xffffc0c0808080e0ULL, 0xffff8080000000c0ULL, 0xffff808000000080ULL,
+        0xfffffffcfcfcfdfcULL, 0xfffffff8f8f8faf8ULL, 0xfffffff1f1f1f5f1ULL, 0xfffff8e0e0e0e8e0ULL,
+        0xfffff0c0c0c0d0c0ULL, 0xffffe0808080a080ULL, 0xffffc0000000c0c0ULL, 0xffff800000008080ULL,
+        0xfffffcfcf8f8f8f8ULL, 0x0000000000000000ULL, 0xfffff1f1f0f0f0f0ULL, 0xffffe0e0e0e0e0e0ULL,
+        0xffffc0c0c0c0c0c0ULL, 0xffff808080808080ULL, 0xffff000000808080ULL, 0xffff000000808080ULL,
+        0xfffcfcf8f0f0f0f0ULL, 0xfff8f8f8f0f0f0f0ULL, 0xfff1f1e0e0e0e0e0ULL, 0xffe3e0e0e0e0e0e0ULL,
+        0xffc7c0c0c0c0c0c0ULL, 0xff8f808080808080ULL, 0xff1f000080808080ULL, 0xff3f000080808080ULL,
+        0xfcfcf0e0e0e0e0e0ULL, 0xf8f8f0e0e0e0e0e0ULL, 0xf1f1f0e0e0e0e0e0ULL, 0xe3e3c0c0c0c0c0c0ULL,
+        0xc7c7c0c0c0c0c0c0ULL, 0x8f8f808080808080ULL, 0x1f1f008080808080ULL, 0x3f3f008080808080ULL,
+        0xfcfcc0c0c0c0c0c0ULL, 0xf8f8c0c0c0c0c0c0ULL, 0xf1f1c0c0c0c0c0c0ULL, 0xe3e3c0c0c0c0c0c0ULL,
+        0xc7c7808080808080ULL, 0x8f8f808080808080ULL, 0x1f1f808080808080ULL, 0x3f3f808080808080ULL,
+        0xffffc0c0c0c0e0f0ULL, 0xffffc0c0c0c0e0f8ULL, 0xffffc0c0c0c0e0f1ULL, 0xffffc0c0c0c0e0e3ULL,
+        0xffffc0c0c0c0c0c1ULL, 0xffff808080808080ULL, 0xffff000000000000ULL, 0xffff000000000000ULL,
+        0xffffe0e0e0f0f0f0ULL, 0xffffe0e0e0f0f8f8ULL, 0xffffe0e0e0f1f1f1ULL, 0xffffe0e0e0e1e3e3ULL,
+        0xffffe0c0c0c1c1c1ULL, 0xffffc08080808080ULL, 0xffff800000000000ULL, 0xffff000000000000ULL,
+        0xfffff0f0f0f0f0f1ULL, 0xfffff1f1f0f8f8ffULL, 0xfffff1f1f1f1f1ffULL, 0xfffff1f1e1e3e3ffULL,
+        0xffffe1e1c1c1c1f1ULL, 0xffffc0c0808080e0ULL, 0xffff8080000000c0ULL, 0xffff000000000080ULL,
+        0xfffff1f0f0f0f1f0ULL, 0xfffffff8f8f8faf8ULL, 0xfffffff1f1f1f5f1ULL, 0xffffffe3e3e3ebe3ULL,
+        0xfffff1c1c1c1d1c1ULL, 0xffffe0808080a080ULL, 0xffffc00000004000ULL, 0xffff800000008080ULL,
+        0xfffff0f0f0f0f0f0ULL, 0xfffff8f8f0f0f0f0ULL, 0x0000000000000000ULL, 0xffffe3e3e1e1e1e1ULL,
+        0xffffc1c1c1c1c1c1ULL, 0xffff808080808080ULL, 0xffff000000000000ULL, 0xffff000000000000ULL,
+        0xfffcf0f0e0e0e0e0ULL, 0xfff8f8f0e0e0e0e0ULL, 0xfff1f1f1e0e0e0e0ULL, 0xffe3e3c1c0c0c0c0ULL,
+        0xffc7c1c1c0c0c0c0ULL, 0xff8f808080808080ULL, 0xff1f000000000000ULL, 0xff3f000000000000ULL,
+        0xfcfce0c0c0c0c0c0ULL, 0xf8f8e0c0c0c0c0c0ULL, 0xf1f1e0c0c0c0c0c0ULL, 0xe3e3e0c0c0c0c0c0ULL,
+        0xc7c7808080808080ULL, 0x8f8f808080808080ULL, 0x1f1f000000000000ULL, 0x3f3f000000000000ULL,
+        0xfcfc808080808080ULL, 0xf8f8808080808080ULL, 0xf1f1808080808080ULL, 0xe3e3808080808080ULL,
+        0xc7c7808080808080ULL, 0x8f8f000000000000ULL, 0x1f1f000000000000ULL, 0x3f3f000000000000ULL,
+        0xffff80808080c0c0ULL, 0xffff80808080c0e0ULL, 0xffff80808080c1f1ULL, 0xffff80808080c1e3ULL,
+        0xffff80808080c1c7ULL, 0xffff808080808183ULL, 0xffff000000000101ULL, 0xffff000000000000ULL,
+        0xffffc0c0c0c0c0c0ULL, 0xffffc1c0c0e0e0e0ULL, 0xffffc1c1c1e1f1f1ULL, 0xffffc1c1c1e3e3e3ULL,
+        0xffffc1c1c1c3c7c7ULL, 0xffffc18181838383ULL, 0xffff810101010101ULL, 0xffff000000000000ULL,
+        0xffffc0c0c0c0c0c1ULL, 0xffffe1e1e0e0e0e3ULL, 0xffffe3e3e1f1f1ffULL, 0xffffe3e3e3e3e3ffULL,
+        0xffffe3e3c3c7c7ffULL, 0xffffc3c3838383e3ULL, 0xffff8181010101c1ULL, 0xffff000000000080ULL,
+        0xffffc1c0c0c0c1c0ULL, 0xffffe3e0e0e0e2e0ULL, 0xfffffff1f1f1f5f1ULL, 0xffffffe3e3e3ebe3ULL,
+        0xffffffc7c7c7d7c7ULL, 0xffffe3838383a383ULL, 0xffffc10101014101ULL, 0xffff800000008000ULL,
+        0xffffc0c0c0c0c0c0ULL, 0xffffe0e0e0e0e0e0ULL, 0xfffff1f1e1e1e1e1ULL, 0x0000000000000000ULL,
+        0xffffc7c7c3c3c3c3ULL, 0xffff838383838383ULL, 0xffff010101010101ULL, 0xffff000000000000ULL,
+        0xfffcc0c0c0c0c0c0ULL, 0xfff8e0e0c0c0c0c0ULL, 0xfff1f1e0c0c0c0c0ULL, 0xffe3e3e3c1c1c1c1ULL,
+        0xffc7c78381818181ULL, 0xff8f838381818181ULL, 0xff1f010101010101ULL, 0xff3f000000000000ULL,
+        0xfcfcc08080808080ULL, 0xf8f8c08080808080ULL, 0xf1f1c18080808080ULL, 0xe3e3c18080808080ULL,
+        0xc7c7c18080808080ULL, 0x8f8f010000000000ULL, 0x1f1f010000000000ULL, 0x3f3f000000000000ULL,
+        0xfcfc000000000000ULL, 0xf8f8000000000000ULL, 0xf1f1000000000000ULL, 0xe3e3000000000000ULL,
+        0xc7c7000000000000ULL, 0x8f8f000000000000ULL, 0x1f1f000000000000ULL, 0x3f3f000000000000ULL,
+        0xffe0e0e0e0e0e0f0ULL, 0xffe0e0e0e0e0e0f8ULL, 0xffe0e0e0e0e0e0f0ULL, 0xffe0e0e0e0e0e0e0ULL,
+        0xffc0c0c0c0c0c0c0ULL, 0xff80808080808080ULL, 0xff80808080800000ULL, 0xff80808080800000ULL,
+        0xfff0f0f0f0f0f0f0ULL, 0xfff0f0f0f0f0f8f8ULL, 0xfff0f0f0f0f0f0f0ULL, 0xffe0e0e0e0e0e0e0ULL,
+        0xffc0c0c0c0c0c0c0ULL, 0xff80808080808080ULL, 0xff80808080000000ULL, 0xff80808080000000ULL,
+        0xfff8f0f0f0f0f0f0ULL, 0xfff8f8f8f8f8f0f0ULL, 0xfff8f0f0f0f0f0f0ULL, 0xfff0e0e0e0e0e0e0ULL,
+        0xffe0c0c0c0c0c0c0ULL, 0xffc0808080808080ULL, 0xff80808000000080ULL, 0xff80808000000080ULL,
+        0xfffcf0f0f0e0e0e0ULL, 0xfffcfcf8f8e0e0e0ULL, 0xfff8f8f0f0e0e0e0ULL, 0xfff0f0e0e0e0e0e0ULL,
+        0xffe0e0c0c0c0c0c0ULL, 0xffc0c08080808080ULL, 0xff80800000008080ULL, 0xff80800000008080ULL,
+        0xfffff0f0c0c0c0c0ULL, 0xfffff8f8c0c0c0c0ULL, 0xfffcf0f0c0c0c0c0ULL, 0xfff8e0e0c0c0c0c0ULL,
+        0xfff0c0c0c0c0c0c0ULL, 0xffe0808080808080ULL, 0xffc0000000808080ULL, 0xff80000000808080ULL,
+        0x0000000000000000ULL, 0xfff8f88080808080ULL, 0xfff0f08080808080ULL, 0xffe0e08080808080ULL,
+        0xffc0c08080808080ULL, 0xff80808080808080ULL, 0xff00000080808080ULL, 0xff00000080808080ULL,
+        0xfcf0808080808080ULL, 0xf8f8808080808080ULL, 0xf1f0808080808080ULL, 0xe3e0808080808080ULL,
+        0xc7c0808080808080ULL, 0x8f80808080808080ULL, 0x1f00008080808080ULL, 0x3f00008080808080ULL,
+        0xfc80808080808080ULL, 0xf880808080808080ULL, 0xf180808080808080ULL, 0xe380808080808080ULL,
+        0xc780808080808080ULL, 0x8f80808080808080ULL, 0x1f00808080808080ULL, 0x3f00808080808080ULL,
+        0xffc0c0c0c0c0e0fcULL, 0xffc0c0c0c0c0e0f8ULL, 0xffc0c0c0c0c0e0f1ULL, 0xffc0c0c0c0c0e0e0ULL,
+        0xffc0c0c0c0c0c0c0ULL, 0xff80808080808080ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+        0xffe0e0e0e0f0fcfcULL, 0xffe0e0e0e0f0f8f8ULL, 0xffe0e0e0e0f0f1f1ULL, 0xffe0e0e0e0e0e0e0ULL,
+        0xffc0c0c0c0c0c0c0ULL, 0xff80808080808080ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+        0xfff0f0f0f8fcfcffULL, 0xfff0f0f0f8f8f8ffULL, 0xfff0f0f0f0f1f1ffULL, 0xfff0e0e0e0e0e0ffULL,
+        0xffe0c0c0c0c0c0f0ULL, 0xffc08080808080e0ULL, 0xff800000000000c0ULL, 0xff00000000000080ULL,
+        0xfff8f8f8fcfcffffULL, 0xfff8f8f8f8f8ffffULL, 0xfff8f8f0f1f1ffffULL, 0xfff0f0e0e0e0f8ffULL,
+        0xffe0e0c0c0c0f0f0ULL, 0xffc0c0808080e0e0ULL, 0xff8080000000c0c0ULL, 0xff00000000008080ULL,
+        0xfffffcfcfcfdfcffULL, 0xfffff8f8f8faf8ffULL, 0xfffff1f1f1f5f1ffULL, 0xfff8e0e0e0e8e0ffULL,
+        0xfff0c0c0c0d0c0f0ULL, 0xffe0808080a080e0ULL, 0xffc00000004000c0ULL, 0xff80000000808080ULL,
+        0xfffcfcf8f8f8f8f8ULL, 0x0000000000000000ULL, 0xfff1f1f0f0f0f0f0ULL, 0xffe0e0e0e0e0e0e0ULL,
+        0xffc0c0c0c0c0c0c0ULL, 0xff80808080808080ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+        0xfcfcf8f0f0f0f0f0ULL, 0xf8f8f8f0f0f0f0f0ULL, 0xf1f1e0e0e0e0e0e0ULL, 0xe3e0e0e0e0e0e0e0ULL,
+        0xc7c0c0c0c0c0c0c0ULL, 0x8f80808080808080ULL, 0x1f00000000000000ULL, 0x3f00000000000000ULL,
+        0xfcf0e0e0e0e0e0e0ULL, 0xf8f0e0e0e0e0e0e0ULL, 0xf1f0e0e0e0e0e0e0ULL, 0xe3c0c0c0c0c0c0c0ULL,
+        0xc7c0c0c0c0c0c0c0ULL, 0x8f80808080808080ULL, 0x1f00000000000000ULL, 0x3f00000000000000ULL,
+        0xff8080808080c0f0ULL, 0xff8080808080c0f8ULL, 0xff8080808080c0f1ULL, 0xff8080808080c0e3ULL,
+        0xff8080808080c0c1ULL, 0xff80808080808080ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+        0xffc0c0c0c0e0f0f0ULL, 0xffc0c0c0c0e0f8f8ULL, 0xffc0c0c0c0e0f1f1ULL, 0xffc0c0c0c0e0e3e3ULL,
+        0xffc0c0c0c0c0c1c1ULL, 0xff80808080808080ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+        0xffe0e0e0f0f0f0ffULL, 0xffe0e0e0f0f8f8ffULL, 0xffe0e0e0f1f1f1ffULL, 0xffe0e0e0e1e3e3ffULL,
+        0xffe0c0c0c1c1c1ffULL, 0xffc08080808080e0ULL, 0xff800000000000c0ULL, 0xff00000000000080ULL,
+        0xfff0f0f0f0f0f1ffULL, 0xfff1f1f0f8f8ffffULL, 0xfff1f1f1f1f1ffffULL, 0xfff1f1e1e3e3ffffULL,
+        0xffe1e1c1c1c1f1ffULL, 0xffc0c0808080e0e0ULL, 0xff8080000000c0c0ULL, 0xff00000000008080ULL,
+        0xfff1f0f0f0f1f0ffULL, 0xfffff8f8f8faf8ffULL, 0xfffff1f1f1f5f1ffULL, 0xffffe3e3e3ebe3ffULL,
+        0xfff1c1c1c1d1c1ffULL, 0xffe0808080a080e0ULL, 0xffc00000004000c0ULL, 0xff80000000800080ULL,
+        0xfff0f0f0f0f0f0f0ULL, 0xfff8f8f0f0f0f0f0ULL, 0x0000000000000000ULL, 0xffe3e3e1e1e1e1e1ULL,
+        0xffc1c1c1c1c1c1c1ULL, 0xff80808080808080ULL, 0xff00000000000000ULL, 0xff00000000000000ULL,
+        0xfcf0f0e0e0e0e0e0ULL, 0xf8f8f0e0e0e0e0e0ULL, 0xf1f1f1e0e0e0e0e0ULL, 0xe3e3c1c0c0c0c0c0ULL,
+        0xc7c1c1c0c0c0c0c0ULL, 0x8f80808080808080ULL, 0x1f00000000000000ULL, 0x3f00000000000000ULL,
+        0xfce0c0c0c0c0c0c0ULL, 0xf8e0c0c0c0c0c0c0ULL, 0xf1e0c0c0c0c0c0c0ULL, 0xe3e0c0c0c0c0c0c0ULL,
+        0xc780808080808080ULL, 0x8f80808080808080ULL, 0x1f00000000000000ULL, 0x3f00000000000000ULL,
+        0xff000000000080c0ULL, 0xff000000000080e0ULL, 0xff000000000080f1ULL, 0xff000000000080e3ULL,
+        0xff000000000080c7ULL, 0xff00000000008083ULL, 0xff00000000000001ULL, 0xff00000000000000ULL,
+        0xff80808080c0c0c0ULL, 0xff80808080c0e0e0ULL, 0xff80808080c1f1f1ULL, 0xff80808080c1e3e3ULL,
+        0xff80808080c1c7c7ULL, 0xff80808080818383ULL, 0xff00000000010101ULL, 0xff00000000000000ULL,
+        0xffc0c0c0c0c0c0c1ULL, 0xffc1c0c0e0e0e0ffULL, 0xffc1c1c1e1f1f1ffULL, 0xffc1c1c1e3e3e3ffULL,
+        0xffc1c1c1c3c7c7ffULL, 0xffc18181838383ffULL, 0xff810101010101c1ULL, 0xff00000000000080ULL,
+        0xffc0c0c0c0c0c1c1ULL, 0xffe1e1e0e0e0e3ffULL, 0xffe3e3e1f1f1ffffULL, 0xffe3e3e3e3e3ffffULL,
+        0xffe3e3c3c7c7ffffULL, 0xffc3c3838383e3ffULL, 0xff8181010101c1c1ULL, 0xff00000000008080ULL,
+        0xffc1c0c0c0c1c0c1ULL, 0xffe3e0e0e0e2e0ffULL, 0xfffff1f1f1f5f1ffULL, 0xffffe3e3e3ebe3ffULL,
+        0xffffc7c7c7d7c7ffULL, 0xffe3838383a383ffULL, 0xffc10101014101c1ULL, 0xff80000000800080ULL,
+        0xffc0c0c0c0c0c0c0ULL, 0xffe0e0e0e0e0e0e0ULL, 0xfff1f1e1e1e1e1e1ULL, 0x0000000000000000ULL,
+        0xffc7c7c3c3c3c3c3ULL, 0xff83838383838383ULL, 0xff01010101010101ULL, 0xff00000000000000ULL,
+        0xfcc0c0c0c0c0c0c0ULL, 0xf8e0e0c0c0c0c0c0ULL, 0xf1f1e0c0c0c0c0c0ULL, 0xe3e3e3c1c1c1c1c1ULL,
+        0xc7c7838181818181ULL, 0x8f83838181818181ULL, 0x1f01010101010101ULL, 0x3f00000000000000ULL,
+        0xfcc0808080808080ULL, 0xf8c0808080808080ULL, 0xf1c1808080808080ULL, 0xe3c1808080808080ULL,
+        0xc7c1808080808080ULL, 0x8f01000000000000ULL, 0x1f01000000000000ULL, 0x3f00000000000000ULL,
+        0xfce0e0e0e0e0e0f0ULL, 0xfce0e0e0e0e0e0f8ULL, 0xfce0e0e0e0e0e0f0ULL, 0xfce0e0e0e0e0e0e0ULL,
+        0xfcc0c0c0c0c0c0c0ULL, 0xfc80808080808080ULL, 0xfc80808080800000ULL, 0xfc80808080800000ULL,
+        0xfcf0f0f0f0f0f0f0ULL, 0xfcf0f0f0f0f0f8f8ULL, 0xfcf0f0f0f0f0f0f0ULL, 0xfce0e0e0e0e0e0e0ULL,
+        0xfcc0c0c0c0c0c0c0ULL, 0xfc80808080808080ULL, 0xfc80808080000000ULL, 0xfc80808080000000ULL,
+        0xfcfcf0f0f0f0f0f0ULL, 0xfcfcf8f8f8f8f0f0ULL, 0xfcfcf0f0f0f0f0f0ULL, 0xfcfce0e0e0e0e0e0ULL,
+        0xfcf0c0c0c0c0c0c0ULL, 0xfce0808080808080ULL, 0xfcc0808000000080ULL, 0xfc80808000000080ULL,
+        0xfcfcf0f0f0e0e0e0ULL, 0xfcfcfcf8f8e0e0e0ULL, 0xfcfcfcf0f0e0e0e0ULL, 0xfcfcf8e0e0e0e0e0ULL,
+        0xfcf0f0c0c0c0c0c0ULL, 0xfce0e08080808080ULL, 0xfcc0c00000008080ULL, 0xfc80800000008080ULL,
+        0xfcfcf0f0c0c0c0c0ULL, 0xfcfcf8f8c0c0c0c0ULL, 0xfcfcf0f0c0c0c0c0ULL, 0xfcfce0e0c0c0c0c0ULL,
+        0xfcf0c0c0c0c0c0c0ULL, 0xfce0808080808080ULL, 0xfcc0000000808080ULL, 0xfc80000000808080ULL,
+        0xfff0f08080808080ULL, 0xfff8f88080808080ULL, 0xfcf0f08080808080ULL, 0xfce0e08080808080ULL,
+        0xfcc0c08080808080ULL, 0xfc80808080808080ULL, 0xfc00000080808080ULL, 0xfc00000080808080ULL,
+        0x0000000000000000ULL, 0xf8f8808080808080ULL, 0xf0f0808080808080ULL, 0xe0e0808080808080ULL,
+        0xc4c0808080808080ULL, 0x8c80808080808080ULL, 0x1c00008080808080ULL, 0x3c00008080808080ULL,
+        0xfc80808080808080ULL, 0xf880808080808080ULL, 0xf080808080808080ULL, 0xe080808080808080ULL,
+        0xc480808080808080ULL, 0x8c80808080808080ULL, 0x1c00808080808080ULL, 0x3c00808080808080ULL,
+        0xf8c0c0c0c0c0c0fcULL, 0xf8c0c0c0c0c0c0f8ULL, 0xf8c0c0c0c0c0c0f1ULL, 0xf8c0c0c0c0c0c0e0ULL,
+        0xf8c0c0c0c0c0c0c0ULL, 0xf880808080808080ULL, 0xf800000000000000ULL, 0xf800000000000000ULL,
+        0xf8e0e0e0e0e0fcfcULL, 0xf8e0e0e0e0e0f8f8ULL, 0xf8e0e0e0e0e0f1f1ULL, 0xf8e0e0e0e0e0e0e0ULL,
+        0xf8c0c0c0c0c0c0c0ULL, 0xf880808080808080ULL, 0xf800000000000000ULL, 0xf800000000000000ULL,
+        0xf8f8f0f0f0fcfcffULL, 0xf8f8f0f0f0f8f8ffULL, 0xf8f8f0f0f0f1f1ffULL, 0xf8f8e0e0e0e0e0ffULL,
+        0xf8f8c0c0c0c0c0ffULL, 0xf8e08080808080e0ULL, 0xf8c00000000000c0ULL, 0xf880000000000080ULL,
+        0xf8f8f8f8fcfcffffULL, 0xf8f8f8f8f8f8ffffULL, 0xf8f8f8f0f1f1ffffULL, 0xf8f8f8e0e0e0ffffULL,
+        0xf8f8f0c0c0c0f0ffULL, 0xf8e0e0808080e0e0ULL, 0xf8c0c0000000c0c0ULL, 0xf880800000008080ULL,
+        0xf8f8f8fcfcffffffULL, 0xf8f8f8f8f8ffffffULL, 0xf8f8f0f1f1ffffffULL, 0xf8f8e0e0e0f8ffffULL,
+        0xf8f8c0c0c0f0f0ffULL, 0xf8e0808080e0e0e0ULL, 0xf8c0000000c0c0c0ULL, 0xf880000000808080ULL,
+        0xfffcfcfcfdfcffffULL, 0xfff8f8f8faf8ffffULL, 0xfff1f1f1f5f1ffffULL, 0xf8e0e0e0e8e0ffffULL,
+        0xf8c0c0c0d0c0f0ffULL, 0xf8808080a080e0e0ULL, 0xf80000004000c0c0ULL, 0xf800000080808080ULL,
+        0xfcfcf8f8f8f8f8ffULL, 0x0000000000000000ULL, 0xf1f1f0f0f0f0f0ffULL, 0xe0e0e0e0e0e0e0ffULL,
+        0xc0c0c0c0c0c0c0ffULL, 0x88808080808080e0ULL, 0x18000000000000c0ULL, 0x3800000000000080ULL,
+        0xfcf8f0f0f0f0f0f0ULL, 0xf8f8f0f0f0f0f0f0ULL, 0xf1e0e0e0e0e0e0e0ULL, 0xe0e0e0e0e0e0e0e0ULL,
+        0xc0c0c0c0c0c0c0c0ULL, 0x8880808080808080ULL, 0x1800000000000000ULL, 0x3800000000000000ULL,
+        0xf1808080808080f0ULL, 0xf1808080808080f8ULL, 0xf1808080808080f1ULL, 0xf1808080808080e3ULL,
+        0xf1808080808080c1ULL, 0xf180808080808080ULL, 0xf100000000000000ULL, 0xf100000000000000ULL,
+        0xf1c0c0c0c0c0f0f0ULL, 0xf1c0c0c0c0c0f8f8ULL, 0xf1c0c0c0c0c0f1f1ULL, 0xf1c0c0c0c0c0e3e3ULL,
+        0xf1c0c0c0c0c0c1c1ULL, 0xf180808080808080ULL, 0xf100000000000000ULL, 0xf100000000000000ULL,
+        0xf1f1e0e0e0f0f0ffULL, 0xf1f1e0e0e0f8f8ffULL, 0xf1f1e0e0e0f1f1ffULL, 0xf1f1e0e0e0e3e3ffULL,
+        0xf1f1c0c0c0c1c1ffULL, 0xf1f18080808080ffULL, 0xf1c00000000000c0ULL, 0xf180000000000080ULL,
+        0xf1f1f1f0f0f0ffffULL, 0xf1f1f1f0f8f8ffffULL, 0xf1f1f1f1f1f1ffffULL, 0xf1f1f1e1e3e3ffffULL,
+        0xf1f1f1c1c1c1ffffULL, 0xf1f1e0808080e0ffULL, 0xf1c0c0000000c0c0ULL, 0xf180800000008080ULL,
+        0xf1f1f0f0f0f1ffffULL, 0xf1f1f0f8f8ffffffULL, 0xf1f1f1f1f1ffffffULL, 0xf1f1e1e3e3ffffffULL,
+        0xf1f1c1c1c1f1ffffULL, 0xf1f1808080e0e0ffULL, 0xf1c0000000c0c0c0ULL, 0xf180000000808080ULL,
+        0xf1f0f0f0f1f0ffffULL, 0xfff8f8f8faf8ffffULL, 0xfff1f1f1f5f1ffffULL, 0xffe3e3e3ebe3ffffULL,
+        0xf1c1c1c1d1c1ffffULL, 0xf1818080a080e0ffULL, 0xf10000004000c0c0ULL, 0xf100000080008080ULL,
+        0xf0f0f0f0f0f0f0ffULL, 0xf8f8f0f0f0f0f0ffULL, 0x0000000000000000ULL, 0xe3e3e1e1e1e1e1ffULL,
+        0xc1c1c1c1c1c1c1ffULL, 0x81818080808080ffULL, 0x11000000000000c0ULL, 0x3100000000000080ULL,
+        0xf0f0e0e0e0e0e0e0ULL, 0xf8f0e0e0e0e0e0e0ULL, 0xf1f1e0e0e0e0e0e0ULL, 0xe3c1c0c0c0c0c0c0ULL,
+        0xc1c1c0c0c0c0c0c0ULL, 0x8181808080808080ULL, 0x1100000000000000ULL, 0x3100000000000000ULL,
+        0xe3000000000000c0ULL, 0xe3000000000000e0ULL, 0xe3000000000000f1ULL, 0xe3000000000000e3ULL,
+        0xe3000000000000c7ULL, 0xe300000000000083ULL, 0xe300000000000001ULL, 0xe300000000000000ULL,
+        0xe38080808080c0c0ULL, 0xe38080808080e0e0ULL, 0xe38080808080f1f1ULL, 0xe38080808080e3e3ULL,
+        0xe38080808080c7c7ULL, 0xe380808080808383ULL, 0xe300000000000101ULL, 0xe300000000000000ULL,
+        0xe3e3c0c0c0c0c0ffULL, 0xe3e3c0c0c0e0e0ffULL, 0xe3e3c1c1c1f1f1ffULL, 0xe3e3c1c1c1e3e3ffULL,
+        0xe3e3c1c1c1c7c7ffULL, 0xe3e38181818383ffULL, 0xe3e30101010101ffULL, 0xe380000000000080ULL,
+        0xe3e3c1c0c0c0c1ffULL, 0xe3e3e3e0e0e0ffffULL, 0xe3e3e3e1f1f1ffffULL, 0xe3e3e3e3e3e3ffffULL,
+        0xe3e3e3c3c7c7ffffULL, 0xe3e3e3838383ffffULL, 0xe3e3c1010101c1ffULL, 0xe380800000008080ULL,
+        0xe3e3c0c0c0c1c1ffULL, 0xe3e3e0e0e0e3ffffULL, 0xe3e3e1f1f1ffffffULL, 0xe3e3e3e3e3ffffffULL,
+        0xe3e3c3c7c7ffffffULL, 0xe3e3838383e3ffffULL, 0xe3e3010101c1c1ffULL, 0xe380000000808080ULL,
+        0xe3e0c0c0c1c0c1ffULL, 0xe3e0e0e0e2e0ffffULL, 0xfff1f1f1f5f1ffffULL, 0xffe3e3e3ebe3ffffULL,
+        0xffc7c7c7d7c7ffffULL, 0xe3838383a383ffffULL, 0xe30301014101c1ffULL, 0xe300000080008080ULL,
+        0xe0e0c0c0c0c0c0ffULL, 0xe0e0e0e0e0e0e0ffULL, 0xf1f1e1e1e1e1e1ffULL, 0x0000000000000000ULL,
+        0xc7c7c3c3c3c3c3ffULL, 0x83838383838383ffULL, 0x03030101010101ffULL, 0x2300000000000080ULL,
+        0xe0e0c0c0c0c0c0c0ULL, 0xe0e0c0c0c0c0c0c0ULL, 0xf1e0c0c0c0c0c0c0ULL, 0xe3e3c1c1c1c1c1c1ULL,
+        0xc783818181818181ULL, 0x8383818181818181ULL, 0x0303010101010101ULL, 0x2300000000000000ULL,
+    };
+}
+
+#endif
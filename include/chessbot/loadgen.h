@@ -0,0 +1,47 @@
+#ifndef LOADGEN_H
+#define LOADGEN_H
+
+#include <iostream>
+#include <string>
+
+#include "stats.h"
+#include "types.h"
+
+// Load generator for CEngineService
+// Each client opens its own session and plays games from the bench positions against itself,
+// sending the whole game with every request as a UCI front end would
+namespace LoadGen {
+    struct LoadConfig {
+        std::string socketPath;
+        int clients = 8;
+
+        // Requests per client
+        int requests = 50;
+
+        // Budget of each request, nodes if non-zero, otherwise movetime in milliseconds
+        U64 nodes = 20000;
+        long long movetime = 0;
+
+        // A client starts the next position once a game reaches this many moves or ends
+        int maxPlies = 80;
+    };
+
+    struct LoadReport {
+        // Time from sending each request to reading its bestmove, as seen by the clients
+        LatencyHistogram latency;
+
+        U64 requests = 0;
+
+        // Requests which failed, including every request of a client which could not connect
+        U64 errors = 0;
+        double seconds = 0.0;
+
+        double requestsPerSecond() const;
+    };
+
+    LoadReport run(const LoadConfig &config);
+
+    void print(const LoadReport &report, std::ostream &out);
+}
+
+#endif
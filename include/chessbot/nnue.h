@@ -0,0 +1,58 @@
+#ifndef NNUE_H
+#define NNUE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "CBoard.h"
+#include "CTrainingData.h"
+#include "types.h"
+
+// Input features for training NNUE networks
+// A perspective sees the board from its own side, squares are flipped for Black and "own" pieces are its colour
+namespace Nnue {
+    enum enumFeatureSet {
+        // King square x piece (pawn to queen, own then theirs) x square
+        halfKP,
+
+        // As halfKP with both kings included as pieces
+        halfKA
+    };
+
+    constexpr int HALFKP_FEATURES = 64 * 10 * 64;
+    constexpr int HALFKA_FEATURES = 64 * 12 * 64;
+
+    // Every row of features is this long, rows with fewer active features are padded with -1
+    constexpr int MAX_ACTIVE = 32;
+
+    int featureCount(enumFeatureSet set);
+
+    // Writes the active features of one perspective, returns how many
+    // Returns -1 without writing any when the board has more than MAX_ACTIVE of them or not exactly one king a side
+    int activeFeatures(const std::array<U64, 8> &pieceBB, enumColour perspective, enumFeatureSet set, int32_t *features);
+
+    // Caller-owned output of a batch, each array holds count rows
+    // Feature arrays are count * MAX_ACTIVE long, targets may be null when not wanted
+    struct FeatureBatch {
+        int32_t *white = nullptr;
+        int32_t *black = nullptr;
+        uint8_t *sideToMove = nullptr;
+
+        // Centipawns from the side to move's point of view
+        float *score = nullptr;
+
+        // 1 win, 0.5 draw, 0 loss for the side to move
+        float *result = nullptr;
+    };
+
+    // Fills rows 0 to count of batch straight from the entries, without allocating per position
+    // Positions activeFeatures rejects, or entries which do not unpack, get rows of -1 for both perspectives
+    // Returns how many positions were rejected
+    std::size_t extract(const TrainingEntry *entries, std::size_t count, enumFeatureSet set, const FeatureBatch &batch, int threads = 1);
+
+    // As above from boards, which have no targets, so score and result are left alone
+    std::size_t extract(const CBoard *boards, std::size_t count, enumFeatureSet set, const FeatureBatch &batch, int threads = 1);
+}
+
+#endif
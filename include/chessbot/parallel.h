@@ -0,0 +1,34 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+    // Runs fill(begin, end) over count items in contiguous slices, one per thread, the first on the caller
+    // Uses fewer threads when a slice would have less than minPerThread items, the right number depends on
+    // how long an item takes against the cost of starting a thread, so each caller picks its own
+    template <typename Fill>
+    void forSlices(std::size_t count, int threads, std::size_t minPerThread, Fill fill) {
+        std::size_t useful = std::max<std::size_t>(1, count / minPerThread);
+        threads = static_cast<int>(std::clamp<std::size_t>(threads, 1, useful));
+
+        if (threads == 1) {
+            fill(std::size_t(0), count);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+
+        for (int t = 1; t < threads; ++t) {
+            workers.emplace_back([&, t]() { fill(count * t / threads, count * (t + 1) / threads); });
+        }
+
+        fill(std::size_t(0), count / threads);
+        for (auto &worker : workers) worker.join();
+    }
+}
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef PGN_H
+#define PGN_H
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "CBoard.h"
+#include "CMove.h"
+
+// Portable Game Notation, see CPgnReader for reading whole files
+namespace Pgn {
+    // Tag pairs in the order they are written, e.g. { "Event", "Casual game" }
+    using Tags = std::vector<std::pair<std::string, std::string>>;
+
+    extern const std::string START_FEN;
+
+    // Standard algebraic notation as strings, e.g. Nbd7, exd8=Q+ or O-O, see CMove::fromSan and CMove::toSan
+    // Throws std::invalid_argument if no move or more than one move matches
+    CMove parseSan(const CBoard &board, std::string_view san);
+    std::string moveToSan(CBoard *board, CMove move);
+
+    // Resolves the moves of a game's movetext starting from board, which is left at the final position
+    // Move numbers, comments, NAGs and variations are skipped, reading stops at the result
+    // Throws std::invalid_argument at the first move which cannot be resolved
+    void parseMovetext(std::string_view movetext, CBoard *board, std::vector<CMove> *moves);
+
+    // Appends a game in export format to out, the result comes from the Result tag or is "*"
+    // board holds the starting position and is returned to it
+    void writeGame(const Tags &tags, const std::vector<CMove> &moves, CBoard *board, std::string *out);
+}
+
+#endif
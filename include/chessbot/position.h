@@ -0,0 +1,68 @@
+#ifndef POSITION_H
+#define POSITION_H
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "CBoard.h"
+#include "CMove.h"
+#include "enums.h"
+#include "types.h"
+
+// Lightweight board for copy-make
+// Holds only what a move changes, so it is trivially copyable and fits in two cache lines
+// Instead of unmaking a move, a copy is taken before making it, which suits parallel search and perft
+// where every thread needs its own board. Attacks come from CBoard's shared movesets, a board has to be
+// constructed first, which the constructor from CBoard guarantees
+// There is no move history, so repetitions are not detected
+struct alignas(64) Position {
+    // Indexed by enumPiece as in CBoard
+    std::array<U64, 8> pieceBB;
+
+    // Zobrist key, identical to CBoard::getKey for the same position
+    U64 key;
+
+    uint16_t halfmoves;
+    uint16_t fullmoves;
+
+    // enumColour
+    uint8_t sideToMove;
+
+    // Castling rights as in CBoard, KQkq from the most significant bit
+    uint8_t castling;
+
+    // enumSquare, no_sq when there is no en passant target
+    uint8_t enPassant;
+
+    Position() = default;
+    explicit Position(const CBoard &board);
+
+    // The move is assumed to be pseudo-legal, copy the position first to be able to go back
+    void makeMove(CMove move);
+
+    // generateMoves is pseudo-legal, isLegal makes the move on a copy and checks the king
+    void generateMoves(std::vector<CMove> *moves) const;
+    void generateLegalMoves(std::vector<CMove> *moves) const;
+    bool isLegal(CMove move) const;
+
+    bool isSquareAttacked(enumSquare square, enumColour byColour) const;
+    bool isInCheck() const;
+
+    U64 getOccupiedSquares() const;
+    U64 getPieceSet(enumPiece piece, enumPiece colour) const;
+
+    // nWhite if the square is empty
+    enumPiece pieceTypeOn(enumSquare square) const;
+
+    U64 perft(int depth) const;
+
+    // Splits the root moves between threads, each searching its own copies
+    U64 perftParallel(int depth, int threads) const;
+};
+
+static_assert(std::is_trivially_copyable_v<Position>);
+static_assert(sizeof(Position) <= 128);
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// Per-phase cycle counting, compiled in only when CHESSBOT_PROFILE is defined (the CHESSBOT_PROFILE CMake option)
+// PROFILE_SCOPE(phase) charges the cycles spent until the end of the enclosing scope to phase
+// Scopes nest, a phase's exclusive cycles leave out the time spent in the scopes inside it
+// Counters are thread local, report and writeChromeTrace should only be called while no search is running
+namespace Profile {
+    enum Phase {
+        search,
+        moveGen,
+        makeMove,
+        unmakeMove,
+        legality,
+        attacks,
+        eval,
+        ttProbe,
+        ttStore,
+        numPhases
+    };
+
+    constexpr std::array<const char *, numPhases> PHASE_NAMES = {
+        "search", "movegen", "make", "unmake", "legality", "attacks", "eval", "tt_probe", "tt_store"
+    };
+
+    // Time stamp counter where available, nanoseconds otherwise
+    inline uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    void enter();
+    void leave(Phase phase, uint64_t start, uint64_t end);
+
+    // Zeroes the counters of every thread and drops recorded trace events
+    void reset();
+
+    // Records up to maxEvents scopes per thread for writeChromeTrace, until stopTrace is called
+    void startTrace(std::size_t maxEvents = 1 << 20);
+    void stopTrace();
+
+    // Table of calls, inclusive and exclusive cycles per phase, summed over all threads
+    void report(std::ostream &out);
+
+    // Trace Event Format JSON, can be opened in chrome://tracing or ui.perfetto.dev
+    bool writeChromeTrace(const std::string &path);
+
+    class Scope {
+        public:
+            Scope(Phase phase) : phase_(phase) {
+                Profile::enter();
+                start_ = Profile::now();
+            }
+
+            ~Scope() {
+                Profile::leave(phase_, start_, Profile::now());
+            }
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+        private:
+            Phase phase_;
+            uint64_t start_;
+    };
+
+    constexpr bool enabled() {
+#ifdef CHESSBOT_PROFILE
+        return true;
+#else
+        return false;
+#endif
+    }
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef CHESSBOT_PROFILE
+#define PROFILE_SCOPE(phase) Profile::Scope PROFILE_CONCAT(profileScope, __LINE__)(Profile::phase)
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cstdint>
+#include <cstring>
+
+// Portable SIMD through the compiler's vector extensions: 128 bits for the baseline SSE2 and NEON registers,
+// 256 when built for AVX (see CHESSBOT_NATIVE)
+namespace Simd {
+#ifdef __AVX__
+    constexpr int VECTOR_BYTES = 32;
+#else
+    constexpr int VECTOR_BYTES = 16;
+#endif
+
+    typedef float FloatVector __attribute__((vector_size(VECTOR_BYTES)));
+    typedef int32_t Int32Vector __attribute__((vector_size(VECTOR_BYTES)));
+    typedef int16_t Int16Vector __attribute__((vector_size(VECTOR_BYTES)));
+
+    constexpr int FLOAT_LANES = VECTOR_BYTES / sizeof(float);
+    constexpr int INT16_LANES = VECTOR_BYTES / sizeof(int16_t);
+
+    // Unaligned, the arrays these read and write are not padded to a vector
+    template <typename Vector, typename T>
+    inline Vector loadVector(const T *values) {
+        Vector vector;
+        std::memcpy(&vector, values, sizeof(Vector));
+        return vector;
+    }
+
+    template <typename Vector, typename T>
+    inline void storeVector(T *values, Vector vector) {
+        std::memcpy(values, &vector, sizeof(Vector));
+    }
+
+    // e^x in every lane, within 4 parts in 10^6 of std::exp for x from -87 to 87, beyond which it clamps
+    // 2^(x log2 e) split into a power of two put straight into the exponent bits and a polynomial for what is left
+    inline FloatVector exp(FloatVector x) {
+        // Adding and taking away 1.5 * 2^23 rounds to the nearest integer, it is not folded away without -ffast-math
+        const FloatVector round = FloatVector{} + 12582912.0f;
+
+        FloatVector t = x * 1.44269504f;
+        t = t < -126.0f ? FloatVector{} - 126.0f : t;
+        t = t > 126.0f ? FloatVector{} + 126.0f : t;
+
+        FloatVector whole = (t + round) - round;
+        FloatVector f = (t - whole) * 0.693147181f;
+
+        // e^f for f within ln 2 / 2 of zero, Taylor to the sixth power
+        FloatVector p = FloatVector{} + 1.0f / 720.0f;
+        p = p * f + 1.0f / 120.0f;
+        p = p * f + 1.0f / 24.0f;
+        p = p * f + 1.0f / 6.0f;
+        p = p * f + 0.5f;
+        p = p * f + 1.0f;
+        p = p * f + 1.0f;
+
+        Int32Vector exponent = __builtin_convertvector(whole, Int32Vector) << 23;
+        return reinterpret_cast<FloatVector>(reinterpret_cast<Int32Vector>(p) + exponent);
+    }
+}
+
+#endif
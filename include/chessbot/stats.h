@@ -0,0 +1,126 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <array>
+#include <string>
+
+#include "profile.h"
+#include "types.h"
+
+// Search statistics
+// Counting is compiled in only when CHESSBOT_STATS is defined (the CHESSBOT_SEARCH_STATS CMake option),
+// otherwise STATS_INC and StatsTimer expand to nothing
+// Each search thread owns its own SearchStats, so counters are plain integers, merge combines them afterwards
+struct SearchStats {
+    U64 nodes = 0;
+    U64 qnodes = 0;
+
+    U64 ttProbes = 0;
+    U64 ttHits = 0;
+
+    // Probes which found the slot taken by a different position
+    U64 ttCollisions = 0;
+
+    U64 betaCutoffs = 0;
+    U64 firstMoveCutoffs = 0;
+
+    U64 nullMoveTries = 0;
+    U64 nullMoveCutoffs = 0;
+
+    U64 lmrReductions = 0;
+    U64 lmrResearches = 0;
+
+    // Tablebase probes inside the tree, hits include the root moves ranked by the tables
+    U64 tbProbes = 0;
+    U64 tbHits = 0;
+
+    // Pieces whose moves were generated, indexed by enumPiece (nWhite and nBlack are unused)
+    std::array<U64, 8> moveGenPieces = {};
+    U64 moveGenCalls = 0;
+    U64 evalCalls = 0;
+
+    // Time stamp counter ticks (nanoseconds where there is none), estimated from a sample of the calls
+    U64 moveGenCycles = 0;
+    U64 evalCycles = 0;
+
+    void clear();
+    void merge(const SearchStats &other);
+
+    double firstMoveCutoffRate() const;
+    double nullMoveSuccessRate() const;
+    double ttHitRate() const;
+
+    // Single line summary for UCI "info string"
+    std::string toInfoString() const;
+    std::string toJson() const;
+
+    static constexpr bool enabled() {
+#ifdef CHESSBOT_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+#ifdef CHESSBOT_STATS
+#define STATS_INC(stats, field) (++(stats).field)
+#define STATS_ADD(stats, field, n) ((stats).field += (n))
+#else
+#define STATS_INC(stats, field) ((void)0)
+#define STATS_ADD(stats, field, n) ((void)0)
+#endif
+
+// Request latencies in microseconds, always compiled in
+// Buckets are log-linear: exact below 16us, then 16 buckets per power of two, so percentiles are within 1/16
+// Like SearchStats it is owned by one thread at a time and merged afterwards
+struct LatencyHistogram {
+    static constexpr int SUB_BUCKETS = 16;
+    static constexpr int BUCKETS = (64 - 3) * SUB_BUCKETS;
+
+    std::array<U64, BUCKETS> counts = {};
+    U64 count = 0;
+    U64 total = 0;
+    U64 max = 0;
+
+    void record(U64 micros);
+    void clear();
+    void merge(const LatencyHistogram &other);
+
+    // Smallest recorded latency, to the bucket's lower bound, which at least the fraction p of requests took no longer than
+    // max is returned exactly for p = 1, 0 if nothing was recorded
+    U64 percentile(double p) const;
+    double mean() const;
+
+    // "count <n> mean <us> p50 <us> p90 <us> p99 <us> p999 <us> max <us>"
+    std::string toString() const;
+
+    static int bucketOf(U64 micros);
+    static U64 lowerBound(int bucket);
+};
+
+// Adds the cycles spent in the scope to a counter
+// Only one call in SAMPLE_RATE is timed and counted SAMPLE_RATE times, reading the counter on every call
+// would cost a noticeable share of a call as short as eval
+class StatsTimer {
+    public:
+        static constexpr U64 SAMPLE_RATE = 64;
+
+#ifdef CHESSBOT_STATS
+        // calls is the number of calls so far, which picks the ones sampled
+        StatsTimer(U64 *counter, U64 calls) : counter_(calls % SAMPLE_RATE == 0 ? counter : nullptr) {
+            if (counter_) start_ = Profile::now();
+        }
+
+        ~StatsTimer() {
+            if (counter_) *counter_ += (Profile::now() - start_) * SAMPLE_RATE;
+        }
+    private:
+        U64 *counter_;
+        U64 start_ = 0;
+#else
+        StatsTimer(U64 *, U64) {}
+#endif
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef TUNER_H
+#define TUNER_H
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CBoard.h"
+#include "types.h"
+
+// Texel tuning of the evaluation weights in eval_weights.h
+// Positions labelled with game results are resolved with a quiescence search, reduced to their features once,
+// then the weights are fitted by gradient descent (Adam) on the error of sigmoid(K * eval) against the results
+namespace Tuner {
+    // Feature index of a piece on a square, enumPiece from nPawn, square from White's point of view
+    constexpr int FEATURES = 6 * 64;
+
+    // Every resolved position as a compact list of features, positions are rows of the arrays
+    // The evaluation is linear in the weights, so this is all the tuner needs to see of a position
+    struct TuningSet {
+        // Features of position i are features[offsets[i]] to features[offsets[i + 1]]
+        std::vector<uint32_t> offsets = { 0 };
+        std::vector<uint16_t> features;
+
+        // +1 for a White piece, -1 for a Black one
+        std::vector<int8_t> signs;
+
+        // Middlegame share of the tapered score, 0 to 1
+        std::vector<float> phases;
+
+        // From White's point of view, 1 win, 0.5 draw, 0 loss
+        std::vector<float> results;
+
+        // Lines which could not be parsed
+        std::size_t malformed = 0;
+
+        std::size_t size() const;
+
+        void add(const CBoard &board, float result);
+        void append(const TuningSet &other);
+    };
+
+    // Weights as the tuner sees them, in centipawns but not rounded
+    struct Weights {
+        std::array<double, 8> materialMg;
+        std::array<double, 8> materialEg;
+        std::array<std::array<double, 64>, 8> pstMg;
+        std::array<std::array<double, 64>, 8> pstEg;
+
+        // The weights in eval_weights.h
+        static Weights current();
+    };
+
+    struct TunerConfig {
+        int epochs = 200;
+        int threads = 1;
+
+        // Adam's step size, in centipawns
+        double learningRate = 1.0;
+
+        // Scale of the sigmoid, fitted to the starting weights if 0
+        double k = 0.0;
+
+        // Epochs between progress lines, 0 for none
+        int reportInterval = 10;
+    };
+
+    struct EpochReport {
+        int epoch;
+        double loss;
+        double positionsPerSecond;
+    };
+
+    // Reads "<fen> <result>" lines, the result as 1-0, 0-1 or 1/2-1/2 (optionally quoted) or a number in brackets
+    // Each position is resolved to the quiet position at the end of its quiescence search principal variation
+    // Returns false if the file cannot be opened, lines which cannot be parsed are counted as malformed
+    bool loadPositions(const std::string &path, TuningSet *set, int threads = 1);
+
+    // The parsed result of a labelled line, false if it has none
+    bool parseLabel(const std::string &line, std::string *fen, float *result);
+
+    // Resolved sets in a binary format, so a large set is only parsed and resolved once
+    bool saveBinary(const std::string &path, const TuningSet &set);
+    bool loadBinary(const std::string &path, TuningSet *set);
+
+    // Evaluation of a position of the set from White's point of view
+    double evaluate(const TuningSet &set, std::size_t position, const Weights &weights);
+
+    // Mean squared error of the predicted results, gradient is the derivative with respect to each weight if given
+    double loss(const TuningSet &set, const Weights &weights, double k, int threads = 1, Weights *gradient = nullptr);
+
+    // Scale of the sigmoid which fits the weights best
+    double fitK(const TuningSet &set, const Weights &weights, int threads = 1);
+
+    // Tunes weights in place, returns one report per epoch
+    std::vector<EpochReport> tune(const TuningSet &set, Weights *weights, const TunerConfig &config, std::ostream &out);
+
+    // Writes the weights, rounded, as a replacement for eval_weights.h
+    void writeWeights(const Weights &weights, std::ostream &out);
+}
+
+#endif
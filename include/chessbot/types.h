@@ -8,6 +8,5 @@
 
 typedef unsigned long long U64;
 typedef std::array<U64, 64> Movesets;
-typedef std::vector<enumSquare> BlockerVector;
 
 #endif
@@ -0,0 +1,39 @@
+#ifndef UCI_H
+#define UCI_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CBoard.h"
+#include "CMove.h"
+#include "CSearch.h"
+
+// Universal Chess Interface front end
+namespace Uci {
+    // Coordinate notation, e.g. e2e4 or e7e8q, "0000" for CMove()
+    std::string moveToString(CMove move);
+
+    // Finds the legal move matching a move in coordinate notation
+    // Throws std::invalid_argument if there is none
+    CMove parseMove(const CBoard &board, const std::string &move);
+
+    // "cp <centipawns>" or "mate <moves>", negative when the side to move is being mated
+    std::string scoreToString(int score);
+
+    // Arguments of "position", i.e. [startpos | fen <fen>] [moves <move>...], leaving board at the final position
+    // The starting FEN and the moves are also returned through fen and moves if given
+    // Throws std::invalid_argument if the position or a move is invalid
+    void setPosition(std::istream &in, CBoard *board, std::string *fen = nullptr, std::vector<CMove> *moves = nullptr);
+
+    // Value of a spin option clamped to its range, false if it is not a whole number
+    bool parseSpin(const std::string &value, int min, int max, int *result);
+
+    // Arguments of "go", anything not given is left at the SearchLimits default
+    SearchLimits parseLimits(std::istream &in);
+
+    // Reads commands until "quit" or the end of the input
+    void loop(std::istream &in, std::ostream &out);
+}
+
+#endif
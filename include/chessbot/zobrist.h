@@ -0,0 +1,87 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <array>
+#include <cstdint>
+
+#include "enums.h"
+#include "types.h"
+
+// Zobrist hashing keys
+// The keys are generated at compile time from a fixed seed so hashes are identical across builds
+namespace Zobrist {
+    struct Keys {
+        // Indexed by mailbox piece code (see Constants::PIECE_TYPE_MASK), then square
+        std::array<std::array<U64, 64>, 16> pieceSquare;
+
+        // Indexed by the 4 bit castling state
+        std::array<U64, 16> castling;
+
+        // Indexed by the file of the en passant target square
+        std::array<U64, 8> enPassant;
+
+        U64 side;
+    };
+
+    // xorshift64*, small enough to be evaluated at compile time
+    constexpr U64 nextRandom(U64 &state) {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 2685821657736338717ULL;
+    }
+
+    constexpr Keys KEYS = [] {
+        Keys keys = {};
+        U64 state = 1070372ULL;
+
+        for (auto &squares : keys.pieceSquare) {
+            for (auto &key : squares) key = nextRandom(state);
+        }
+
+        for (auto &key : keys.castling) key = nextRandom(state);
+        for (auto &key : keys.enPassant) key = nextRandom(state);
+        keys.side = nextRandom(state);
+
+        return keys;
+    }();
+
+    // Changes whenever any key does, so hashes saved by one build can be checked by another
+    constexpr U64 FINGERPRINT = [] {
+        U64 fingerprint = 0;
+        auto mix = [&](U64 key) { fingerprint = (fingerprint ^ key) * 0x100000001B3ULL; };
+
+        for (const auto &squares : KEYS.pieceSquare) {
+            for (U64 key : squares) mix(key);
+        }
+
+        for (U64 key : KEYS.castling) mix(key);
+        for (U64 key : KEYS.enPassant) mix(key);
+        mix(KEYS.side);
+
+        return fingerprint;
+    }();
+
+    constexpr U64 piece(uint8_t piece, enumSquare square) {
+        return KEYS.pieceSquare[piece][square];
+    }
+
+    constexpr U64 castling(int castling) {
+        return KEYS.castling[castling];
+    }
+
+    constexpr U64 enPassant(enumSquare square) {
+        return KEYS.enPassant[square % 8];
+    }
+
+    constexpr U64 side() {
+        return KEYS.side;
+    }
+
+    // Cuckoo tables of every reversible (non-pawn) move, keyed by the hash difference the move makes
+    // See Marcel van Kervinck, "Cuckoo tables for detecting upcoming repetitions"
+    // Returns true and sets from/to if moveKey matches a move in the table
+    bool findCuckooMove(U64 moveKey, enumSquare *from, enumSquare *to);
+}
+
+#endif
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+#include "chessbot/bench.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CParallelSearch.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+
+// Openings, middlegames and endgames, including positions with no legal moves
+const std::array<std::string, 50> Bench::POSITIONS = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 10",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 11",
+    "4rrk1/pp1n3p/3q2pQ/2p1pb2/2PP4/2P3N1/P2B2PP/4RRK1 b - - 7 19",
+    "rq3rk1/ppp2ppp/1bnpb3/3N2B1/3NP3/7P/PPPQ1PP1/2KR3R w - - 7 14",
+    "r1bq1r1k/1pp1n1pp/1p1p4/4p2Q/4Pp2/1BNP4/PPP2PPP/3R1RK1 w - - 2 14",
+    "r3r1k1/2p2ppp/p1p1bn2/8/1q2P3/2NPQN2/PPP3PP/R4RK1 b - - 2 15",
+    "r1bbk1nr/pp3p1p/2n5/1N4p1/2Np1B2/8/PPP2PPP/2KR1B1R w kq - 0 13",
+    "r1bq1rk1/ppp1nppp/4n3/3p3Q/3P4/1BP1B3/PP1N2PP/R4RK1 w - - 1 16",
+    "4r1k1/r1q2ppp/ppp2n2/4P3/5Rb1/1N1BQ3/PPP3PP/R5K1 w - - 1 17",
+    "2rqkb1r/ppp2p2/2npb1p1/1N1Nn2p/2P1PP2/8/PP2B1PP/R1BQK2R b KQ - 0 11",
+    "r1bq1r1k/b1p1npp1/p2p3p/1p6/3PP3/1B2NN2/PP3PPP/R2Q1RK1 w - - 1 16",
+    "3r1rk1/p5pp/bpp1pp2/8/q1PP1P2/b3P3/P2NQRPP/1R2B1K1 b - - 6 22",
+    "r1q2rk1/2p1bppp/2Pp4/p6b/Q1PNp3/4B3/PP1R1PPP/2K4R w - - 2 18",
+    "4k2r/1pb2ppp/1p2p3/1R1p4/3P4/2r1PN2/P4PPP/1R4K1 b - - 3 22",
+    "3q2k1/pb3p1p/4pbp1/2r5/PpN2N2/1P2P2P/5PP1/Q2R2K1 b - - 4 26",
+    "6k1/6p1/6Pp/ppp5/3pn2P/1P3K2/1PP2P2/8 b - - 3 54",
+    "3b4/5kp1/1p1p1p1p/pP1PpP1P/P1P1P3/3KN3/8/8 w - - 0 1",
+    "2K5/p7/7P/5pR1/8/5k2/r7/8 w - - 0 1",
+    "8/6pk/1p6/8/PP3p1p/5P2/4KP1q/3Q4 w - - 0 1",
+    "7k/3p2pp/4q3/8/4Q3/5Kp1/P6b/8 w - - 0 1",
+    "8/2p5/8/2kPKp1p/2p4P/2P5/3P4/8 w - - 0 1",
+    "8/1p3pp1/7p/5P1P/2k3P1/8/2K2P2/8 w - - 0 1",
+    "8/pp2r1k1/2p1p3/3pP2p/1P1P1P1P/P5KR/8/8 w - - 0 1",
+    "8/3p4/p1bk3p/Pp6/1Kp1PpPp/2P2P1P/2P5/5B2 b - - 0 1",
+    "5k2/7R/4P2p/5K2/p1r2P1p/8/8/8 b - - 0 1",
+    "6k1/6p1/P6p/r1N5/5p2/7P/1b3PP1/4R1K1 w - - 0 1",
+    "1r3k2/4q3/2Pp3b/3Bp3/2Q2p2/1p1P2P1/1P2KP2/3N4 w - - 0 1",
+    "6k1/4pp1p/3p2p1/P1pPb3/R7/1r2P1PP/3B1P2/6K1 w - - 0 1",
+    "8/3p3B/5p2/5P2/p7/PP5b/k7/6K1 w - - 0 1",
+    "5rk1/q6p/2p3bR/1pPp1rP1/1P1Pp3/P3B1Q1/1K3P2/R7 w - - 93 90",
+    "4rrk1/1p1nq3/p7/2p1P1pp/3P2bp/3Q1Bn1/PPPB4/1K2R1NR w - - 40 21",
+    "r3k2r/3nnpbp/q2pp1p1/p7/Pp1PPPP1/4BNN1/1P5P/R2Q1RK1 w kq - 0 16",
+    "3Qb1k1/1r2ppb1/pN1n2q1/Pp1Pp1Pr/4P2p/4BP2/4B1R1/1R5K b - - 11 40",
+    "4k3/3q1r2/1N2r1b1/3ppN2/2nPP3/1B1R2n1/2R1Q3/3K4 w - - 5 1",
+    "8/8/8/8/5kp1/P7/8/1K1N4 w - - 0 1",
+    "8/8/8/5N2/8/p7/8/2NK3k w - - 0 1",
+    "8/3k4/8/8/8/4B3/4KB2/2B5 w - - 0 1",
+    "8/8/1P6/5pr1/8/4R3/7k/2K5 w - - 0 1",
+    "8/2p4P/8/kr6/6R1/8/8/1K6 w - - 0 1",
+    "8/8/3P3k/8/1p6/8/1P6/1K3n2 b - - 0 1",
+    "8/R7/2q5/8/6k1/8/1P5p/K6R w - - 0 124",
+    "6k1/3b3r/1p1p4/p1n2p2/1PPNpP1q/P3Q1p1/1R1RB1P1/5K2 b - - 0 1",
+    "r2r1n2/pp2bk2/2p1p2p/3q4/3PN1QP/2P3R1/P4PP1/5RK1 w - - 0 1",
+    "8/8/8/8/8/6k1/6p1/6K1 w - - 0 1",
+    "7k/7P/6K1/8/3B4/8/8/8 b - - 0 1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+    "rnbqkb1r/pp1p1ppp/4pn2/2p5/2PP4/2N5/PP2PPPP/R1BQKBNR w KQkq - 0 4",
+    "r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/2N2N2/PPPP1PPP/R1BQK2R w KQkq - 6 5",
+    "8/k7/3p4/p2P1p2/P2P1P2/8/8/K7 w - - 0 1",
+};
+
+U64 Bench::run(int depth, std::ostream &out, SearchStats *stats) {
+    auto tt = std::make_unique<CTranspositionTable>();
+    auto search = std::make_unique<CSearch>(tt.get());
+    CBoard board;
+
+    SearchLimits limits;
+    limits.depth = depth;
+
+    U64 totalNodes = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < Bench::POSITIONS.size(); ++i) {
+        board.setFen(Bench::POSITIONS[i]);
+        tt->clear();
+        search->clearHistory();
+
+        SearchResult result = search->search(board, limits);
+        totalNodes += result.nodes;
+        if (stats) stats->merge(search->getStats());
+
+        out << "Position " << (i + 1) << "/" << Bench::POSITIONS.size() << ": " << result.nodes << " nodes" << std::endl;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    out << "===========================" << std::endl
+        << "Total time (ms) : " << elapsed << std::endl
+        << "Nodes searched  : " << totalNodes << std::endl
+        << "Nodes/second    : " << totalNodes * 1000 / (elapsed > 0 ? elapsed : 1) << std::endl;
+
+    return totalNodes;
+}
+
+std::vector<Bench::TimeToDepth> Bench::timeToDepth(int depth, int positions, const std::vector<int> &threads, std::ostream &out) {
+    auto tt = std::make_unique<CTranspositionTable>();
+    CParallelSearch search(tt.get());
+    CBoard board;
+
+    SearchLimits limits;
+    limits.depth = depth;
+
+    std::vector<Bench::TimeToDepth> runs;
+    positions = std::clamp(positions, 1, static_cast<int>(Bench::POSITIONS.size()));
+
+    // One thread is the same search in either mode, so it is timed once as the baseline for both
+    long long baseline = 0;
+
+    out << "Mode        Threads   Time (ms)   Speedup       Nodes" << std::endl;
+
+    for (bool abdada : { false, true }) {
+        search.setMode(abdada ? enumSmpMode::smpAbdada : enumSmpMode::smpSharedHash);
+
+        for (int count : threads) {
+            if (abdada and count == 1) continue;
+
+            search.setThreads(count);
+
+            Bench::TimeToDepth run = { count, abdada, 0, 0 };
+            auto start = std::chrono::steady_clock::now();
+
+            for (int i = 0; i < positions; ++i) {
+                board.setFen(Bench::POSITIONS[i]);
+                tt->clear();
+                search.clearHistory();
+
+                run.nodes += search.search(board, limits).nodes;
+            }
+
+            run.milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            if (count == 1) baseline = run.milliseconds;
+
+            std::ostringstream speedup;
+            if (baseline > 0) speedup << std::fixed << std::setprecision(2) << static_cast<double>(baseline) / std::max(1LL, run.milliseconds);
+            else speedup << "-";
+
+            out << std::left << std::setw(12) << (abdada ? "abdada" : "shared-hash") << std::right << std::setw(7) << count
+                << std::setw(12) << run.milliseconds << std::setw(10) << speedup.str() << std::setw(12) << run.nodes << std::endl;
+
+            runs.push_back(run);
+        }
+    }
+
+    return runs;
+}
+
+Bench::WarmStart Bench::warmStart(int depth, int positions, const std::string &path, std::ostream &out) {
+    auto tt = std::make_unique<CTranspositionTable>();
+    auto search = std::make_unique<CSearch>(tt.get());
+    CBoard board;
+
+    SearchLimits limits;
+    limits.depth = depth;
+
+    Bench::WarmStart result = { 0, 0, 0, 0, 0, 0 };
+    positions = std::clamp(positions, 1, static_cast<int>(Bench::POSITIONS.size()));
+
+    // The table is kept between positions, as in a session analysing them one after another
+    auto searchAll = [&](long long *milliseconds, U64 *nodes) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < positions; ++i) {
+            board.setFen(Bench::POSITIONS[i]);
+            search->clearHistory();
+            *nodes += search->search(board, limits).nodes;
+        }
+
+        *milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    tt->clear();
+    searchAll(&result.coldMilliseconds, &result.coldNodes);
+
+    if (!tt->saveSnapshot(path, 0, &result.entries)) {
+        out << "Could not write " << path << std::endl;
+        return result;
+    }
+
+    tt->clear();
+    auto start = std::chrono::steady_clock::now();
+    tt->loadSnapshot(path);
+    result.loadMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    searchAll(&result.warmMilliseconds, &result.warmNodes);
+
+    out << "Snapshot entries : " << result.entries << " (loaded in " << result.loadMilliseconds << " ms)" << std::endl
+        << "Cold time (ms)   : " << result.coldMilliseconds << ", " << result.coldNodes << " nodes" << std::endl
+        << "Warm time (ms)   : " << result.warmMilliseconds << ", " << result.warmNodes << " nodes" << std::endl;
+
+    return result;
+}
@@ -0,0 +1,241 @@
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <thread>
+
+#include "chessbot/bitbase.h"
+#include "chessbot/bitboard.h"
+#include "chessbot/kpk_bitbase.h"
+
+enum enumResult : uint8_t {
+    unknown,
+    invalid,
+    draw,
+    win
+};
+
+using Results = std::vector<std::atomic<uint8_t>>;
+
+// Tables a pawn table looks up for its promotions
+struct Promotions {
+    std::vector<U64> queen;
+    std::vector<U64> rook;
+};
+
+static int squareCount(enumPiece piece) {
+    return piece == enumPiece::nPawn ? 24 : 64;
+}
+
+// Squares attacked by the strong side's piece, the weak king is left out of occupied so it cannot hide behind itself
+static U64 pieceAttacks(enumPiece piece, int square, U64 occupied) {
+    auto from = static_cast<enumSquare>(square);
+
+    switch (piece) {
+        case enumPiece::nPawn:
+            return CBoard::pawnAttacks(enumPiece::nWhite, Bitboard::squareBB(from));
+        case enumPiece::nRook:
+            return CBoard::getRookMoveset(from, occupied, 0ULL);
+        default:
+            return CBoard::getQueenMoveset(from, occupied, 0ULL);
+    }
+}
+
+// Result of the position at index given the results known so far, unknown until its successors are known
+// White is the strong side: it wins if any move wins, and Black draws if any move draws
+static enumResult classify(enumPiece piece, std::size_t index, const Results &results, const Promotions *promotions) {
+    int squares = squareCount(piece);
+    int weakKing = index % 64;
+    int strongKing = index / 64 % 64;
+    int pieceIndex = index / (64 * 64) % squares;
+    auto sideToMove = static_cast<enumColour>(index / (64 * 64 * squares));
+    int pieceSquare = piece == enumPiece::nPawn ? (pieceIndex / 4 + 1) * 8 + pieceIndex % 4 : pieceIndex;
+
+    if (strongKing == weakKing or pieceSquare == strongKing or pieceSquare == weakKing) return invalid;
+
+    U64 strongKingBB = Bitboard::squareBB(static_cast<enumSquare>(strongKing));
+    U64 weakKingBB = Bitboard::squareBB(static_cast<enumSquare>(weakKing));
+    U64 pieceBB = Bitboard::squareBB(static_cast<enumSquare>(pieceSquare));
+    U64 attacks = pieceAttacks(piece, pieceSquare, strongKingBB);
+
+    U64 strongKingMoves = CBoard::getKingMoveset(static_cast<enumSquare>(strongKing), 0ULL);
+    U64 weakKingMoves = CBoard::getKingMoveset(static_cast<enumSquare>(weakKing), 0ULL);
+
+    if (strongKingMoves & weakKingBB) return invalid;
+
+    auto result = [&](enumColour side, int king, int weak, int square) {
+        return static_cast<enumResult>(results[Bitbase::index(piece, side, king, weak, square)].load(std::memory_order_relaxed));
+    };
+
+    if (sideToMove == enumColour::black) {
+        bool allWin = true;
+        U64 targets = weakKingMoves & ~strongKingMoves & ~attacks;
+
+        // Mate or stalemate
+        if (!targets) return attacks & weakKingBB ? win : draw;
+
+        for (auto to : Bitboard::squares(targets)) {
+            // King against king
+            if (to == pieceSquare) return draw;
+
+            enumResult next = result(enumColour::white, strongKing, to, pieceSquare);
+            if (next == draw) return draw;
+            allWin &= next == win;
+        }
+
+        return allWin ? win : unknown;
+    }
+
+    // White cannot move with Black in check
+    if (attacks & weakKingBB) return invalid;
+
+    bool allDraw = true;
+    bool moved = false;
+
+    auto see = [&](enumResult next) {
+        moved = true;
+        allDraw &= next == draw;
+        return next == win;
+    };
+
+    for (auto to : Bitboard::squares(strongKingMoves & ~weakKingMoves & ~pieceBB)) {
+        if (see(result(enumColour::black, to, weakKing, pieceSquare))) return win;
+    }
+
+    U64 occupied = strongKingBB | weakKingBB;
+
+    if (piece == enumPiece::nPawn) {
+        int push = pieceSquare - 8;
+
+        if (!Bitboard::testSquare(occupied, static_cast<enumSquare>(push))) {
+            if (push < 8) {
+                // The better of a queen and a rook, the rook avoids stalemates
+                bool queenWins = Bitbase::isWin(promotions->queen, Bitbase::index(enumPiece::nQueen, enumColour::black, strongKing, weakKing, push));
+                bool rookWins = Bitbase::isWin(promotions->rook, Bitbase::index(enumPiece::nRook, enumColour::black, strongKing, weakKing, push));
+                if (see(queenWins or rookWins ? win : draw)) return win;
+            } else {
+                if (see(result(enumColour::black, strongKing, weakKing, push))) return win;
+
+                if (pieceSquare >= 48 and !Bitboard::testSquare(occupied, static_cast<enumSquare>(push - 8))) {
+                    if (see(result(enumColour::black, strongKing, weakKing, push - 8))) return win;
+                }
+            }
+        }
+    } else {
+        for (auto to : Bitboard::squares(pieceAttacks(piece, pieceSquare, occupied) & ~occupied)) {
+            if (see(result(enumColour::black, strongKing, weakKing, to))) return win;
+        }
+    }
+
+    // Stalemate
+    if (!moved) return draw;
+
+    return allDraw ? draw : unknown;
+}
+
+std::size_t Bitbase::index(enumPiece piece, enumColour sideToMove, int strongKing, int weakKing, int pieceSquare) {
+    int squares = squareCount(piece);
+    int pieceIndex = piece == enumPiece::nPawn ? (pieceSquare / 8 - 1) * 4 + pieceSquare % 8 : pieceSquare;
+
+    return ((static_cast<std::size_t>(sideToMove) * squares + pieceIndex) * 64 + strongKing) * 64 + weakKing;
+}
+
+std::vector<U64> Bitbase::generate(enumPiece piece, int threads) {
+    CBoard::initMovesets();
+    Promotions promotions;
+
+    if (piece == enumPiece::nPawn) {
+        promotions.queen = Bitbase::generate(enumPiece::nQueen, threads);
+        promotions.rook = Bitbase::generate(enumPiece::nRook, threads);
+    }
+
+    std::size_t size = piece == enumPiece::nPawn ? KPK_POSITIONS : PIECE_POSITIONS;
+    Results results(size);
+    threads = std::max(1, threads);
+
+    // Passes until nothing changes, results only ever go from unknown to known so the order within a pass does not matter
+    // Positions never resolved can only go round in circles, so they are draws
+    std::atomic<bool> changed = true;
+
+    while (changed) {
+        changed = false;
+        std::vector<std::thread> workers;
+
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                bool sliceChanged = false;
+
+                for (std::size_t i = size * t / threads; i < size * (t + 1) / threads; ++i) {
+                    if (results[i].load(std::memory_order_relaxed) != unknown) continue;
+
+                    enumResult result = classify(piece, i, results, &promotions);
+                    if (result == unknown) continue;
+
+                    results[i].store(result, std::memory_order_relaxed);
+                    sliceChanged = true;
+                }
+
+                if (sliceChanged) changed = true;
+            });
+        }
+
+        for (auto &worker : workers) worker.join();
+    }
+
+    std::vector<U64> table(size / 64, 0ULL);
+    for (std::size_t i = 0; i < size; ++i) {
+        if (results[i].load(std::memory_order_relaxed) == win) table[i / 64] |= 1ULL << (i % 64);
+    }
+
+    return table;
+}
+
+bool Bitbase::isWin(const std::vector<U64> &table, std::size_t index) {
+    return table[index / 64] >> (index % 64) & 1;
+}
+
+bool Bitbase::probeKpk(const CBoard &board, bool *win) {
+    U64 pawns = board.getPieceSet(enumPiece::nPawn);
+    if (Bitboard::popcount(board.getOccupiedSquares()) != 3 or Bitboard::popcount(pawns) != 1) return false;
+
+    auto strong = board.getPieceSet(enumPiece::nPawn, enumPiece::nWhite) ? enumPiece::nWhite : enumPiece::nBlack;
+    auto weak = strong == enumPiece::nWhite ? enumPiece::nBlack : enumPiece::nWhite;
+
+    // Flip the ranks so the pawn is White's, then the files so it is on files a to d
+    int flip = strong == enumPiece::nWhite ? 0 : 56;
+    int pawn = Bitboard::lsb(pawns) ^ flip;
+    if (pawn % 8 > 3) flip ^= 7;
+
+    int strongKing = Bitboard::lsb(board.getPieceSet(enumPiece::nKing, strong)) ^ flip;
+    int weakKing = Bitboard::lsb(board.getPieceSet(enumPiece::nKing, weak)) ^ flip;
+    auto sideToMove = board.getSideToMove() == static_cast<enumColour>(strong) ? enumColour::white : enumColour::black;
+
+    std::size_t index = Bitbase::index(enumPiece::nPawn, sideToMove, strongKing, weakKing, Bitboard::lsb(pawns) ^ flip);
+    *win = KpkBitbase::BITS[index / 64] >> (index % 64) & 1;
+
+    return true;
+}
+
+void Bitbase::writeHeader(const std::vector<U64> &table, std::ostream &out) {
+    out << "#ifndef KPK_BITBASE_H\n"
+        << "#define KPK_BITBASE_H\n"
+        << "\n"
+        << "#include <array>\n"
+        << "\n"
+        << "#include \"types.h\"\n"
+        << "\n"
+        << "// King and pawn against king, one bit per position in the order of Bitbase::index, set where the pawn wins\n"
+        << "// Generated by chessbot_engine bitbase, do not edit\n"
+        << "namespace KpkBitbase {\n"
+        << "    constexpr std::array<U64, " << table.size() << "> BITS = {\n";
+
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        if (i % 4 == 0) out << "       ";
+        out << " 0x" << std::hex << std::setw(16) << std::setfill('0') << table[i] << std::dec << "ULL,";
+        if (i % 4 == 3 or i + 1 == table.size()) out << "\n";
+    }
+
+    out << "    };\n"
+        << "}\n"
+        << "\n"
+        << "#endif\n";
+}
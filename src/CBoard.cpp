@@ -1,9 +1,51 @@
+#include <algorithm>
+#include <cassert>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 
 #include "chessbot/CBoard.h"
+#include "chessbot/bitboard.h"
 #include "chessbot/constants.h"
 #include "chessbot/magics_64.h"
+#include "chessbot/profile.h"
+#include "chessbot/zobrist.h"
+
+// Colour properties known at compile time, White pawns move north towards lower square indices
+template <enumColour Us> constexpr enumPiece COLOUR_SET = Us == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+template <enumColour Us> constexpr enumColour OPPONENT = Us == enumColour::white ? enumColour::black : enumColour::white;
+
+template <enumColour Us> constexpr U64 PROMOTION_RANK = Us == enumColour::white ? Constants::RANK_8 : Constants::RANK_1;
+template <enumColour Us> constexpr U64 DOUBLE_PUSH_RANK = Us == enumColour::white ? Constants::RANK_4 : Constants::RANK_5;
+template <enumColour Us> constexpr U64 EN_PASSANT_RANK = Us == enumColour::white ? Constants::RANK_6 : Constants::RANK_3;
+
+// Offsets from the target square of a pawn move back to its origin
+template <enumColour Us> constexpr int PUSH_OFFSET = Us == enumColour::white ? 8 : -8;
+template <enumColour Us> constexpr int EAST_OFFSET = Us == enumColour::white ? 7 : -9;
+template <enumColour Us> constexpr int WEST_OFFSET = Us == enumColour::white ? 9 : -7;
+
+template <enumColour Us> constexpr U64 shiftForward(U64 bb) {
+    return Us == enumColour::white ? Bitboard::shiftNorth(bb) : Bitboard::shiftSouth(bb);
+}
+
+template <enumColour Us> constexpr U64 shiftBackward(U64 bb) {
+    return Us == enumColour::white ? Bitboard::shiftSouth(bb) : Bitboard::shiftNorth(bb);
+}
+
+template <enumColour Us> constexpr U64 shiftForwardEast(U64 bb) {
+    return Us == enumColour::white ? Bitboard::shiftNorthEast(bb) : Bitboard::shiftSouthEast(bb);
+}
+
+template <enumColour Us> constexpr U64 shiftForwardWest(U64 bb) {
+    return Us == enumColour::white ? Bitboard::shiftNorthWest(bb) : Bitboard::shiftSouthWest(bb);
+}
+
+Movesets CBoard::knightMovesets_;
+Movesets CBoard::kingMovesets_;
+Movesets CBoard::bishopBlockerMasks_;
+Movesets CBoard::rookBlockerMasks_;
+std::array<std::unordered_map<U64, U64>, 64> CBoard::bishopMovesets_;
+std::array<std::unordered_map<U64, U64>, 64> CBoard::rookMovesets_;
 
 CBoard::CBoard()
     try : CBoard::CBoard("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") {
@@ -12,16 +54,27 @@ CBoard::CBoard()
     }
 
 CBoard::CBoard(std::string fen) {
-    // Precompute non-sliding piece movesets
-    CBoard::generateKingMovesets();
-    CBoard::generateKnightMovesets();
+    CBoard::initMovesets();
+    CBoard::parseFen(fen);
+}
+
+void CBoard::initMovesets() {
+    static std::once_flag movesetsGenerated;
+
+    std::call_once(movesetsGenerated, []() {
+        // Precompute non-sliding piece movesets
+        CBoard::generateKingMovesets();
+        CBoard::generateKnightMovesets();
 
-    CBoard::generateBlockerMasks(enumPiece::nBishop);
-    CBoard::generateBlockerMasks(enumPiece::nRook);
+        CBoard::generateBlockerMasks<enumPiece::nBishop>();
+        CBoard::generateBlockerMasks<enumPiece::nRook>();
 
-    CBoard::generateSlidingMovesets(enumPiece::nBishop);
-    CBoard::generateSlidingMovesets(enumPiece::nRook);
+        CBoard::generateSlidingMovesets<enumPiece::nBishop>();
+        CBoard::generateSlidingMovesets<enumPiece::nRook>();
+    });
+}
 
+void CBoard::setFen(std::string fen) {
     CBoard::parseFen(fen);
 }
 
@@ -46,7 +99,11 @@ void CBoard::parseFen(std::string fen) {
     int currField = 0;
 
     for (int i = 0; i < 8; ++i) pieceBB_[i] = 0ULL;
+    mailbox_.fill(Constants::NO_PIECE);
+    history_.clear();
+    key_ = 0ULL;
 
+    sideToMove_ = enumColour::white;
     castling_ = 0;
     enPassant_ = enumSquare::no_sq;
     halfmoves_ = 0;
@@ -77,8 +134,10 @@ void CBoard::parseFen(std::string fen) {
                 castling_ = 0;
 
                 for (std::size_t i = 0; i < field.size(); ++i) {
-                    if (Constants::CASTLE_STRING_TO_INT_MAP.contains(field[i])) {
-                        castling_ |= Constants::CASTLE_STRING_TO_INT_MAP.at(field[i]);
+                    int rights = static_cast<unsigned char>(field[i]) < 128 ? Constants::CASTLE_CHAR_TO_RIGHTS[field[i]] : 0;
+
+                    if (rights) {
+                        castling_ |= rights;
                     } else if (field[i] == '-') {
                         continue;
                     } else {
@@ -90,11 +149,8 @@ void CBoard::parseFen(std::string fen) {
             case 3:
                 // En Passant
                 if (field != "-") {
-                    try {
-                        enPassant_ = Constants::SQUARE_STRING_TO_ENUM_MAP.at(field);
-                    } catch (std::out_of_range& e) {
-                        throw std::invalid_argument("Invalid FEN string");
-                    }
+                    enPassant_ = Constants::squareFromString(field);
+                    if (enPassant_ == enumSquare::no_sq) throw std::invalid_argument("Invalid FEN string");
                 }
 
                 break;
@@ -129,6 +185,8 @@ void CBoard::parseFen(std::string fen) {
         ++currField;
     }
 
+    key_ = CBoard::computeKey();
+    CBoard::updateCheckInfo();
 }
 
 void CBoard::parseFENPieces(std::string fen) {
@@ -145,15 +203,11 @@ void CBoard::parseFENPieces(std::string fen) {
                 currFile += fenChar - '0';
             } else if (std::isalpha(fenChar)) {
                 auto currSquare = getSquareFromCoords(currRank, currFile);
-                char fenCharLower = tolower(fenChar);
+                enumPiece piece = Constants::PIECE_CHAR_TO_ENUM[tolower(fenChar)];
 
-                try {
-                    CBoard::setSquare(Constants::PIECE_TO_ENUM_MAP.at(fenCharLower), currSquare);
-                } catch (std::out_of_range& e) {
-                    throw std::invalid_argument("Invalid FEN string");
-                } catch(std::invalid_argument& e) {
-                    throw e;
-                }
+                if (piece == enumPiece::nWhite) throw std::invalid_argument("Invalid FEN string");
+
+                CBoard::setSquare(piece, currSquare);
 
                 if (fenChar >= 'A' and fenChar <= 'Z') {
                     CBoard::setSquare(enumPiece::nWhite, currSquare);
@@ -190,6 +244,529 @@ void CBoard::changeTurn() {
     ++halfmoves_;
 }
 
+void CBoard::makeMove(CMove move) {
+    PROFILE_SCOPE(makeMove);
+
+    auto from = static_cast<enumSquare>(move.getFrom());
+    auto to = static_cast<enumSquare>(move.getTo());
+    unsigned int flags = move.getFlags();
+
+    auto us = sideToMove_ == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+    enumPiece moving = CBoard::pieceTypeOn(from);
+
+    history_.push_back({ Constants::NO_PIECE, castling_, enPassant_, halfmoves_, key_, checkInfo_ });
+    BoardState &state = history_.back();
+
+    if (flags == Constants::EP_CAPTURE_FLAG) {
+        // The captured pawn sits behind the target square
+        auto captureSquare = static_cast<enumSquare>(us == enumPiece::nWhite ? to + 8 : to - 8);
+        state.captured = mailbox_[captureSquare];
+        CBoard::removePiece(captureSquare);
+    } else if (move.isCapture()) {
+        state.captured = mailbox_[to];
+        CBoard::removePiece(to);
+    }
+
+    CBoard::movePiece(from, to);
+
+    if (flags & Constants::PROMO_FLAG_MASK) {
+        CBoard::removePiece(to);
+        CBoard::putPiece(us, Constants::PROMOTION_PIECES[flags & 3], to);
+    } else if (flags == Constants::KING_CASTLE_FLAG) {
+        CBoard::movePiece(static_cast<enumSquare>(to + 1), static_cast<enumSquare>(to - 1));
+    } else if (flags == Constants::QUEEN_CASTLE_FLAG) {
+        CBoard::movePiece(static_cast<enumSquare>(to - 2), static_cast<enumSquare>(to + 1));
+    }
+
+    if (enPassant_ != enumSquare::no_sq) key_ ^= Zobrist::enPassant(enPassant_);
+    enPassant_ = enumSquare::no_sq;
+
+    // Only record the en passant square when an enemy pawn is next to the pushed pawn,
+    // otherwise transpositions to the same position would hash differently
+    if (flags == Constants::DOUBLE_PAWN_PUSH_FLAG) {
+        U64 toBB = Bitboard::squareBB(to);
+        auto them = us == enumPiece::nWhite ? enumPiece::nBlack : enumPiece::nWhite;
+
+        if ((Bitboard::shiftEast(toBB) | Bitboard::shiftWest(toBB)) & CBoard::getPieceSet(enumPiece::nPawn, them)) {
+            enPassant_ = static_cast<enumSquare>((from + to) / 2);
+            key_ ^= Zobrist::enPassant(enPassant_);
+        }
+    }
+
+    key_ ^= Zobrist::castling(castling_);
+    castling_ &= ~(Constants::CASTLING_RIGHTS_LOST[from] | Constants::CASTLING_RIGHTS_LOST[to]);
+    key_ ^= Zobrist::castling(castling_);
+
+    if (moving == enumPiece::nPawn or move.isCapture()) {
+        halfmoves_ = 0;
+    } else {
+        ++halfmoves_;
+    }
+
+    if (sideToMove_ == enumColour::black) ++fullmoves_;
+    sideToMove_ = sideToMove_ == enumColour::white ? enumColour::black : enumColour::white;
+    key_ ^= Zobrist::side();
+
+    CBoard::updateCheckInfo();
+
+    assert(CBoard::isConsistent());
+}
+
+void CBoard::unmakeMove(CMove move) {
+    PROFILE_SCOPE(unmakeMove);
+
+    auto from = static_cast<enumSquare>(move.getFrom());
+    auto to = static_cast<enumSquare>(move.getTo());
+    unsigned int flags = move.getFlags();
+
+    BoardState state = history_.back();
+    history_.pop_back();
+
+    sideToMove_ = sideToMove_ == enumColour::white ? enumColour::black : enumColour::white;
+    if (sideToMove_ == enumColour::black) --fullmoves_;
+
+    auto us = sideToMove_ == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+
+    if (flags & Constants::PROMO_FLAG_MASK) {
+        CBoard::removePiece(to);
+        CBoard::putPiece(us, enumPiece::nPawn, to);
+    } else if (flags == Constants::KING_CASTLE_FLAG) {
+        CBoard::movePiece(static_cast<enumSquare>(to - 1), static_cast<enumSquare>(to + 1));
+    } else if (flags == Constants::QUEEN_CASTLE_FLAG) {
+        CBoard::movePiece(static_cast<enumSquare>(to + 1), static_cast<enumSquare>(to - 2));
+    }
+
+    CBoard::movePiece(to, from);
+
+    if (state.captured != Constants::NO_PIECE) {
+        auto captureSquare = to;
+        if (flags == Constants::EP_CAPTURE_FLAG) {
+            captureSquare = static_cast<enumSquare>(us == enumPiece::nWhite ? to + 8 : to - 8);
+        }
+
+        CBoard::putPiece(
+            static_cast<enumPiece>(state.captured >> Constants::PIECE_COLOUR_SHIFT),
+            static_cast<enumPiece>(state.captured & Constants::PIECE_TYPE_MASK),
+            captureSquare
+        );
+    }
+
+    castling_ = state.castling;
+    enPassant_ = state.enPassant;
+    halfmoves_ = state.halfmoves;
+    key_ = state.key;
+    checkInfo_ = state.checkInfo;
+
+    assert(CBoard::isConsistent());
+}
+
+void CBoard::makeNullMove() {
+    history_.push_back({ Constants::NO_PIECE, castling_, enPassant_, halfmoves_, key_, checkInfo_ });
+
+    if (enPassant_ != enumSquare::no_sq) key_ ^= Zobrist::enPassant(enPassant_);
+    enPassant_ = enumSquare::no_sq;
+
+    halfmoves_ = 0;
+
+    sideToMove_ = sideToMove_ == enumColour::white ? enumColour::black : enumColour::white;
+    key_ ^= Zobrist::side();
+
+    CBoard::updateCheckInfo();
+}
+
+void CBoard::unmakeNullMove() {
+    BoardState state = history_.back();
+    history_.pop_back();
+
+    sideToMove_ = sideToMove_ == enumColour::white ? enumColour::black : enumColour::white;
+
+    enPassant_ = state.enPassant;
+    halfmoves_ = state.halfmoves;
+    key_ = state.key;
+    checkInfo_ = state.checkInfo;
+}
+
+bool CBoard::isFiftyMoveDraw() const {
+    return halfmoves_ >= 100;
+}
+
+// Only positions since the last capture or pawn move can repeat, and only every second one
+// has the same side to move, so at most halfmoves_ / 2 keys are compared
+bool CBoard::isRepetition(int ply) const {
+    int size = history_.size();
+    int end = std::min(halfmoves_, size);
+    int count = 0;
+
+    for (int i = 4; i <= end; i += 2) {
+        if (history_[size - i].key != key_) continue;
+
+        if (i < ply or ++count == 2) return true;
+    }
+
+    return false;
+}
+
+bool CBoard::isDraw(int ply) const {
+    return CBoard::isFiftyMoveDraw() or CBoard::isRepetition(ply);
+}
+
+bool CBoard::hasUpcomingRepetition(int ply) const {
+    int size = history_.size();
+    int end = std::min(halfmoves_, size);
+
+    if (end < 3) return false;
+
+    // Key of the position n plies ago
+    auto keyAt = [&](int n) { return n == 0 ? key_ : history_[size - n].key; };
+
+    // other is 0 once the opponent's moves since i plies ago cancel each other out,
+    // the position i plies ago is then one reversible move of ours away
+    U64 other = key_ ^ keyAt(1) ^ Zobrist::side();
+
+    for (int i = 3; i <= end; i += 2) {
+        other ^= keyAt(i - 1) ^ keyAt(i) ^ Zobrist::side();
+
+        if (other != 0) continue;
+
+        enumSquare s1, s2;
+        if (!Zobrist::findCuckooMove(key_ ^ keyAt(i), &s1, &s2)) continue;
+        if (Bitboard::between(s1, s2) & CBoard::getOccupiedSquares()) continue;
+
+        if (i < ply) return true;
+
+        // Before the root the move has to be ours, the table stores both directions of a move
+        enumSquare occupied = mailbox_[s1] == Constants::NO_PIECE ? s2 : s1;
+        auto us = sideToMove_ == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+        if (CBoard::pieceColourOn(occupied) != us) continue;
+
+        // and the position it leads to has to have occurred twice already
+        for (int j = i + 4; j <= end; j += 2) {
+            if (keyAt(j) == keyAt(i)) return true;
+        }
+    }
+
+    return false;
+}
+
+U64 CBoard::pawnAttacks(enumPiece colour, U64 pawns) {
+    if (colour == enumPiece::nWhite) {
+        return Bitboard::shiftNorthEast(pawns) | Bitboard::shiftNorthWest(pawns);
+    } else {
+        return Bitboard::shiftSouthEast(pawns) | Bitboard::shiftSouthWest(pawns);
+    }
+}
+
+// Reverse lookup: a piece on square attacks the same squares that attack it
+U64 CBoard::attackersTo(enumSquare square, U64 occupied) const {
+    PROFILE_SCOPE(attacks);
+
+    U64 squareBB = Bitboard::squareBB(square);
+    U64 queens = pieceBB_[enumPiece::nQueen];
+
+    return (CBoard::pawnAttacks(enumPiece::nBlack, squareBB) & CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nWhite))
+         | (CBoard::pawnAttacks(enumPiece::nWhite, squareBB) & CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nBlack))
+         | (knightMovesets_[square] & pieceBB_[enumPiece::nKnight])
+         | (kingMovesets_[square] & pieceBB_[enumPiece::nKing])
+         | (CBoard::getBishopMoveset(square, occupied, 0ULL) & (pieceBB_[enumPiece::nBishop] | queens))
+         | (CBoard::getRookMoveset(square, occupied, 0ULL) & (pieceBB_[enumPiece::nRook] | queens));
+}
+
+bool CBoard::isSquareAttacked(enumSquare square, enumPiece byColour) const {
+    return CBoard::attackersTo(square, CBoard::getOccupiedSquares()) & pieceBB_[byColour];
+}
+
+bool CBoard::isInCheck() const {
+    return checkInfo_.checkers;
+}
+
+U64 CBoard::getCheckers() const {
+    return checkInfo_.checkers;
+}
+
+U64 CBoard::getPinnedPieces() const {
+    return checkInfo_.pinned;
+}
+
+U64 CBoard::sliderBlockers(enumSquare square, U64 snipers) const {
+    U64 occupied = CBoard::getOccupiedSquares();
+    U64 queens = pieceBB_[enumPiece::nQueen];
+    U64 blockers = 0ULL;
+
+    // Sliders which would attack square on an empty board
+    snipers &= (CBoard::getBishopMoveset(square, 0ULL, 0ULL) & (pieceBB_[enumPiece::nBishop] | queens))
+             | (CBoard::getRookMoveset(square, 0ULL, 0ULL) & (pieceBB_[enumPiece::nRook] | queens));
+
+    for (auto sniper : Bitboard::squares(snipers)) {
+        U64 between = Bitboard::between(square, sniper) & occupied;
+
+        if (between and !Bitboard::moreThanOne(between)) blockers |= between;
+    }
+
+    return blockers;
+}
+
+void CBoard::updateCheckInfo() {
+    PROFILE_SCOPE(attacks);
+
+    auto us = sideToMove_ == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+    auto them = us == enumPiece::nWhite ? enumPiece::nBlack : enumPiece::nWhite;
+    U64 ourKing = CBoard::getPieceSet(enumPiece::nKing, us);
+    U64 theirKing = CBoard::getPieceSet(enumPiece::nKing, them);
+    U64 occupied = CBoard::getOccupiedSquares();
+
+    checkInfo_ = {};
+
+    // Positions set up without kings have nothing to check or pin
+    if (ourKing) {
+        enumSquare kingSquare = Bitboard::lsb(ourKing);
+
+        checkInfo_.checkers = CBoard::attackersTo(kingSquare, occupied) & pieceBB_[them];
+        checkInfo_.pinned = CBoard::sliderBlockers(kingSquare, pieceBB_[them]) & pieceBB_[us];
+    }
+
+    if (theirKing) {
+        enumSquare kingSquare = Bitboard::lsb(theirKing);
+        U64 bishopSquares = CBoard::getBishopMoveset(kingSquare, occupied, 0ULL);
+        U64 rookSquares = CBoard::getRookMoveset(kingSquare, occupied, 0ULL);
+
+        checkInfo_.discoverers = CBoard::sliderBlockers(kingSquare, pieceBB_[us]) & pieceBB_[us];
+
+        checkInfo_.checkSquares[enumPiece::nPawn] = CBoard::pawnAttacks(them, theirKing);
+        checkInfo_.checkSquares[enumPiece::nKnight] = knightMovesets_[kingSquare];
+        checkInfo_.checkSquares[enumPiece::nBishop] = bishopSquares;
+        checkInfo_.checkSquares[enumPiece::nRook] = rookSquares;
+        checkInfo_.checkSquares[enumPiece::nQueen] = bishopSquares | rookSquares;
+    }
+}
+
+bool CBoard::givesCheck(CMove move) const {
+    auto from = static_cast<enumSquare>(move.getFrom());
+    auto to = static_cast<enumSquare>(move.getTo());
+    unsigned int flags = move.getFlags();
+
+    auto us = sideToMove_ == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+    auto them = us == enumPiece::nWhite ? enumPiece::nBlack : enumPiece::nWhite;
+    U64 theirKing = CBoard::getPieceSet(enumPiece::nKing, them);
+
+    if (!theirKing) return false;
+
+    enumSquare kingSquare = Bitboard::lsb(theirKing);
+    U64 occupied = CBoard::getOccupiedSquares() ^ Bitboard::squareBB(from);
+
+    // Direct checks, promotions attack from the target square as the new piece
+    if (flags & Constants::PROMO_FLAG_MASK) {
+        switch (Constants::PROMOTION_PIECES[flags & 3]) {
+            case enumPiece::nKnight:
+                if (knightMovesets_[to] & theirKing) return true;
+                break;
+            case enumPiece::nBishop:
+                if (CBoard::getBishopMoveset(to, occupied, 0ULL) & theirKing) return true;
+                break;
+            case enumPiece::nRook:
+                if (CBoard::getRookMoveset(to, occupied, 0ULL) & theirKing) return true;
+                break;
+            default:
+                if (CBoard::getQueenMoveset(to, occupied, 0ULL) & theirKing) return true;
+                break;
+        }
+    } else if (checkInfo_.checkSquares[CBoard::pieceTypeOn(from)] & Bitboard::squareBB(to)) {
+        return true;
+    }
+
+    // Discovered checks
+    if ((checkInfo_.discoverers & Bitboard::squareBB(from)) and !Bitboard::aligned(kingSquare, from, to)) return true;
+
+    U64 queens = CBoard::getPieceSet(enumPiece::nQueen, us);
+
+    if (flags == Constants::EP_CAPTURE_FLAG) {
+        // Removing the captured pawn can open a line as well
+        auto captureSquare = static_cast<enumSquare>(us == enumPiece::nWhite ? to + 8 : to - 8);
+        occupied ^= Bitboard::squareBB(captureSquare) | Bitboard::squareBB(to);
+
+        return (CBoard::getBishopMoveset(kingSquare, occupied, 0ULL) & (CBoard::getPieceSet(enumPiece::nBishop, us) | queens))
+             | (CBoard::getRookMoveset(kingSquare, occupied, 0ULL) & (CBoard::getPieceSet(enumPiece::nRook, us) | queens));
+    } else if (flags == Constants::KING_CASTLE_FLAG or flags == Constants::QUEEN_CASTLE_FLAG) {
+        bool kingside = flags == Constants::KING_CASTLE_FLAG;
+        auto rookFrom = static_cast<enumSquare>(kingside ? to + 1 : to - 2);
+        auto rookTo = static_cast<enumSquare>(kingside ? to - 1 : to + 1);
+        occupied ^= Bitboard::squareBB(rookFrom) | Bitboard::squareBB(rookTo) | Bitboard::squareBB(to);
+
+        return CBoard::getRookMoveset(rookTo, occupied, 0ULL) & theirKing;
+    }
+
+    return false;
+}
+
+void CBoard::generateMoves(std::vector<CMove> *moves) const {
+    CBoard::generateMoves<genAll>(moves);
+}
+
+template <enumGenType Type>
+void CBoard::generateMoves(std::vector<CMove> *moves) const {
+    PROFILE_SCOPE(moveGen);
+
+    if (sideToMove_ == enumColour::white) {
+        CBoard::generateColourMoves<enumColour::white, Type>(moves);
+    } else {
+        CBoard::generateColourMoves<enumColour::black, Type>(moves);
+    }
+}
+
+template void CBoard::generateMoves<genCaptures>(std::vector<CMove> *moves) const;
+template void CBoard::generateMoves<genQuiets>(std::vector<CMove> *moves) const;
+template void CBoard::generateMoves<genEvasions>(std::vector<CMove> *moves) const;
+template void CBoard::generateMoves<genAll>(std::vector<CMove> *moves) const;
+
+template <enumColour Us, enumGenType Type>
+void CBoard::generateColourMoves(std::vector<CMove> *moves) const {
+    constexpr enumPiece us = COLOUR_SET<Us>;
+    constexpr enumPiece them = COLOUR_SET<OPPONENT<Us>>;
+
+    // Squares the pieces other than the king may move to
+    U64 targets = Type == genCaptures ? pieceBB_[them]
+                : Type == genQuiets ? CBoard::getEmptySquares()
+                : ~pieceBB_[us];
+
+    if constexpr (Type == genEvasions) {
+        U64 checkers = checkInfo_.checkers;
+        assert(checkers);
+
+        // Only the king can escape a double check, otherwise the checker must be captured or blocked
+        if (Bitboard::moreThanOne(checkers)) {
+            CBoard::generatePieceMoves<Us, enumPiece::nKing>(targets, moves);
+            return;
+        }
+
+        enumSquare king = Bitboard::lsb(CBoard::getPieceSet(enumPiece::nKing, us));
+        targets = checkers | Bitboard::between(king, Bitboard::lsb(checkers));
+    }
+
+    CBoard::generatePawnMoves<Us, Type>(targets, moves);
+    CBoard::generatePieceMoves<Us, enumPiece::nKnight>(targets, moves);
+    CBoard::generatePieceMoves<Us, enumPiece::nBishop>(targets, moves);
+    CBoard::generatePieceMoves<Us, enumPiece::nRook>(targets, moves);
+    CBoard::generatePieceMoves<Us, enumPiece::nQueen>(targets, moves);
+    CBoard::generatePieceMoves<Us, enumPiece::nKing>(Type == genEvasions ? ~pieceBB_[us] : targets, moves);
+
+    if constexpr (Type == genQuiets or Type == genAll) CBoard::generateCastlingMoves<Us>(moves);
+}
+
+// Captures come before quiet moves for each piece
+template <enumColour Us, enumPiece Piece>
+void CBoard::generatePieceMoves(U64 targets, std::vector<CMove> *moves) const {
+    U64 occupied = CBoard::getOccupiedSquares();
+    U64 enemies = pieceBB_[COLOUR_SET<OPPONENT<Us>>];
+
+    for (auto from : Bitboard::squares(CBoard::getPieceSet(Piece, COLOUR_SET<Us>))) {
+        U64 attacks = CBoard::pieceAttacks<Piece>(from, occupied) & targets;
+
+        for (auto to : Bitboard::squares(attacks & enemies)) moves->emplace_back(from, to, Constants::CAPTURE_FLAG);
+        for (auto to : Bitboard::squares(attacks & ~enemies)) moves->emplace_back(from, to, Constants::QUIET_FLAG);
+    }
+}
+
+template <enumPiece Piece>
+U64 CBoard::pieceAttacks(enumSquare square, U64 occupied) const {
+    if constexpr (Piece == enumPiece::nKnight) {
+        return knightMovesets_[square];
+    } else if constexpr (Piece == enumPiece::nBishop) {
+        return CBoard::getBishopMoveset(square, occupied, 0ULL);
+    } else if constexpr (Piece == enumPiece::nRook) {
+        return CBoard::getRookMoveset(square, occupied, 0ULL);
+    } else if constexpr (Piece == enumPiece::nQueen) {
+        return CBoard::getQueenMoveset(square, occupied, 0ULL);
+    } else {
+        static_assert(Piece == enumPiece::nKing);
+        return kingMovesets_[square];
+    }
+}
+
+void CBoard::generateLegalMoves(std::vector<CMove> *moves) const {
+    std::vector<CMove> pseudoLegal;
+
+    if (checkInfo_.checkers) {
+        CBoard::generateMoves<genEvasions>(&pseudoLegal);
+    } else {
+        CBoard::generateMoves<genAll>(&pseudoLegal);
+    }
+
+    for (auto move : pseudoLegal) {
+        if (CBoard::isLegal(move)) moves->emplace_back(move);
+    }
+}
+
+bool CBoard::isLegal(CMove move) const {
+    PROFILE_SCOPE(legality);
+
+    auto from = static_cast<enumSquare>(move.getFrom());
+    auto to = static_cast<enumSquare>(move.getTo());
+    unsigned int flags = move.getFlags();
+
+    auto us = sideToMove_ == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+    auto them = us == enumPiece::nWhite ? enumPiece::nBlack : enumPiece::nWhite;
+    U64 ourKing = CBoard::getPieceSet(enumPiece::nKing, us);
+
+    if (!ourKing) return true;
+
+    enumSquare kingSquare = Bitboard::lsb(ourKing);
+    U64 fromBB = Bitboard::squareBB(from);
+    U64 toBB = Bitboard::squareBB(to);
+    U64 occupied = CBoard::getOccupiedSquares();
+
+    if (flags == Constants::EP_CAPTURE_FLAG) {
+        // Two pieces leave the line to the king at once, so check the resulting position directly
+        U64 captureBB = Bitboard::squareBB(static_cast<enumSquare>(us == enumPiece::nWhite ? to + 8 : to - 8));
+        occupied ^= fromBB | toBB | captureBB;
+
+        return !(CBoard::attackersTo(kingSquare, occupied) & pieceBB_[them] & ~captureBB);
+    }
+
+    if (from == kingSquare) {
+        if (flags == Constants::KING_CASTLE_FLAG or flags == Constants::QUEEN_CASTLE_FLAG) {
+            if (checkInfo_.checkers) return false;
+
+            for (auto square : Bitboard::squares(Bitboard::between(from, to) | toBB)) {
+                if (CBoard::attackersTo(square, occupied) & pieceBB_[them]) return false;
+            }
+
+            return true;
+        }
+
+        // The king is taken off the board so sliders can see through the square it leaves
+        return !(CBoard::attackersTo(to, occupied ^ fromBB) & pieceBB_[them]);
+    }
+
+    if (checkInfo_.checkers) {
+        // Only the king can get out of double check
+        if (Bitboard::moreThanOne(checkInfo_.checkers)) return false;
+
+        // Otherwise the checker has to be captured or blocked
+        enumSquare checker = Bitboard::lsb(checkInfo_.checkers);
+        if (!((Bitboard::between(kingSquare, checker) | checkInfo_.checkers) & toBB)) return false;
+    }
+
+    return !(checkInfo_.pinned & fromBB) or Bitboard::aligned(kingSquare, from, to);
+}
+
+U64 CBoard::perft(int depth) {
+    if (depth <= 0) return 1;
+
+    std::vector<CMove> moves;
+    CBoard::generateLegalMoves(&moves);
+
+    if (depth == 1) return moves.size();
+
+    U64 nodes = 0;
+
+    for (auto move : moves) {
+        CBoard::makeMove(move);
+        nodes += CBoard::perft(depth - 1);
+        CBoard::unmakeMove(move);
+    }
+
+    return nodes;
+}
+
 U64 CBoard::getOccupiedSquares() const {
     return pieceBB_[enumPiece::nWhite] | pieceBB_[enumPiece::nBlack];
 }
@@ -202,6 +779,10 @@ U64 CBoard::getPieceSet(enumPiece piece) const {
     return pieceBB_[piece];
 }
 
+const std::array<U64, 8> &CBoard::getPieceSets() const {
+    return pieceBB_;
+}
+
 U64 CBoard::getPieceSet(enumPiece piece, enumPiece colour) const {
     return pieceBB_[piece] & pieceBB_[colour];
 }
@@ -211,7 +792,7 @@ U64 CBoard::getPieceSet(enumPiece piece, enumPiece colour) const {
 bool CBoard::getSquare(U64 board, enumSquare square) const {
     if (square < 0 or square > 63) throw  std::invalid_argument("Invalid square");
 
-    return (board & (1ULL << square)) ? 1 : 0;
+    return Bitboard::testSquare(board, square);
 }
 
 bool CBoard::getSquare(enumPiece board, enumSquare square) const {
@@ -222,32 +803,163 @@ bool CBoard::getSquare(enumPiece board, enumSquare square) const {
 void CBoard::setSquare(U64 *board, enumSquare square) const {
     if (square < 0 or square > 63) throw  std::invalid_argument("Invalid square");
 
-    *board |= (1ULL << square);
+    *board |= Bitboard::squareBB(square);
 }
 
 void CBoard::setSquare(enumPiece board, enumSquare square) {
     if (square < 0 or square > 63) throw  std::invalid_argument("Invalid square");
 
-    pieceBB_[board] |= (1ULL << square);
+    pieceBB_[board] |= Bitboard::squareBB(square);
+
+    uint8_t previous = mailbox_[square];
+
+    // Colour bitboards only touch the colour bit of the mailbox entry, piece bitboards only the type
+    if (board == enumPiece::nWhite or board == enumPiece::nBlack) {
+        mailbox_[square] = (mailbox_[square] & Constants::PIECE_TYPE_MASK) | (board << Constants::PIECE_COLOUR_SHIFT);
+    } else {
+        mailbox_[square] = (mailbox_[square] & ~Constants::PIECE_TYPE_MASK) | board;
+    }
+
+    CBoard::rehashSquare(square, previous);
 }
 
 // Sets the given square on the given bitboard to 0, meaning it is unoccupied
 void CBoard::unsetSquare(U64 *board, enumSquare square) const {
     if (square < 0 or square > 63) throw  std::invalid_argument("Invalid square");
 
-    if (CBoard::getSquare(*board, square)) *board ^= (1ULL << square);
+    *board &= ~Bitboard::squareBB(square);
 }
 
 void CBoard::unsetSquare(enumPiece board, enumSquare square) {
     if (square < 0 or square > 63) throw  std::invalid_argument("Invalid square");
 
-    if (CBoard::getSquare(board, square)) pieceBB_[board] ^= (1ULL << square);
+    pieceBB_[board] &= ~Bitboard::squareBB(square);
+
+    uint8_t previous = mailbox_[square];
+
+    // Removing the piece type empties the square, removing the colour leaves the type behind
+    if (board == enumPiece::nWhite or board == enumPiece::nBlack) {
+        mailbox_[square] &= Constants::PIECE_TYPE_MASK;
+    } else if ((mailbox_[square] & Constants::PIECE_TYPE_MASK) == board) {
+        mailbox_[square] = Constants::NO_PIECE;
+    }
+
+    CBoard::rehashSquare(square, previous);
+}
+
+// Swaps the key of the previous mailbox entry on square for the key of the current one
+void CBoard::rehashSquare(enumSquare square, uint8_t previous) {
+    if (previous & Constants::PIECE_TYPE_MASK) key_ ^= Zobrist::piece(previous, square);
+    if (mailbox_[square] & Constants::PIECE_TYPE_MASK) key_ ^= Zobrist::piece(mailbox_[square], square);
+}
+
+uint8_t CBoard::pieceOn(enumSquare square) const {
+    return mailbox_[square];
+}
+
+enumPiece CBoard::pieceTypeOn(enumSquare square) const {
+    return static_cast<enumPiece>(mailbox_[square] & Constants::PIECE_TYPE_MASK);
+}
+
+enumPiece CBoard::pieceColourOn(enumSquare square) const {
+    return static_cast<enumPiece>(mailbox_[square] >> Constants::PIECE_COLOUR_SHIFT);
+}
+
+bool CBoard::isConsistent() const {
+    for (int i = 0; i < 64; ++i) {
+        auto square = static_cast<enumSquare>(i);
+        uint8_t expected = Constants::NO_PIECE;
+        int nPieces = 0;
+        int nColours = 0;
+
+        for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+            if (Bitboard::testSquare(pieceBB_[piece], square)) {
+                expected |= piece;
+                ++nPieces;
+            }
+        }
+
+        for (int colour = enumPiece::nWhite; colour <= enumPiece::nBlack; ++colour) {
+            if (Bitboard::testSquare(pieceBB_[colour], square)) {
+                expected |= colour << Constants::PIECE_COLOUR_SHIFT;
+                ++nColours;
+            }
+        }
+
+        if (nPieces != nColours or nPieces > 1) return false;
+        if (mailbox_[square] != expected) return false;
+    }
+
+    return key_ == CBoard::computeKey();
+}
+
+U64 CBoard::computeKey() const {
+    U64 key = 0ULL;
+
+    for (int i = 0; i < 64; ++i) {
+        auto square = static_cast<enumSquare>(i);
+        if (mailbox_[square] & Constants::PIECE_TYPE_MASK) key ^= Zobrist::piece(mailbox_[square], square);
+    }
+
+    key ^= Zobrist::castling(castling_);
+    if (enPassant_ != enumSquare::no_sq) key ^= Zobrist::enPassant(enPassant_);
+    if (sideToMove_ == enumColour::black) key ^= Zobrist::side();
+
+    return key;
+}
+
+void CBoard::putPiece(enumPiece colour, enumPiece piece, enumSquare square) {
+    U64 bb = Bitboard::squareBB(square);
+
+    pieceBB_[colour] |= bb;
+    pieceBB_[piece] |= bb;
+    mailbox_[square] = piece | (colour << Constants::PIECE_COLOUR_SHIFT);
+    key_ ^= Zobrist::piece(mailbox_[square], square);
+}
+
+void CBoard::removePiece(enumSquare square) {
+    U64 bb = Bitboard::squareBB(square);
+
+    pieceBB_[CBoard::pieceColourOn(square)] &= ~bb;
+    pieceBB_[CBoard::pieceTypeOn(square)] &= ~bb;
+    key_ ^= Zobrist::piece(mailbox_[square], square);
+    mailbox_[square] = Constants::NO_PIECE;
+}
+
+void CBoard::movePiece(enumSquare from, enumSquare to) {
+    U64 fromTo = Bitboard::squareBB(from) | Bitboard::squareBB(to);
+
+    pieceBB_[CBoard::pieceColourOn(from)] ^= fromTo;
+    pieceBB_[CBoard::pieceTypeOn(from)] ^= fromTo;
+    key_ ^= Zobrist::piece(mailbox_[from], from) ^ Zobrist::piece(mailbox_[from], to);
+    mailbox_[to] = mailbox_[from];
+    mailbox_[from] = Constants::NO_PIECE;
+}
+
+U64 CBoard::getKey() const {
+    return key_;
+}
+
+enumColour CBoard::getSideToMove() const {
+    return sideToMove_;
 }
 
 int CBoard::getCastleState() const {
     return castling_;
 }
 
+enumSquare CBoard::getEnPassantSquare() const {
+    return enPassant_;
+}
+
+int CBoard::getHalfmoves() const {
+    return halfmoves_;
+}
+
+int CBoard::getFullmoves() const {
+    return fullmoves_;
+}
+
 const Movesets *CBoard::getKnightMovesets() const {
     return &knightMovesets_;
 }
@@ -277,7 +989,7 @@ const U64 CBoard::getBishopMoveset(enumSquare square, U64 blockers, U64 friendly
 
     U64 key = (blockers * bishopMagics[square]) >> (64 - bishopBits[square]);
 
-    return bishopMovesets_[square][key];
+    return bishopMovesets_[square].at(key) & ~friendlyPieces;
 }
 
 const U64 CBoard::getRookMoveset(enumSquare square, U64 blockers, U64 friendlyPieces) {
@@ -285,7 +997,7 @@ const U64 CBoard::getRookMoveset(enumSquare square, U64 blockers, U64 friendlyPi
 
     U64 key = (blockers * rookMagics[square]) >> (64 - rookBits[square]);
 
-    return rookMovesets_[square][key];
+    return rookMovesets_[square].at(key) & ~friendlyPieces;
 }
 
 const U64 CBoard::getQueenMoveset(enumSquare square, U64 blockers, U64 friendlyPieces) {
@@ -299,7 +1011,7 @@ void CBoard::printBB(U64 board) {
         std::cout << 8 - rank << "  ";
 
         for (int file = 0; file < 8; ++file) {
-            std::cout << " " << getSquare(board, CBoard::getSquareFromCoords(rank, file));
+            std::cout << " " << Bitboard::testSquare(board, CBoard::getSquareFromCoords(rank, file));
         }
 
         std::cout << "\n";
@@ -319,62 +1031,167 @@ void CBoard::printBB(enumPiece board) {
     CBoard::printBB(pieceBB_[board]);
 }
 
-U64 CBoard::shiftNorthOne(U64 bitboard) {
-    return bitboard << 8;
+// Bitboard of the en passant target square, or 0 if there is none
+U64 CBoard::getEnPassantSet() const {
+    return Bitboard::squareBB(static_cast<enumSquare>(enPassant_ & 63)) & -static_cast<U64>(enPassant_ != enumSquare::no_sq);
 }
 
-U64 CBoard::shiftSouthOne(U64 bitboard) {
-    return bitboard >> 8;
+template <enumColour Us>
+U64 CBoard::pawnPushTargets() const {
+    return shiftForward<Us>(CBoard::getPieceSet(enumPiece::nPawn, COLOUR_SET<Us>)) & CBoard::getEmptySquares();
 }
 
-U64 CBoard::wPawnPushTargets() {
-    return
-        CBoard::shiftNorthOne(CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nWhite))
-        & CBoard::getEmptySquares();
+template <enumColour Us>
+U64 CBoard::pawnDoublePushTargets() const {
+    return shiftForward<Us>(CBoard::pawnPushTargets<Us>()) & CBoard::getEmptySquares() & DOUBLE_PUSH_RANK<Us>;
 }
 
-U64 CBoard::bPawnPushTargets() {
-    return
-        CBoard::shiftSouthOne(CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nBlack))
-        & CBoard::getEmptySquares();
+template <enumColour Us>
+U64 CBoard::pawnsCanPush() const {
+    return shiftBackward<Us>(CBoard::getEmptySquares()) & CBoard::getPieceSet(enumPiece::nPawn, COLOUR_SET<Us>);
 }
 
-U64 CBoard::wPawnDoublePushTargets() {
-    U64 singlePush = CBoard::wPawnPushTargets();
-    return CBoard::shiftNorthOne(singlePush) & CBoard::getEmptySquares() & Constants::RANK_4;
+template <enumColour Us>
+U64 CBoard::pawnsCanDoublePush() const {
+    U64 emptySquares = CBoard::getEmptySquares();
+    U64 emptyPassedSquares = shiftBackward<Us>(emptySquares & DOUBLE_PUSH_RANK<Us>) & emptySquares;
+    return CBoard::getPieceSet(enumPiece::nPawn, COLOUR_SET<Us>) & shiftBackward<Us>(emptyPassedSquares);
 }
 
-U64 CBoard::bPawnDoublePushTargets() {
-    U64 singlePush = CBoard::bPawnPushTargets();
-    return CBoard::shiftSouthOne(singlePush) & CBoard::getEmptySquares() & Constants::RANK_5;
+template <enumColour Us>
+U64 CBoard::pawnEastAttacks() const {
+    return shiftForwardEast<Us>(CBoard::getPieceSet(enumPiece::nPawn, COLOUR_SET<Us>));
 }
 
-U64 CBoard::wPawnsCanPush() {
-    return CBoard::shiftSouthOne(CBoard::getEmptySquares()) & CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nWhite);
+template <enumColour Us>
+U64 CBoard::pawnWestAttacks() const {
+    return shiftForwardWest<Us>(CBoard::getPieceSet(enumPiece::nPawn, COLOUR_SET<Us>));
 }
 
-U64 CBoard::bPawnsCanPush() {
-    return CBoard::shiftNorthOne(CBoard::getEmptySquares()) & CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nBlack);
+template <enumColour Us>
+U64 CBoard::pawnAnyAttacks() const {
+    return CBoard::pawnEastAttacks<Us>() | CBoard::pawnWestAttacks<Us>();
 }
 
-U64 CBoard::wPawnsCanDoublePush() {
-    U64 emptySquares = CBoard::getEmptySquares();
-    U64 emptyRank3 = CBoard::shiftSouthOne(emptySquares & Constants::RANK_4) & emptySquares;
-    return CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nWhite) & CBoard::shiftSouthOne(emptyRank3);
+template <enumColour Us>
+U64 CBoard::pawnEastCaptureTargets() const {
+    return CBoard::pawnEastAttacks<Us>() & pieceBB_[COLOUR_SET<OPPONENT<Us>>];
 }
 
-U64 CBoard::bPawnsCanDoublePush() {
-    U64 emptySquares = CBoard::getEmptySquares();
-    U64 emptyRank6 = CBoard::shiftNorthOne(emptySquares & Constants::RANK_5) & emptySquares;
-    return CBoard::getPieceSet(enumPiece::nPawn, enumPiece::nBlack) & CBoard::shiftNorthOne(emptyRank6);
+template <enumColour Us>
+U64 CBoard::pawnWestCaptureTargets() const {
+    return CBoard::pawnWestAttacks<Us>() & pieceBB_[COLOUR_SET<OPPONENT<Us>>];
+}
+
+// The en passant target is always on rank 6 when White captures and rank 3 when Black captures,
+// masking by rank keeps a stale target for the other side from being picked up
+template <enumColour Us>
+U64 CBoard::pawnEastEnPassantTargets() const {
+    return CBoard::pawnEastAttacks<Us>() & CBoard::getEnPassantSet() & EN_PASSANT_RANK<Us>;
+}
+
+template <enumColour Us>
+U64 CBoard::pawnWestEnPassantTargets() const {
+    return CBoard::pawnWestAttacks<Us>() & CBoard::getEnPassantSet() & EN_PASSANT_RANK<Us>;
+}
+
+// Instantiated for both colours so the pawn helpers can be called from outside this file
+#define INSTANTIATE_PAWN_HELPER(name) \
+    template U64 CBoard::name<enumColour::white>() const; \
+    template U64 CBoard::name<enumColour::black>() const;
+
+INSTANTIATE_PAWN_HELPER(pawnPushTargets)
+INSTANTIATE_PAWN_HELPER(pawnDoublePushTargets)
+INSTANTIATE_PAWN_HELPER(pawnsCanPush)
+INSTANTIATE_PAWN_HELPER(pawnsCanDoublePush)
+INSTANTIATE_PAWN_HELPER(pawnEastAttacks)
+INSTANTIATE_PAWN_HELPER(pawnWestAttacks)
+INSTANTIATE_PAWN_HELPER(pawnAnyAttacks)
+INSTANTIATE_PAWN_HELPER(pawnEastCaptureTargets)
+INSTANTIATE_PAWN_HELPER(pawnWestCaptureTargets)
+INSTANTIATE_PAWN_HELPER(pawnEastEnPassantTargets)
+INSTANTIATE_PAWN_HELPER(pawnWestEnPassantTargets)
+
+#undef INSTANTIATE_PAWN_HELPER
+
+// Only checks castling rights and that the squares between king and rook are empty,
+// whether the king passes through check is left to isLegal
+template <enumColour Us>
+void CBoard::generateCastlingMoves(std::vector<CMove> *moves) const {
+    constexpr bool white = Us == enumColour::white;
+    constexpr enumSquare king = white ? enumSquare::e1 : enumSquare::e8;
+    constexpr int kingside = white ? Constants::WHITE_KINGSIDE_CASTLE : Constants::BLACK_KINGSIDE_CASTLE;
+    constexpr int queenside = white ? Constants::WHITE_QUEENSIDE_CASTLE : Constants::BLACK_QUEENSIDE_CASTLE;
+
+    U64 occupied = CBoard::getOccupiedSquares();
+
+    if ((castling_ & kingside) and !(occupied & Bitboard::between(king, static_cast<enumSquare>(king + 3)))) {
+        moves->emplace_back(king, static_cast<enumSquare>(king + 2), Constants::KING_CASTLE_FLAG);
+    }
+
+    if ((castling_ & queenside) and !(occupied & Bitboard::between(king, static_cast<enumSquare>(king - 4)))) {
+        moves->emplace_back(king, static_cast<enumSquare>(king - 2), Constants::QUEEN_CASTLE_FLAG);
+    }
+}
+
+void CBoard::generatePawnMoves(std::vector<CMove> *moves) const {
+    if (sideToMove_ == enumColour::white) {
+        CBoard::generatePawnMoves<enumColour::white, genAll>(~0ULL, moves);
+    } else {
+        CBoard::generatePawnMoves<enumColour::black, genAll>(~0ULL, moves);
+    }
+}
+
+// Each target set is serialised on its own, the origin square of every move in a set
+// is a fixed offset away from its target square
+// targets only restricts evasions, pushes and captures already go to empty and enemy squares
+template <enumColour Us, enumGenType Type>
+void CBoard::generatePawnMoves(U64 targets, std::vector<CMove> *moves) const {
+    U64 mask = Type == genEvasions ? targets : ~0ULL;
+    U64 pushTargets = CBoard::pawnPushTargets<Us>() & mask;
+    U64 eastCaptureTargets = CBoard::pawnEastCaptureTargets<Us>() & mask;
+    U64 westCaptureTargets = CBoard::pawnWestCaptureTargets<Us>() & mask;
+
+    if constexpr (Type != genCaptures) {
+        CBoard::serialisePawnMoves(pushTargets & ~PROMOTION_RANK<Us>, PUSH_OFFSET<Us>, Constants::QUIET_FLAG, moves);
+        CBoard::serialisePawnMoves(CBoard::pawnDoublePushTargets<Us>() & mask, 2 * PUSH_OFFSET<Us>, Constants::DOUBLE_PAWN_PUSH_FLAG, moves);
+    }
+
+    if constexpr (Type != genQuiets) {
+        CBoard::serialisePawnMoves(eastCaptureTargets & ~PROMOTION_RANK<Us>, EAST_OFFSET<Us>, Constants::CAPTURE_FLAG, moves);
+        CBoard::serialisePawnMoves(westCaptureTargets & ~PROMOTION_RANK<Us>, WEST_OFFSET<Us>, Constants::CAPTURE_FLAG, moves);
+
+        // Not restricted when evading, the pawn captured en passant may be the checker
+        CBoard::serialisePawnMoves(CBoard::pawnEastEnPassantTargets<Us>(), EAST_OFFSET<Us>, Constants::EP_CAPTURE_FLAG, moves);
+        CBoard::serialisePawnMoves(CBoard::pawnWestEnPassantTargets<Us>(), WEST_OFFSET<Us>, Constants::EP_CAPTURE_FLAG, moves);
+
+        CBoard::serialisePromotions(pushTargets & PROMOTION_RANK<Us>, PUSH_OFFSET<Us>, Constants::N_PROMO_FLAG, moves);
+        CBoard::serialisePromotions(eastCaptureTargets & PROMOTION_RANK<Us>, EAST_OFFSET<Us>, Constants::N_PROMO_CAPTURE_FLAG, moves);
+        CBoard::serialisePromotions(westCaptureTargets & PROMOTION_RANK<Us>, WEST_OFFSET<Us>, Constants::N_PROMO_CAPTURE_FLAG, moves);
+    }
+}
+
+// Adds a move for every square in targets, originating from (target square + fromOffset)
+void CBoard::serialisePawnMoves(U64 targets, int fromOffset, unsigned int flags, std::vector<CMove> *moves) const {
+    for (auto to : Bitboard::squares(targets)) {
+        moves->emplace_back(static_cast<enumSquare>(to + fromOffset), to, flags);
+    }
+}
+
+// Same as serialisePawnMoves but adds all four promotions per target
+// knightFlag is the knight promotion flag, the bishop, rook and queen flags follow on from it
+void CBoard::serialisePromotions(U64 targets, int fromOffset, unsigned int knightFlag, std::vector<CMove> *moves) const {
+    for (auto to : Bitboard::squares(targets)) {
+        for (unsigned int promo = 0; promo < 4; ++promo) {
+            moves->emplace_back(static_cast<enumSquare>(to + fromOffset), to, knightFlag + promo);
+        }
+    }
 }
 
 void CBoard::generateNonSlidingMovesets(const int* deltaRank, const int* deltaFile, Movesets *moveset) {
     for (int i = 0; i < 64; ++i) {
         U64 bitboard = 0ULL;
-        std::pair<int, int> coords = Constants::ENUM_TO_COORDS_MAP.at(static_cast<enumSquare>(i));
-        int currRank = coords.first;
-        int currFile = coords.second;
+        auto [currRank, currFile] = Constants::squareToCoords(static_cast<enumSquare>(i));
 
         for (int j = 0; j < 8; ++j) {
             int newRank = currRank + deltaRank[j];
@@ -382,7 +1199,7 @@ void CBoard::generateNonSlidingMovesets(const int* deltaRank, const int* deltaFi
 
             if (!CBoard::isLegalSquare(newRank, newFile)) continue;
 
-            CBoard::setSquare(&bitboard, CBoard::getSquareFromCoords(newRank, newFile));
+            bitboard |= Bitboard::squareBB(CBoard::getSquareFromCoords(newRank, newFile));
         }
 
         moveset->at(i) = bitboard;
@@ -403,59 +1220,35 @@ void CBoard::generateKingMovesets() {
     CBoard::generateNonSlidingMovesets(deltaRank, deltaFile, &kingMovesets_);
 }
 
-void CBoard::generateBlockerMasks(enumPiece piece) {
-    std::vector<std::pair<int, int>> possibleRays;
-    Movesets *blockerMasks;
-    std::array<BlockerVector, 64> *blockerVectors;
+template <enumPiece Piece>
+void CBoard::generateBlockerMasks() {
+    static_assert(Piece == enumPiece::nBishop or Piece == enumPiece::nRook);
 
-    if (piece == enumPiece::nBishop) {
-        possibleRays = Constants::BISHOP_RAYS;
-        blockerMasks = &bishopBlockerMasks_;
-        blockerVectors = &bishopBlockerVectors_;
-    } else if (piece == enumPiece::nRook) {
-        possibleRays = Constants::ROOK_RAYS;
-        blockerMasks = &rookBlockerMasks_;
-        blockerVectors = &rookBlockerVectors_;
-    } else {
-        throw std::invalid_argument("Invalid piece");
-    }
+    const auto &possibleRays = Piece == enumPiece::nBishop ? Constants::BISHOP_RAYS : Constants::ROOK_RAYS;
+    Movesets *blockerMasks = Piece == enumPiece::nBishop ? &bishopBlockerMasks_ : &rookBlockerMasks_;
 
-    for (auto curr : Constants::ENUM_TO_COORDS_MAP) {
+    for (int i = 0; i < 64; ++i) {
         U64 bb = 0ULL;
 
-        enumSquare currSquare = curr.first;
-        int currRank = curr.second.first;
-        int currFile = curr.second.second;
+        auto currSquare = static_cast<enumSquare>(i);
+        auto [currRank, currFile] = Constants::squareToCoords(currSquare);
 
-        for (auto ray: possibleRays) {
+        for (auto ray : possibleRays) {
             int blockerRank = currRank + ray.first;
             int blockerFile = currFile + ray.second;
 
             while (CBoard::isLegalSquare(blockerRank, blockerFile)) {
-                enumSquare currBlocker = getSquareFromCoords(blockerRank, blockerFile);
-                CBoard::setSquare(&bb, currBlocker);
+                bb |= Bitboard::squareBB(getSquareFromCoords(blockerRank, blockerFile));
 
                 blockerRank += ray.first;
                 blockerFile += ray.second;
             }
         }
 
-
-        U64 noEdges = CBoard::clearEdges(bb, currSquare);
-        blockerMasks->at(currSquare) = noEdges;
-
-        // Generate blockers after edges have been cleared
-        BlockerVector blockers = {};
-
-        for (int rank = 0; rank < 8; ++rank) {
-            for (int file = 0; file < 8; ++file) {
-                enumSquare currBlocker = CBoard::getSquareFromCoords(rank, file);
-                if (CBoard::getSquare(noEdges, currBlocker)) {
-                    blockers.emplace_back(currBlocker);
-                }
-            }
-        }
-        blockerVectors->at(currSquare) = blockers;
+        // Bishop rays never run along an edge, so every edge square can be dropped
+        blockerMasks->at(currSquare) = Piece == enumPiece::nBishop
+            ? bb & ~Constants::EDGE_MASK
+            : CBoard::clearEdges(bb, currSquare);
     }
 }
 
@@ -469,13 +1262,13 @@ U64 CBoard::clearEdges(U64 bb, enumSquare square) {
         if (CBoard::isCorner(square)) return bb;
 
         if (square < 8) {
-            return bb & ~Constants::RANK_8;
-        } else if (square >= 56) {
             return bb & ~Constants::RANK_1;
+        } else if (square >= 56) {
+            return bb & ~Constants::RANK_8;
         } else if (square % 8 == 0) {
-            return bb & ~Constants::FILE_8;
+            return bb & ~Constants::FILE_H;
         } else {
-            return bb & ~Constants::FILE_1;
+            return bb & ~Constants::FILE_A;
         }
     } else {
         return bb & ~Constants::EDGE_MASK;
@@ -487,110 +1280,59 @@ bool CBoard::isLegalSquare(int rank, int file) {
 }
 
 bool CBoard::isEdge(enumSquare square) {
-    U64 bb = 0ULL;
-    CBoard::setSquare(&bb, square);
-
-    return Constants::EDGE_MASK & bb;
+    return Constants::EDGE_MASK & Bitboard::squareBB(square);
 }
 
 bool CBoard::isCorner(enumSquare square) {
-    U64 bb = 0ULL;
-    CBoard::setSquare(&bb, square);
-
-    return Constants::CORNER_MASK & bb;
+    return Constants::CORNER_MASK & Bitboard::squareBB(square);
 }
 
 bool CBoard::isOrthogonallyAdjacent(enumSquare s1, enumSquare s2) {
     if (s1 == enumSquare::no_sq or s2 == enumSquare::no_sq) return false;
 
-    auto [s1_x, s1_y] = Constants::ENUM_TO_COORDS_MAP.at(s1);
-    auto [s2_x, s2_y] = Constants::ENUM_TO_COORDS_MAP.at(s2);
+    auto [s1_x, s1_y] = Constants::squareToCoords(s1);
+    auto [s2_x, s2_y] = Constants::squareToCoords(s2);
 
     // XOR here to not include diagonals
     return (std::abs(s1_x - s2_x) == 1) ^ (std::abs(s1_y - s2_y) == 1);
 }
 
-void CBoard::generateSlidingMovesets(enumPiece piece) {
-    std::array<BlockerVector, 64> *blockerVectors;
-    std::array<std::unordered_map<U64, U64>, 64> *movesets;
-    const U64 *magics;
-    const int *bits;
-
-    if (piece == enumPiece::nBishop) {
-        blockerVectors = &bishopBlockerVectors_;
-        movesets = &bishopMovesets_;
-        magics = bishopMagics;
-        bits = bishopBits;
-    } else if (piece == enumPiece::nRook) {
-        blockerVectors = &rookBlockerVectors_;
-        movesets = &rookMovesets_;
-        magics = rookMagics;
-        bits = rookBits;
-    } else {
-        throw std::invalid_argument("Invalid piece");
-    }
+template <enumPiece Piece>
+void CBoard::generateSlidingMovesets() {
+    static_assert(Piece == enumPiece::nBishop or Piece == enumPiece::nRook);
+
+    constexpr bool bishop = Piece == enumPiece::nBishop;
+    const Movesets *blockerMasks = bishop ? &bishopBlockerMasks_ : &rookBlockerMasks_;
+    std::array<std::unordered_map<U64, U64>, 64> *movesets = bishop ? &bishopMovesets_ : &rookMovesets_;
+    const U64 *magics = bishop ? bishopMagics : rookMagics;
+    const int *bits = bishop ? bishopBits : rookBits;
 
     for (int i = 0; i < 64; ++i) {
-        auto blockerVector = blockerVectors->at(i);
-        std::vector<BlockerVector> combinations = {};
-
-        // Generate all combinations of bits[i] possible blockers for each square
-        // i.e. 1 blocker, 2 blockers up to bits[i] blockers
-        for (int j = 1; j <= bits[i]; ++j) {
-            getCombination(&combinations, &blockerVector, j);
-
-            // Convert blockers back into a bitboard
-            // Generate key with the corresponding magic number
-            // Fill in appropriate slot in corresponding moveset
-            for (auto combination : combinations) {
-                U64 blockerBB = 0ULL;
-                for (auto blocker : combination) CBoard::setSquare(&blockerBB, blocker);
-
-                U64 movesetBB = CBoard::getMovesetFromBlockers(
-                    static_cast<enumSquare>(i),
-                    piece,
-                    blockerBB
-                );
-
-                U64 key = (blockerBB * magics[i]) >> (64 - bits[i]);
-
-                movesets->at(i)[key] = movesetBB;
-            }
-        }
-    }
-}
+        U64 mask = blockerMasks->at(i);
+        U64 blockerBB = 0ULL;
 
-void CBoard::getCombination(std::vector<BlockerVector> *combinations, BlockerVector *blockers, int nBlockers) {
-    BlockerVector currCombination(nBlockers);
+        // Visit every subset of the blocker mask, starting from the empty board, via the Carry-Rippler trick
+        // Generate key with the corresponding magic number
+        // Fill in appropriate slot in corresponding moveset
+        do {
+            U64 movesetBB = CBoard::getMovesetFromBlockers<Piece>(static_cast<enumSquare>(i), blockerBB);
 
-    CBoard::getCombinationRecurse(combinations, blockers, &currCombination, 0, blockers->size() - 1, 0, nBlockers);
-}
+            U64 key = (blockerBB * magics[i]) >> (64 - bits[i]);
 
-void CBoard::getCombinationRecurse(
-    std::vector<BlockerVector> *combinations,
-    BlockerVector *blockers,
-    BlockerVector *currCombination,
-    int start, int end, int currCombIdx, int nBlockers
-) {
-    if (currCombIdx == nBlockers) {
-        combinations->emplace_back(*currCombination);
-        return;
-    }
+            movesets->at(i)[key] = movesetBB;
 
-    for (int i = start; i <= end && end - i + 1 >= nBlockers - currCombIdx; ++i) {
-        currCombination->at(currCombIdx) = blockers->at(i);
-        CBoard::getCombinationRecurse(combinations, blockers, currCombination, i + 1, end, currCombIdx + 1, nBlockers);
+            blockerBB = (blockerBB - mask) & mask;
+        } while (blockerBB);
     }
 }
 
-U64 CBoard::getMovesetFromBlockers(enumSquare square, enumPiece piece, U64 blockerBB) {
+template <enumPiece Piece>
+U64 CBoard::getMovesetFromBlockers(enumSquare square, U64 blockerBB) {
     U64 moveset = 0ULL;
 
-    auto possibleRays = piece == enumPiece::nBishop ? Constants::BISHOP_RAYS : Constants::ROOK_RAYS;
+    const auto &possibleRays = Piece == enumPiece::nBishop ? Constants::BISHOP_RAYS : Constants::ROOK_RAYS;
 
-    auto coords = Constants::ENUM_TO_COORDS_MAP.at(square);
-    int startRank = coords.first;
-    int startFile = coords.second;
+    auto [startRank, startFile] = Constants::squareToCoords(square);
 
     for (auto ray : possibleRays) {
         int currRank = startRank + ray.first;
@@ -598,9 +1340,9 @@ U64 CBoard::getMovesetFromBlockers(enumSquare square, enumPiece piece, U64 block
 
         while (CBoard::isLegalSquare(currRank, currFile)) {
             enumSquare currSquare = CBoard::getSquareFromCoords(currRank, currFile);
-            CBoard::setSquare(&moveset, currSquare);
+            moveset |= Bitboard::squareBB(currSquare);
 
-            if (CBoard::getSquare(blockerBB, currSquare) == 1) break;
+            if (Bitboard::testSquare(blockerBB, currSquare)) break;
 
             currRank += ray.first;
             currFile += ray.second;
@@ -0,0 +1,118 @@
+#include <algorithm>
+
+#include "chessbot/CEngine.h"
+
+CCancelToken::CCancelToken() : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+void CCancelToken::cancel() {
+    cancelled_->store(true);
+}
+
+bool CCancelToken::isCancelled() const {
+    return cancelled_->load(std::memory_order_relaxed);
+}
+
+CEngine::CEngine(const EngineConfig &config) : running_(0), stopping_(false), epoch_(0) {
+    tt_ = std::make_unique<CTranspositionTable>(config.hashMegabytes);
+
+    for (int i = 0; i < std::max(1, config.threads); ++i) {
+        searches_.push_back(std::make_unique<CSearch>(tt_.get()));
+        threads_.emplace_back(&CEngine::workerLoop, this, searches_.back().get());
+    }
+}
+
+CEngine::~CEngine() {
+    CEngine::cancelAll();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+
+    queueReady_.notify_all();
+    for (auto &thread : threads_) thread.join();
+}
+
+std::future<SearchResult> CEngine::search(const CBoard &board, const SearchLimits &limits, CCancelToken token,
+                                          InfoCallback onInfo, ResultCallback onResult) {
+    Job job = { board, limits, token, std::move(onInfo), std::move(onResult), std::promise<SearchResult>(), epoch_ };
+    std::future<SearchResult> result = job.promise.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(job));
+    }
+
+    queueReady_.notify_one();
+
+    return result;
+}
+
+void CEngine::cancelAll() {
+    ++epoch_;
+}
+
+void CEngine::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [&]() { return queue_.empty() and running_ == 0; });
+}
+
+void CEngine::newGame() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [&]() { return queue_.empty() and running_ == 0; });
+
+    tt_->clear();
+    for (auto &search : searches_) search->clearHistory();
+}
+
+void CEngine::setTablebases(const TablebaseConfig &config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tbConfig_ = config;
+}
+
+int CEngine::getThreads() const {
+    return threads_.size();
+}
+
+std::size_t CEngine::getQueued() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+void CEngine::workerLoop(CSearch *search) {
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        queueReady_.wait(lock, [&]() { return !queue_.empty() or stopping_; });
+
+        if (queue_.empty()) return;
+
+        Job job = std::move(queue_.front());
+        queue_.pop_front();
+        ++running_;
+
+        search->setTablebases(tbConfig_);
+        lock.unlock();
+
+        // Checked from the start of the search, so a cancel arriving at any point is seen
+        search->setCancelCheck([&]() { return job.token.isCancelled() or job.epoch != epoch_; });
+        search->setInfoCallback(job.onInfo);
+
+        try {
+            SearchResult result = { CMove(), 0, 0, 0 };
+            if (!job.token.isCancelled() and job.epoch == epoch_) result = search->search(job.board, job.limits);
+
+            if (job.onResult) job.onResult(result);
+            job.promise.set_value(result);
+        } catch (...) {
+            job.promise.set_exception(std::current_exception());
+        }
+
+        search->setCancelCheck(nullptr);
+        search->setInfoCallback(nullptr);
+
+        lock.lock();
+        --running_;
+
+        if (queue_.empty() and running_ == 0) idle_.notify_all();
+    }
+}
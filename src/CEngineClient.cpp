@@ -0,0 +1,97 @@
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "chessbot/CEngineClient.h"
+
+CEngineClient::CEngineClient() : fd_(-1) {}
+
+CEngineClient::CEngineClient(const std::string &socketPath) : CEngineClient() {
+    if (!CEngineClient::connect(socketPath)) throw std::invalid_argument("Could not connect to " + socketPath);
+}
+
+CEngineClient::~CEngineClient() {
+    CEngineClient::close();
+}
+
+bool CEngineClient::connect(const std::string &socketPath) {
+    CEngineClient::close();
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() or socketPath.size() >= sizeof(address.sun_path)) return false;
+    std::strcpy(address.sun_path, socketPath.c_str());
+
+    fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) return false;
+
+    if (::connect(fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+        CEngineClient::close();
+        return false;
+    }
+
+    return true;
+}
+
+void CEngineClient::close() {
+    if (fd_ >= 0) ::close(fd_);
+
+    fd_ = -1;
+    buffer_.clear();
+}
+
+bool CEngineClient::isConnected() const {
+    return fd_ >= 0;
+}
+
+bool CEngineClient::send(std::string_view text) {
+    if (fd_ < 0) return false;
+
+    while (!text.empty()) {
+        ssize_t sent = ::send(fd_, text.data(), text.size(), MSG_NOSIGNAL);
+
+        if (sent < 0 and errno == EINTR) continue;
+        if (sent <= 0) return false;
+
+        text.remove_prefix(sent);
+    }
+
+    return true;
+}
+
+bool CEngineClient::readLine(std::string *line) {
+    if (fd_ < 0) return false;
+
+    std::size_t newline;
+
+    while ((newline = buffer_.find('\n')) == std::string::npos) {
+        char data[4096];
+        ssize_t length = read(fd_, data, sizeof(data));
+
+        if (length < 0 and errno == EINTR) continue;
+        if (length <= 0) return false;
+
+        buffer_.append(data, length);
+    }
+
+    line->assign(buffer_, 0, newline);
+    buffer_.erase(0, newline + 1);
+
+    return true;
+}
+
+bool CEngineClient::request(std::string_view commands, std::string_view reply, std::vector<std::string> *lines) {
+    if (!CEngineClient::send(commands)) return false;
+
+    std::string line;
+
+    while (CEngineClient::readLine(&line)) {
+        lines->push_back(line);
+        if (line.starts_with(reply)) return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "chessbot/CEngineService.h"
+#include "chessbot/uci.h"
+
+static const std::string START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// A line longer than this ends the session, a long game's position command is a few kilobytes
+constexpr std::size_t MAX_LINE_LENGTH = 1 << 16;
+
+// A client which stops reading is disconnected rather than holding up a worker
+constexpr long SEND_TIMEOUT_SECONDS = 5;
+
+// The shared table ages once per this many requests for each worker, not once per search, so one session's
+// search does not make the deep entries of the searches running beside it replaceable
+constexpr U64 GENERATION_REQUESTS_PER_WORKER = 8;
+
+static bool sendAll(int fd, std::string_view text) {
+    while (!text.empty()) {
+        ssize_t sent = send(fd, text.data(), text.size(), MSG_NOSIGNAL);
+
+        if (sent < 0 and errno == EINTR) continue;
+        if (sent <= 0) return false;
+
+        text.remove_prefix(sent);
+    }
+
+    return true;
+}
+
+static long long microsecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+struct CEngineService::Session {
+    int fd;
+
+    // Only used by the connection thread
+    std::string buffer;
+    std::string fen = START_FEN;
+    std::vector<CMove> moves;
+
+    // Set by stop and by closing the session, cleared when a search is queued
+    // The worker's search polls it, so a stop sent before the search has started is not lost
+    std::atomic<bool> stopped = false;
+
+    // Guards the rest and writing to fd, the socket is closed by whichever thread finds it closed and not pending
+    std::mutex mutex;
+    bool pending = false;
+    bool closed = false;
+
+    // Set while a worker is searching for this session
+    CSearch *searcher = nullptr;
+
+    Session(int socket) : fd(socket) {}
+
+    // Dropped if the session has been closed
+    void reply(std::string_view text) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!closed) sendAll(fd, text);
+    }
+};
+
+CEngineService::CEngineService(const ServiceConfig &config)
+    : config_(config), listenFd_(-1), wakeFds_{ -1, -1 }, running_(false), sessionCount_(0), requests_(0) {
+    config_.workers = std::max(1, config_.workers);
+    tt_ = std::make_unique<CTranspositionTable>(config_.hashMegabytes);
+}
+
+CEngineService::~CEngineService() {
+    CEngineService::stop();
+}
+
+bool CEngineService::start() {
+    if (running_) return true;
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (config_.socketPath.empty() or config_.socketPath.size() >= sizeof(address.sun_path)) return false;
+    std::strcpy(address.sun_path, config_.socketPath.c_str());
+
+    listenFd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0) return false;
+
+    unlink(config_.socketPath.c_str());
+
+    if (bind(listenFd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0
+        or listen(listenFd_, SOMAXCONN) != 0 or pipe2(wakeFds_, O_CLOEXEC) != 0) {
+        ::close(listenFd_);
+        listenFd_ = -1;
+        return false;
+    }
+
+    running_ = true;
+    ioThread_ = std::thread(&CEngineService::ioLoop, this);
+    for (int i = 0; i < config_.workers; ++i) workers_.emplace_back(&CEngineService::workerLoop, this);
+
+    return true;
+}
+
+void CEngineService::stop() {
+    if (!running_.exchange(false)) return;
+
+    // The connection thread closes every session on its way out, stopping their searches
+    char wake = 0;
+    while (write(wakeFds_[1], &wake, 1) < 0 and errno == EINTR) {}
+    ioThread_.join();
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        queueReady_.notify_all();
+    }
+
+    for (auto &worker : workers_) worker.join();
+    workers_.clear();
+
+    ::close(listenFd_);
+    ::close(wakeFds_[0]);
+    ::close(wakeFds_[1]);
+    listenFd_ = wakeFds_[0] = wakeFds_[1] = -1;
+
+    unlink(config_.socketPath.c_str());
+}
+
+bool CEngineService::isRunning() const {
+    return running_;
+}
+
+LatencyHistogram CEngineService::getLatency() const {
+    std::lock_guard<std::mutex> lock(latencyMutex_);
+    return latency_;
+}
+
+std::size_t CEngineService::getSessionCount() const {
+    return sessionCount_;
+}
+
+void CEngineService::ioLoop() {
+    std::vector<pollfd> fds;
+
+    while (running_) {
+        fds.clear();
+        fds.push_back({ wakeFds_[0], POLLIN, 0 });
+        fds.push_back({ listenFd_, POLLIN, 0 });
+        for (auto &[fd, session] : sessions_) fds.push_back({ fd, POLLIN, 0 });
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        if (fds[0].revents) break;
+        if (fds[1].revents & POLLIN) CEngineService::acceptSessions();
+
+        for (std::size_t i = 2; i < fds.size(); ++i) {
+            if (!fds[i].revents) continue;
+
+            std::shared_ptr<Session> session = sessions_.at(fds[i].fd);
+            if (!CEngineService::readSession(session)) CEngineService::closeSession(session);
+        }
+    }
+
+    while (!sessions_.empty()) CEngineService::closeSession(sessions_.begin()->second);
+}
+
+void CEngineService::workerLoop() {
+    CBoard board;
+    CSearch search(tt_.get());
+
+    // The service ages the shared table, see GENERATION_REQUESTS_PER_WORKER
+    search.setShared(true);
+
+    while (true) {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueReady_.wait(lock, [&]() { return !queue_.empty() or !running_; });
+
+            if (queue_.empty()) return;
+
+            job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        Session &session = *job.session;
+        auto started = std::chrono::steady_clock::now();
+
+        if (++requests_ % (GENERATION_REQUESTS_PER_WORKER * config_.workers) == 0) tt_->newSearch();
+
+        {
+            std::lock_guard<std::mutex> lock(session.mutex);
+
+            if (session.closed) {
+                session.pending = false;
+                ::close(session.fd);
+                continue;
+            }
+
+            session.searcher = &search;
+        }
+
+        search.setCancelCheck([&session]() { return session.stopped.load(std::memory_order_relaxed); });
+
+        // The game was checked when the session set it, so setting it up again cannot fail
+        board.setFen(job.fen);
+        for (auto move : job.moves) board.makeMove(move);
+
+        SearchResult result = search.search(board, job.limits);
+
+        auto finished = std::chrono::steady_clock::now();
+        long long latency = microsecondsBetween(job.received, finished);
+
+        char bestMove[CMove::UCI_BUFFER_SIZE];
+        result.bestMove.toUci(bestMove);
+
+        std::ostringstream reply;
+        reply << "info depth " << result.depth << " score " << Uci::scoreToString(result.score)
+              << " nodes " << result.nodes << " time " << microsecondsBetween(started, finished) / 1000
+              << " queue " << microsecondsBetween(job.received, started) << " latency " << latency << "\n"
+              << "bestmove " << bestMove << "\n";
+
+        // Recorded first so the client sees its request counted once it has the reply
+        {
+            std::lock_guard<std::mutex> lock(latencyMutex_);
+            latency_.record(latency);
+        }
+
+        std::lock_guard<std::mutex> lock(session.mutex);
+        session.searcher = nullptr;
+        session.pending = false;
+
+        if (session.closed) ::close(session.fd);
+        else sendAll(session.fd, reply.str());
+    }
+}
+
+void CEngineService::acceptSessions() {
+    int fd = accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) return;
+
+    if (sessions_.size() >= config_.maxSessions) {
+        sendAll(fd, "info string Too many sessions\n");
+        ::close(fd);
+        return;
+    }
+
+    timeval timeout = { SEND_TIMEOUT_SECONDS, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    sessions_.emplace(fd, std::make_shared<Session>(fd));
+    ++sessionCount_;
+}
+
+bool CEngineService::readSession(const std::shared_ptr<Session> &session) {
+    char data[4096];
+    ssize_t length = read(session->fd, data, sizeof(data));
+
+    if (length < 0 and errno == EINTR) return true;
+    if (length <= 0) return false;
+
+    session->buffer.append(data, length);
+
+    std::size_t start = 0, end;
+
+    while ((end = session->buffer.find('\n', start)) != std::string::npos) {
+        std::string line = session->buffer.substr(start, end - start);
+        start = end + 1;
+
+        if (!line.empty() and line.back() == '\r') line.pop_back();
+        if (!CEngineService::handleCommand(session, line)) return false;
+    }
+
+    session->buffer.erase(0, start);
+
+    return session->buffer.size() <= MAX_LINE_LENGTH;
+}
+
+bool CEngineService::handleCommand(const std::shared_ptr<Session> &session, const std::string &line) {
+    std::istringstream ss(line);
+    std::string command;
+    ss >> command;
+
+    if (command.empty()) {
+        return true;
+    } else if (command == "uci") {
+        session->reply("id name ChessBot\nid author ChessBot developers\nuciok\n");
+    } else if (command == "isready") {
+        session->reply("readyok\n");
+    } else if (command == "ucinewgame") {
+        session->fen = START_FEN;
+        session->moves.clear();
+    } else if (command == "position") {
+        std::string fen;
+        std::vector<CMove> moves;
+
+        try {
+            Uci::setPosition(ss, &board_, &fen, &moves);
+            session->fen = std::move(fen);
+            session->moves = std::move(moves);
+        } catch (const std::invalid_argument &e) {
+            session->reply(std::string("info string ") + e.what() + "\n");
+        }
+    } else if (command == "go") {
+        CEngineService::queueSearch(session, ss);
+    } else if (command == "stop") {
+        std::lock_guard<std::mutex> lock(session->mutex);
+
+        if (session->pending) {
+            session->stopped = true;
+            if (session->searcher) session->searcher->stop();
+        }
+    } else if (command == "latency") {
+        session->reply("latency " + CEngineService::getLatency().toString() + "\n");
+    } else if (command == "quit") {
+        return false;
+    } else {
+        session->reply("info string Unknown command " + command + "\n");
+    }
+
+    return true;
+}
+
+void CEngineService::queueSearch(const std::shared_ptr<Session> &session, std::istream &in) {
+    Job job = { session, session->fen, session->moves, CEngineService::budget(Uci::parseLimits(in)), std::chrono::steady_clock::now() };
+
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+
+        if (session->pending) {
+            sendAll(session->fd, "info string Search already in progress\n");
+            return;
+        }
+
+        session->pending = true;
+        session->stopped = false;
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    queue_.push_back(std::move(job));
+    queueReady_.notify_one();
+}
+
+void CEngineService::closeSession(const std::shared_ptr<Session> &session) {
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        session->closed = true;
+
+        // A worker holding the session closes the socket when it is done with it
+        if (session->pending) {
+            session->stopped = true;
+            if (session->searcher) session->searcher->stop();
+        } else {
+            ::close(session->fd);
+        }
+    }
+
+    sessions_.erase(session->fd);
+    --sessionCount_;
+}
+
+SearchLimits CEngineService::budget(SearchLimits limits) const {
+    bool clock = limits.time[enumColour::white] > 0 or limits.time[enumColour::black] > 0;
+    bool limited = limits.depth < Constants::MAX_PLY - 1 or limits.nodes > 0 or limits.movetime > 0 or clock;
+
+    // A worker is never given a search which only ends on stop
+    if (limits.infinite or !limited) {
+        limits.infinite = false;
+        if (limits.movetime == 0) limits.movetime = config_.defaultMovetime;
+    }
+
+    // Searches on a clock are already bounded by their own time
+    if (config_.maxMovetime > 0 and !clock) {
+        limits.movetime = limits.movetime > 0 ? std::min(limits.movetime, config_.maxMovetime) : config_.maxMovetime;
+    }
+
+    if (config_.maxNodes > 0) limits.nodes = limits.nodes > 0 ? std::min(limits.nodes, config_.maxNodes) : config_.maxNodes;
+
+    return limits;
+}
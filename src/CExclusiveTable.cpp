@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <bit>
+
+#include "chessbot/CExclusiveTable.h"
+
+CExclusiveTable::CExclusiveTable(std::size_t slots) : size_(std::bit_floor(std::max<std::size_t>(slots, 1))) {
+    slots_ = std::make_unique<std::atomic<U64>[]>(size_);
+    CExclusiveTable::clear();
+}
+
+bool CExclusiveTable::isBusy(U64 key, CMove move) const {
+    U64 moveKey = CExclusiveTable::moveKey(key, move);
+    return CExclusiveTable::slotFor(moveKey).load(std::memory_order_relaxed) == moveKey;
+}
+
+void CExclusiveTable::enter(U64 key, CMove move) {
+    U64 moveKey = CExclusiveTable::moveKey(key, move);
+    CExclusiveTable::slotFor(moveKey).store(moveKey, std::memory_order_relaxed);
+}
+
+// Only clears the slot if it still holds this move, another one may have taken it over meanwhile
+void CExclusiveTable::leave(U64 key, CMove move) {
+    U64 moveKey = CExclusiveTable::moveKey(key, move);
+    CExclusiveTable::slotFor(moveKey).compare_exchange_strong(moveKey, 0ULL, std::memory_order_relaxed);
+}
+
+void CExclusiveTable::clear() {
+    for (std::size_t i = 0; i < size_; ++i) slots_[i].store(0ULL, std::memory_order_relaxed);
+}
+
+std::size_t CExclusiveTable::getSize() const {
+    return size_;
+}
+
+std::atomic<U64> &CExclusiveTable::slotFor(U64 moveKey) const {
+    return slots_[moveKey & (size_ - 1)];
+}
+
+// Never zero, which marks an empty slot
+U64 CExclusiveTable::moveKey(U64 key, CMove move) {
+    U64 bits = move.getFlags() << 12 | move.getFrom() << 6 | move.getTo();
+    U64 moveKey = key ^ (bits + 1) * 0x9E3779B97F4A7C15ULL;
+
+    return moveKey ? moveKey : 1ULL;
+}
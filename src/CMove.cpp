@@ -1,6 +1,44 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/CBoard.h"
 #include "chessbot/constants.h"
 #include "chessbot/CMove.h"
 
+// Indexed by enumPiece and by the low two bits of the promotion flags respectively
+constexpr char PIECE_LETTERS[] = "  PBNRQK";
+constexpr char PROMOTION_LETTERS[] = "NBRQ";
+
+// Each thread reuses one move list, so conversions stop allocating once it has grown
+static std::vector<CMove> *scratchMoves() {
+    thread_local std::vector<CMove> moves;
+    moves.clear();
+
+    return &moves;
+}
+
+static char *writeSquare(unsigned int square, char *p) {
+    *p++ = char('a' + square % 8);
+    *p++ = char('8' - square / 8);
+
+    return p;
+}
+
+// nWhite if c is not the letter of a piece other than a pawn
+static enumPiece sanPiece(char c) {
+    const char *letter = c != ' ' and c != 'P' ? std::strchr(PIECE_LETTERS, c) : nullptr;
+
+    return letter and *letter ? static_cast<enumPiece>(letter - PIECE_LETTERS) : enumPiece::nWhite;
+}
+
+static bool isCastle(unsigned int flags) {
+    return flags == Constants::KING_CASTLE_FLAG or flags == Constants::QUEEN_CASTLE_FLAG;
+}
+
 
 CMove::CMove(enumSquare from, enumSquare to, unsigned int flags) {
     auto fromUnsigned = unsigned(from);
@@ -40,3 +78,179 @@ void CMove::setFlags(unsigned int flags) {
 bool CMove::isCapture() const {
     return (getFlags() & Constants::CAPTURE_FLAG) != 0;
 }
+
+std::size_t CMove::toUci(char *buffer) const {
+    if (*this == CMove()) {
+        std::memcpy(buffer, "0000", 5);
+        return 4;
+    }
+
+    char *p = writeSquare(CMove::getFrom(), buffer);
+    p = writeSquare(CMove::getTo(), p);
+
+    if (CMove::getFlags() & Constants::PROMO_FLAG_MASK) *p++ = "nbrq"[CMove::getFlags() & 3];
+
+    *p = '\0';
+
+    return p - buffer;
+}
+
+std::size_t CMove::toSan(CBoard *board, char *buffer) const {
+    if (*this == CMove()) {
+        std::memcpy(buffer, "--", 3);
+        return 2;
+    }
+
+    char *p = buffer;
+    auto from = static_cast<enumSquare>(CMove::getFrom());
+    auto to = static_cast<enumSquare>(CMove::getTo());
+    unsigned int flags = CMove::getFlags();
+
+    if (flags == Constants::KING_CASTLE_FLAG) {
+        p = std::strcpy(p, "O-O") + 3;
+    } else if (flags == Constants::QUEEN_CASTLE_FLAG) {
+        p = std::strcpy(p, "O-O-O") + 5;
+    } else {
+        enumPiece piece = board->pieceTypeOn(from);
+
+        if (piece == enumPiece::nPawn) {
+            if (CMove::isCapture()) *p++ = char('a' + from % 8);
+        } else {
+            *p++ = PIECE_LETTERS[piece];
+
+            // Other pieces of the same kind which can legally reach the destination
+            U64 others = board->attackersTo(to, board->getOccupiedSquares())
+                       & board->getPieceSet(piece, static_cast<enumPiece>(board->getSideToMove()))
+                       & ~Bitboard::squareBB(from);
+
+            bool ambiguous = false, sameFile = false, sameRank = false;
+
+            for (auto square : Bitboard::squares(others)) {
+                if (!board->isLegal(CMove(square, to, flags))) continue;
+
+                ambiguous = true;
+                sameFile |= square % 8 == from % 8;
+                sameRank |= square / 8 == from / 8;
+            }
+
+            if (ambiguous and (!sameFile or sameRank)) *p++ = char('a' + from % 8);
+            if (ambiguous and sameFile) *p++ = char('8' - from / 8);
+        }
+
+        if (CMove::isCapture()) *p++ = 'x';
+        p = writeSquare(to, p);
+
+        if (flags & Constants::PROMO_FLAG_MASK) {
+            *p++ = '=';
+            *p++ = PROMOTION_LETTERS[flags & 3];
+        }
+    }
+
+    if (board->givesCheck(*this)) {
+        std::vector<CMove> *replies = scratchMoves();
+
+        board->makeMove(*this);
+        board->generateMoves(replies);
+        bool mate = std::none_of(replies->begin(), replies->end(), [board](CMove reply) { return board->isLegal(reply); });
+        board->unmakeMove(*this);
+
+        *p++ = mate ? '#' : '+';
+    }
+
+    *p = '\0';
+
+    return p - buffer;
+}
+
+CMove CMove::fromUci(const CBoard &board, std::string_view uci) {
+    enumSquare from = uci.size() >= 4 ? Constants::squareFromString(uci.substr(0, 2)) : enumSquare::no_sq;
+    enumSquare to = uci.size() >= 4 ? Constants::squareFromString(uci.substr(2, 2)) : enumSquare::no_sq;
+    const char *promotion = uci.size() == 5 ? std::strchr("nbrq", uci[4]) : nullptr;
+
+    if (from != enumSquare::no_sq and to != enumSquare::no_sq and (uci.size() == 4 or (uci.size() == 5 and promotion and *promotion))) {
+        std::vector<CMove> *moves = scratchMoves();
+        board.generateMoves(moves);
+
+        for (auto move : *moves) {
+            if (move.getFrom() != unsigned(from) or move.getTo() != unsigned(to)) continue;
+
+            bool promotes = move.getFlags() & Constants::PROMO_FLAG_MASK;
+            if (promotes != (uci.size() == 5) or (promotes and "nbrq"[move.getFlags() & 3] != uci[4])) continue;
+
+            if (board.isLegal(move)) return move;
+        }
+    }
+
+    throw std::invalid_argument("Illegal move: " + std::string(uci));
+}
+
+CMove CMove::fromSan(const CBoard &board, std::string_view san) {
+    std::string_view text = san;
+
+    while (!san.empty() and (san.back() == '+' or san.back() == '#' or san.back() == '!' or san.back() == '?')) {
+        san.remove_suffix(1);
+    }
+
+    std::vector<CMove> *moves = scratchMoves();
+    board.generateMoves(moves);
+
+    unsigned int castle = san == "O-O" or san == "0-0" ? Constants::KING_CASTLE_FLAG
+                        : san == "O-O-O" or san == "0-0-0" ? Constants::QUEEN_CASTLE_FLAG : 0;
+
+    if (castle) {
+        for (auto move : *moves) {
+            if (move.getFlags() == castle and board.isLegal(move)) return move;
+        }
+
+        throw std::invalid_argument("Illegal move: " + std::string(text));
+    }
+
+    enumPiece piece = enumPiece::nPawn;
+    if (!san.empty() and sanPiece(san.front()) != enumPiece::nWhite) {
+        piece = sanPiece(san.front());
+        san.remove_prefix(1);
+    }
+
+    // The promotion piece, with or without the '='
+    int promotion = -1;
+    if (!san.empty() and sanPiece(san.back()) != enumPiece::nWhite) {
+        const char *letter = std::strchr(PROMOTION_LETTERS, san.back());
+        promotion = letter ? int(letter - PROMOTION_LETTERS) : 4;
+        san.remove_suffix(1);
+        if (!san.empty() and san.back() == '=') san.remove_suffix(1);
+    }
+
+    enumSquare to = san.size() >= 2 ? Constants::squareFromString(san.substr(san.size() - 2)) : enumSquare::no_sq;
+    if (to == enumSquare::no_sq) throw std::invalid_argument("Invalid move: " + std::string(text));
+
+    // Whatever precedes the destination disambiguates by file, rank or both
+    int fromFile = -1;
+    int fromRow = -1;
+
+    for (char c : san.substr(0, san.size() - 2)) {
+        if (c >= 'a' and c <= 'h') fromFile = c - 'a';
+        else if (c >= '1' and c <= '8') fromRow = '8' - c;
+        else if (c != 'x' and c != ':' and c != '-') throw std::invalid_argument("Invalid move: " + std::string(text));
+    }
+
+    CMove found;
+    int matches = 0;
+
+    for (auto move : *moves) {
+        bool promotes = move.getFlags() & Constants::PROMO_FLAG_MASK;
+
+        if (move.getTo() != unsigned(to) or isCastle(move.getFlags())) continue;
+        if (board.pieceTypeOn(static_cast<enumSquare>(move.getFrom())) != piece) continue;
+        if (promotes != (promotion >= 0) or (promotes and int(move.getFlags() & 3) != promotion)) continue;
+        if ((fromFile >= 0 and int(move.getFrom() % 8) != fromFile) or (fromRow >= 0 and int(move.getFrom() / 8) != fromRow)) continue;
+        if (!board.isLegal(move)) continue;
+
+        found = move;
+        ++matches;
+    }
+
+    if (matches == 0) throw std::invalid_argument("Illegal move: " + std::string(text));
+    if (matches > 1) throw std::invalid_argument("Ambiguous move: " + std::string(text));
+
+    return found;
+}
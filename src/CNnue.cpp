@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+#include "chessbot/CNnue.h"
+#include "chessbot/parallel.h"
+#include "chessbot/simd.h"
+
+using Simd::FloatVector;
+using Simd::Int16Vector;
+using Simd::FLOAT_LANES;
+using Simd::INT16_LANES;
+using Simd::VECTOR_BYTES;
+using Simd::loadVector;
+using Simd::storeVector;
+
+constexpr int INPUTS = 2 * CNnue::L1;
+
+// Copies of each first layer input in a tile, spread across a vector where broadcasting costs a shuffle
+// AVX broadcasts straight from memory, so needs none
+constexpr int SPREAD_LANES = VECTOR_BYTES == 16 ? FLOAT_LANES : 1;
+
+// Positions sharing each weight load in the dense layers
+constexpr int TILE_ROWS = 4;
+
+// Vector sums a tile keeps in registers, about half the register file
+#ifdef __AVX512F__
+constexpr int TILE_REGISTERS = 16;
+#else
+constexpr int TILE_REGISTERS = 8;
+#endif
+
+// Each position costs about 1us through the dense layers, so starting a thread (about 10us) is a few percent
+// of a slice this long, while batches of a few thousand still spread over every core
+constexpr std::size_t MIN_THREAD_POSITIONS = 256;
+
+constexpr U64 NETWORK_MAGIC = 0x3145554e4e544f42ULL;
+constexpr uint32_t NETWORK_VERSION = 1;
+
+struct NetworkHeader {
+    U64 magic;
+    uint32_t version;
+    uint32_t features;
+    uint32_t l1;
+    uint32_t l2;
+    uint32_t l3;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(NetworkHeader) == 32);
+
+static FloatVector clippedRelu(FloatVector value) {
+    const FloatVector zero = {};
+    const FloatVector one = zero + 1.0f;
+
+    value = value < zero ? zero : value;
+    return value > one ? one : value;
+}
+
+// outputs = clippedRelu(biases + inputs x weights) for ROWS positions, weights input-major
+// Works through CHUNK output vectors at a time, so each weight vector loaded is multiplied into every position
+// of the tile while the sums of the whole tile stay in registers
+// Spread inputs hold each value in every lane of a vector, a load instead of a shuffle for each multiply
+template <int ROWS, int IN, int OUT, bool SPREAD>
+static void affine(const float *inputs, const float *weights, const float *biases, float *outputs) {
+    constexpr int VECTORS = OUT / FLOAT_LANES;
+    constexpr int CHUNK = std::clamp(TILE_REGISTERS / ROWS, 1, VECTORS);
+
+    for (int chunk = 0; chunk < VECTORS; chunk += CHUNK) {
+        FloatVector sums[ROWS][CHUNK];
+
+        for (int row = 0; row < ROWS; ++row) {
+            for (int v = 0; v < CHUNK; ++v) sums[row][v] = loadVector<FloatVector>(biases + (chunk + v) * FLOAT_LANES);
+        }
+
+        for (int i = 0; i < IN; ++i) {
+            FloatVector column[CHUNK];
+            for (int v = 0; v < CHUNK; ++v) column[v] = loadVector<FloatVector>(weights + i * OUT + (chunk + v) * FLOAT_LANES);
+
+            for (int row = 0; row < ROWS; ++row) {
+                FloatVector input;
+                if constexpr (SPREAD) input = loadVector<FloatVector>(inputs + (row * IN + i) * FLOAT_LANES);
+                else input = FloatVector{} + inputs[row * IN + i];
+
+                for (int v = 0; v < CHUNK; ++v) sums[row][v] += input * column[v];
+            }
+        }
+
+        for (int row = 0; row < ROWS; ++row) {
+            for (int v = 0; v < CHUNK; ++v) {
+                storeVector(outputs + row * OUT + (chunk + v) * FLOAT_LANES, clippedRelu(sums[row][v]));
+            }
+        }
+    }
+}
+
+template <typename T>
+static bool readArray(std::istream &file, std::vector<T> *values) {
+    return static_cast<bool>(file.read(reinterpret_cast<char *>(values->data()), values->size() * sizeof(T)));
+}
+
+template <typename T>
+static void writeArray(std::ostream &file, const std::vector<T> &values) {
+    file.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+CNnue::CNnue()
+    : ftWeights_(Nnue::HALFKP_FEATURES * L1, 0), ftBiases_(L1, 0), l1Weights_(INPUTS * L2, 0.0f), l1Biases_(L2, 0.0f),
+      l2Weights_(L2 * L3, 0.0f), l2Biases_(L3, 0.0f), outWeights_(L3, 0.0f), outBias_(0.0f) {}
+
+CNnue::CNnue(const std::string &path) : CNnue() {
+    if (!CNnue::load(path)) throw std::invalid_argument("Could not load network " + path);
+}
+
+bool CNnue::load(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    NetworkHeader header;
+
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))) return false;
+    if (header.magic != NETWORK_MAGIC or header.version != NETWORK_VERSION) return false;
+    if (header.features != Nnue::HALFKP_FEATURES or header.l1 != L1 or header.l2 != L2 or header.l3 != L3) return false;
+
+    // Read into a copy, so a truncated file leaves the network as it was
+    CNnue network;
+
+    bool read = readArray(file, &network.ftBiases_) and readArray(file, &network.ftWeights_) and
+                readArray(file, &network.l1Biases_) and readArray(file, &network.l1Weights_) and
+                readArray(file, &network.l2Biases_) and readArray(file, &network.l2Weights_) and
+                file.read(reinterpret_cast<char *>(&network.outBias_), sizeof(float)) and
+                readArray(file, &network.outWeights_);
+
+    if (!read or file.peek() != std::ifstream::traits_type::eof()) return false;
+
+    *this = std::move(network);
+    return true;
+}
+
+bool CNnue::save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    NetworkHeader header = { NETWORK_MAGIC, NETWORK_VERSION, Nnue::HALFKP_FEATURES, L1, L2, L3, 0 };
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    writeArray(file, ftBiases_);
+    writeArray(file, ftWeights_);
+    writeArray(file, l1Biases_);
+    writeArray(file, l1Weights_);
+    writeArray(file, l2Biases_);
+    writeArray(file, l2Weights_);
+    file.write(reinterpret_cast<const char *>(&outBias_), sizeof(float));
+    writeArray(file, outWeights_);
+
+    return static_cast<bool>(file);
+}
+
+void CNnue::randomise(U64 seed) {
+    std::mt19937_64 random(seed);
+
+    // About a third of the accumulator ends up between the clipping points
+    std::uniform_int_distribution<int> ftWeight(-24, 24), ftBias(0, 2 * FT_SCALE);
+    for (auto &weight : ftWeights_) weight = ftWeight(random);
+    for (auto &bias : ftBiases_) bias = ftBias(random);
+
+    auto uniform = [&](std::vector<float> &values, float scale) {
+        std::uniform_real_distribution<float> distribution(-scale, scale);
+        for (auto &value : values) value = distribution(random);
+    };
+
+    uniform(l1Weights_, 1.0f / std::sqrt(static_cast<float>(INPUTS)));
+    uniform(l1Biases_, 0.5f);
+    uniform(l2Weights_, 1.0f / std::sqrt(static_cast<float>(L2)));
+    uniform(l2Biases_, 0.5f);
+    uniform(outWeights_, 100.0f);
+    outBias_ = 0.0f;
+}
+
+bool CNnue::accumulate(const CBoard &board, enumColour perspective, int16_t *accumulator) const {
+    constexpr int VECTORS = L1 / INT16_LANES;
+
+    // Bounded by MAX_ACTIVE, and every feature is a row of ftWeights_ once the board is accepted
+    int32_t features[Nnue::MAX_ACTIVE];
+    int active = Nnue::activeFeatures(board.getPieceSets(), perspective, Nnue::halfKP, features);
+    if (active < 0) return false;
+
+    Int16Vector sums[VECTORS];
+    for (int v = 0; v < VECTORS; ++v) sums[v] = loadVector<Int16Vector>(ftBiases_.data() + v * INT16_LANES);
+
+    for (int f = 0; f < active; ++f) {
+        const int16_t *row = ftWeights_.data() + static_cast<std::size_t>(features[f]) * L1;
+        for (int v = 0; v < VECTORS; ++v) sums[v] += loadVector<Int16Vector>(row + v * INT16_LANES);
+    }
+
+    for (int v = 0; v < VECTORS; ++v) storeVector(accumulator + v * INT16_LANES, sums[v]);
+    return true;
+}
+
+bool CNnue::transform(const CBoard &board, float *input, int lanes) const {
+    int16_t accumulators[2][L1];
+
+    enumColour us = board.getSideToMove();
+
+    // The check does not depend on the perspective, so the second accumulate cannot fail once the first has not
+    if (!CNnue::accumulate(board, us, accumulators[0])) {
+        std::fill_n(input, INPUTS * lanes, 0.0f);
+        return false;
+    }
+
+    CNnue::accumulate(board, us == enumColour::white ? enumColour::black : enumColour::white, accumulators[1]);
+
+    for (int side = 0; side < 2; ++side) {
+        for (int i = 0; i < L1; ++i) {
+            float value = std::clamp(static_cast<int>(accumulators[side][i]), 0, FT_SCALE) * (1.0f / FT_SCALE);
+            std::fill_n(input + (side * L1 + i) * lanes, lanes, value);
+        }
+    }
+
+    return true;
+}
+
+template <int ROWS>
+void CNnue::propagate(const float *input, int *scores) const {
+    float hidden1[ROWS * L2];
+    float hidden2[ROWS * L3];
+
+    affine<ROWS, INPUTS, L2, ROWS != 1 and SPREAD_LANES != 1>(input, l1Weights_.data(), l1Biases_.data(), hidden1);
+    affine<ROWS, L2, L3, false>(hidden1, l2Weights_.data(), l2Biases_.data(), hidden2);
+
+    for (int row = 0; row < ROWS; ++row) {
+        FloatVector sum = {};
+        for (int v = 0; v < L3 / FLOAT_LANES; ++v) {
+            sum += loadVector<FloatVector>(hidden2 + row * L3 + v * FLOAT_LANES) * loadVector<FloatVector>(outWeights_.data() + v * FLOAT_LANES);
+        }
+
+        float output = outBias_;
+        for (int lane = 0; lane < FLOAT_LANES; ++lane) output += sum[lane];
+
+        scores[row] = static_cast<int>(std::lround(output));
+    }
+}
+
+int CNnue::evaluate(const CBoard &board) const {
+    float input[INPUTS];
+    int score;
+
+    if (!CNnue::transform(board, input, 1)) throw std::invalid_argument("Board has no valid NNUE features");
+    CNnue::propagate<1>(input, &score);
+
+    return score;
+}
+
+void CNnue::evaluate(const CBoard *boards, std::size_t count, int *scores, int threads) const {
+    // Set by any thread which meets a rejected board, thrown once they have all joined
+    std::atomic<bool> rejected = false;
+
+    auto evaluateSlice = [&](std::size_t begin, std::size_t end) {
+        float inputs[TILE_ROWS * INPUTS * SPREAD_LANES];
+        bool valid = true;
+        std::size_t i = begin;
+
+        for (; i + TILE_ROWS <= end; i += TILE_ROWS) {
+            for (int row = 0; row < TILE_ROWS; ++row) {
+                valid &= CNnue::transform(boards[i + row], inputs + row * INPUTS * SPREAD_LANES, SPREAD_LANES);
+            }
+
+            CNnue::propagate<TILE_ROWS>(inputs, scores + i);
+        }
+
+        for (; i < end; ++i) {
+            valid &= CNnue::transform(boards[i], inputs, 1);
+            CNnue::propagate<1>(inputs, scores + i);
+        }
+
+        if (!valid) rejected = true;
+    };
+
+    Parallel::forSlices(count, threads, MIN_THREAD_POSITIONS, evaluateSlice);
+
+    if (rejected) throw std::invalid_argument("Board has no valid NNUE features");
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <thread>
+
+#include "chessbot/CParallelSearch.h"
+
+CParallelSearch::CParallelSearch(CTranspositionTable *tt, int threads, enumSmpMode mode) : tt_(tt), mode_(mode), done_(false), stopped_(false) {
+    CParallelSearch::setThreads(threads);
+}
+
+SearchResult CParallelSearch::search(CBoard &board, const SearchLimits &limits) {
+    CSearch &main = *searches_[0];
+
+    if (searches_.size() == 1) {
+        main.setShared(false);
+        main.setExclusiveTable(nullptr);
+        return main.search(board, limits);
+    }
+
+    CExclusiveTable *exclusive = mode_ == enumSmpMode::smpAbdada ? &exclusive_ : nullptr;
+    if (exclusive) exclusive->clear();
+
+    tt_->newSearch();
+    done_ = false;
+
+    for (auto &search : searches_) {
+        search->setShared(true);
+        search->setExclusiveTable(exclusive);
+    }
+
+    // Checked when a helper starts, so one starting after the main thread is done returns at once
+    std::vector<std::thread> helpers;
+    for (std::size_t i = 1; i < searches_.size(); ++i) {
+        helpers.emplace_back([this, i, board, limits]() mutable { searches_[i]->search(board, limits); });
+    }
+
+    SearchResult result = main.search(board, limits);
+
+    done_ = true;
+    for (auto &helper : helpers) helper.join();
+
+    result.nodes = 0;
+    for (auto &search : searches_) result.nodes += search->getNodes();
+
+    return result;
+}
+
+void CParallelSearch::stop() {
+    stopped_ = true;
+    searches_[0]->stop();
+}
+
+void CParallelSearch::resetStop() {
+    stopped_ = false;
+}
+
+void CParallelSearch::clearHistory() {
+    for (auto &search : searches_) search->clearHistory();
+}
+
+void CParallelSearch::setInfoCallback(std::function<void(const SearchInfo &)> callback) {
+    infoCallback_ = callback;
+    searches_[0]->setInfoCallback(callback);
+}
+
+void CParallelSearch::setTablebases(const TablebaseConfig &config) {
+    tbConfig_ = config;
+    for (auto &search : searches_) search->setTablebases(config);
+}
+
+void CParallelSearch::setThreads(int threads) {
+    searches_.resize(std::max(1, threads));
+
+    for (std::size_t i = 0; i < searches_.size(); ++i) {
+        if (searches_[i]) continue;
+
+        searches_[i] = std::make_unique<CSearch>(tt_);
+        searches_[i]->setTablebases(tbConfig_);
+
+        // The main thread's own stop flag is cleared when its search starts, so it also polls stopped_
+        if (i == 0) {
+            searches_[i]->setInfoCallback(infoCallback_);
+            searches_[i]->setCancelCheck([this]() { return stopped_.load(std::memory_order_relaxed); });
+        } else {
+            searches_[i]->setCancelCheck([this]() { return done_.load(std::memory_order_relaxed); });
+        }
+    }
+}
+
+void CParallelSearch::setMode(enumSmpMode mode) {
+    mode_ = mode;
+}
+
+int CParallelSearch::getThreads() const {
+    return searches_.size();
+}
+
+enumSmpMode CParallelSearch::getMode() const {
+    return mode_;
+}
+
+const SearchStats &CParallelSearch::getStats() const {
+    return searches_[0]->getStats();
+}
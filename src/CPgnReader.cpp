@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/CPgnReader.h"
+#include "chessbot/pgn.h"
+
+// Pages are released once this much has been read past them
+constexpr std::ptrdiff_t RELEASE_BYTES = 64 << 20;
+
+static bool isBlank(const char *start, const char *end) {
+    return std::all_of(start, end, [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+}
+
+static const char *nextLine(const char *p, const char *end) {
+    auto newline = static_cast<const char *>(std::memchr(p, '\n', end - p));
+    return newline ? newline + 1 : end;
+}
+
+// Drops the whole pages between *released and cursor from memory, rereading them faults them back in from the file
+static void releasePages(const char **released, const char *cursor) {
+    if (cursor - *released < RELEASE_BYTES) return;
+
+    static const std::uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+    std::uintptr_t start = (reinterpret_cast<std::uintptr_t>(*released) + pageSize - 1) & ~(pageSize - 1);
+    std::uintptr_t stop = reinterpret_cast<std::uintptr_t>(cursor) & ~(pageSize - 1);
+
+    if (stop > start) madvise(reinterpret_cast<void *>(start), stop - start, MADV_DONTNEED);
+
+    *released = cursor;
+}
+
+std::string_view PgnGame::tag(std::string_view name) const {
+    std::size_t line = 0;
+
+    while (line < tags.size()) {
+        std::size_t end = tags.find('\n', line);
+        if (end == std::string_view::npos) end = tags.size();
+
+        // [Name "value"]
+        std::string_view pair = tags.substr(line, end - line);
+        std::size_t open = pair.find('"');
+
+        if (pair.size() > name.size() + 1 and pair[0] == '[' and pair.substr(1, name.size()) == name
+            and std::isspace(static_cast<unsigned char>(pair[name.size() + 1])) and open != std::string_view::npos) {
+            std::size_t close = open + 1;
+
+            while (close < pair.size() and pair[close] != '"') close += pair[close] == '\\' ? 2 : 1;
+
+            return pair.substr(open + 1, std::min(close, pair.size()) - open - 1);
+        }
+
+        line = end + 1;
+    }
+
+    return {};
+}
+
+double PgnStats::gamesPerSecond() const {
+    return seconds > 0.0 ? games / seconds : 0.0;
+}
+
+CPgnReader::CPgnReader() : data_(nullptr), length_(0), cursor_(nullptr), released_(nullptr) {}
+
+CPgnReader::CPgnReader(const std::string &path) : CPgnReader() {
+    if (!CPgnReader::open(path)) throw std::invalid_argument("Could not open PGN file " + path);
+}
+
+CPgnReader::~CPgnReader() {
+    CPgnReader::close();
+}
+
+bool CPgnReader::open(const std::string &path) {
+    CPgnReader::close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // An empty file has no games but cannot be mapped
+    if (info.st_size > 0) {
+        void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+
+        madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+
+        data_ = static_cast<const char *>(mapping);
+        length_ = info.st_size;
+    } else {
+        data_ = "";
+    }
+
+    ::close(fd);
+    CPgnReader::rewind();
+
+    return true;
+}
+
+void CPgnReader::close() {
+    if (length_) munmap(const_cast<char *>(data_), length_);
+
+    data_ = nullptr;
+    length_ = 0;
+    cursor_ = nullptr;
+    released_ = nullptr;
+}
+
+bool CPgnReader::isOpen() const {
+    return data_ != nullptr;
+}
+
+std::size_t CPgnReader::size() const {
+    return length_;
+}
+
+bool CPgnReader::nextGame(PgnGame *game) {
+    if (!data_) return false;
+
+    releasePages(&released_, cursor_);
+
+    return CPgnReader::splitGame(&cursor_, data_ + length_, game);
+}
+
+void CPgnReader::rewind() {
+    cursor_ = data_;
+    released_ = data_;
+
+    // Skip a UTF-8 byte order mark
+    if (length_ >= 3 and std::memcmp(data_, "\xEF\xBB\xBF", 3) == 0) cursor_ += 3;
+}
+
+bool CPgnReader::parseGame(const PgnGame &game, CBoard *board, std::vector<CMove> *moves) {
+    moves->clear();
+
+    std::string_view fen = game.tag("FEN");
+
+    try {
+        board->setFen(fen.empty() ? Pgn::START_FEN : std::string(fen));
+
+        // Move generation assumes one king each
+        if (Bitboard::popcount(board->getPieceSet(enumPiece::nKing, enumPiece::nWhite)) != 1
+            or Bitboard::popcount(board->getPieceSet(enumPiece::nKing, enumPiece::nBlack)) != 1) {
+            return false;
+        }
+
+        Pgn::parseMovetext(game.movetext, board, moves);
+    } catch (const std::invalid_argument &) {
+        return false;
+    }
+
+    return true;
+}
+
+PgnStats CPgnReader::forEachGame(const GameCallback &callback, int threads) const {
+    PgnStats stats;
+    if (!data_) return stats;
+
+    auto start = std::chrono::steady_clock::now();
+    const char *begin = data_ + (length_ >= 3 and std::memcmp(data_, "\xEF\xBB\xBF", 3) == 0 ? 3 : 0);
+    const char *end = data_ + length_;
+
+    // Equal slices of the file, each moved forward to the next game boundary
+    threads = std::max(1, threads);
+    std::vector<const char *> bounds = { begin };
+
+    for (int i = 1; i < threads; ++i) {
+        const char *split = std::max(bounds.back(), begin + (end - begin) * i / threads);
+        bounds.push_back(split == begin ? begin : CPgnReader::nextGameStart(split, end));
+    }
+
+    bounds.push_back(end);
+
+    std::atomic<U64> games = 0, malformed = 0, moves = 0;
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i]() {
+            const char *cursor = bounds[i];
+            const char *released = bounds[i];
+            U64 threadGames = 0, threadMalformed = 0, threadMoves = 0;
+
+            CBoard board;
+            std::vector<CMove> gameMoves;
+            PgnGame game;
+
+            while (CPgnReader::splitGame(&cursor, bounds[i + 1], &game)) {
+                releasePages(&released, data_ + game.offset);
+
+                if (!CPgnReader::parseGame(game, &board, &gameMoves)) {
+                    ++threadMalformed;
+                    continue;
+                }
+
+                for (auto it = gameMoves.rbegin(); it != gameMoves.rend(); ++it) board.unmakeMove(*it);
+
+                callback(game, gameMoves, &board);
+
+                ++threadGames;
+                threadMoves += gameMoves.size();
+            }
+
+            games += threadGames;
+            malformed += threadMalformed;
+            moves += threadMoves;
+        });
+    }
+
+    for (auto &worker : workers) worker.join();
+
+    stats.games = games;
+    stats.malformed = malformed;
+    stats.moves = moves;
+    stats.bytes = length_;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return stats;
+}
+
+const char *CPgnReader::nextGameStart(const char *p, const char *end) {
+    // The line containing p may be partial, so it never counts as blank
+    bool previousBlank = false;
+    p = nextLine(p, end);
+
+    while (p < end) {
+        if (*p == '[' and previousBlank) return p;
+
+        const char *next = nextLine(p, end);
+        previousBlank = isBlank(p, next);
+        p = next;
+    }
+
+    return end;
+}
+
+bool CPgnReader::splitGame(const char **cursor, const char *end, PgnGame *game) const {
+    const char *p = *cursor;
+
+    while (p < end and std::isspace(static_cast<unsigned char>(*p))) ++p;
+    if (p >= end) {
+        *cursor = end;
+        return false;
+    }
+
+    const char *tagsStart = p;
+    while (p < end and *p == '[') p = nextLine(p, end);
+
+    const char *tagsEnd = p;
+    while (p < end and std::isspace(static_cast<unsigned char>(*p))) ++p;
+
+    // A tag section straight after this one belongs to the next game
+    const char *movetextStart = p;
+    const char *movetextEnd = p < end and *p != '[' ? CPgnReader::nextGameStart(p, end) : p;
+
+    game->tags = std::string_view(tagsStart, tagsEnd - tagsStart);
+    game->movetext = std::string_view(movetextStart, movetextEnd - movetextStart);
+    game->offset = tagsStart - data_;
+
+    *cursor = movetextEnd;
+
+    return true;
+}
@@ -0,0 +1,299 @@
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/constants.h"
+#include "chessbot/CPolyglotBook.h"
+#include "chessbot/polyglot_random.h"
+
+constexpr std::size_t ENTRY_SIZE = 16;
+constexpr int CASTLING_OFFSET = 768;
+constexpr int EN_PASSANT_OFFSET = 772;
+constexpr int TURN_OFFSET = 780;
+
+// Polyglot piece kinds are ordered pawn, knight, bishop, rook, queen, king with Black first
+constexpr std::array<int, 8> POLYGLOT_KIND = { 0, 0, 0, 4, 2, 6, 8, 10 };
+
+// Big-endian field of width bytes starting at p
+static U64 readBigEndian(const unsigned char *p, int bytes) {
+    U64 value = 0;
+
+    for (int i = 0; i < bytes; ++i) value = (value << 8) | p[i];
+
+    return value;
+}
+
+CPolyglotBook::CPolyglotBook() : data_(nullptr), length_(0), entries_(0) {}
+
+CPolyglotBook::CPolyglotBook(const std::string &path) : CPolyglotBook() {
+    if (!CPolyglotBook::open(path)) throw std::invalid_argument("Could not open Polyglot book " + path);
+}
+
+CPolyglotBook::~CPolyglotBook() {
+    CPolyglotBook::close();
+}
+
+bool CPolyglotBook::open(const std::string &path) {
+    CPolyglotBook::close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 or info.st_size == 0 or info.st_size % ENTRY_SIZE != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) return false;
+
+    // Binary search touches a handful of scattered pages, readahead would only waste memory
+    madvise(mapping, info.st_size, MADV_RANDOM);
+
+    data_ = static_cast<const unsigned char *>(mapping);
+    length_ = info.st_size;
+    entries_ = length_ / ENTRY_SIZE;
+
+    return true;
+}
+
+void CPolyglotBook::close() {
+    if (data_) munmap(const_cast<unsigned char *>(data_), length_);
+
+    data_ = nullptr;
+    length_ = 0;
+    entries_ = 0;
+}
+
+bool CPolyglotBook::isOpen() const {
+    return data_ != nullptr;
+}
+
+std::size_t CPolyglotBook::size() const {
+    return entries_;
+}
+
+U64 CPolyglotBook::computeKey(const CBoard &board) {
+    U64 key = 0ULL;
+
+    for (int colour = enumPiece::nWhite; colour <= enumPiece::nBlack; ++colour) {
+        for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+            int kind = POLYGLOT_KIND[piece] + (colour == enumPiece::nWhite);
+
+            // Polyglot numbers squares from a1, flipping the rank converts from a8
+            for (auto square : Bitboard::squares(board.getPieceSet(static_cast<enumPiece>(piece), static_cast<enumPiece>(colour)))) {
+                key ^= Polyglot::RANDOM64[64 * kind + (square ^ 56)];
+            }
+        }
+    }
+
+    int castling = board.getCastleState();
+    if (castling & Constants::WHITE_KINGSIDE_CASTLE) key ^= Polyglot::RANDOM64[CASTLING_OFFSET];
+    if (castling & Constants::WHITE_QUEENSIDE_CASTLE) key ^= Polyglot::RANDOM64[CASTLING_OFFSET + 1];
+    if (castling & Constants::BLACK_KINGSIDE_CASTLE) key ^= Polyglot::RANDOM64[CASTLING_OFFSET + 2];
+    if (castling & Constants::BLACK_QUEENSIDE_CASTLE) key ^= Polyglot::RANDOM64[CASTLING_OFFSET + 3];
+
+    bool white = board.getSideToMove() == enumColour::white;
+    enumSquare enPassant = board.getEnPassantSquare();
+
+    if (enPassant != enumSquare::no_sq) {
+        U64 target = Bitboard::squareBB(enPassant);
+        U64 capturers = white ? Bitboard::shiftSouthEast(target) | Bitboard::shiftSouthWest(target)
+                              : Bitboard::shiftNorthEast(target) | Bitboard::shiftNorthWest(target);
+        auto us = white ? enumPiece::nWhite : enumPiece::nBlack;
+
+        if (capturers & board.getPieceSet(enumPiece::nPawn, us)) key ^= Polyglot::RANDOM64[EN_PASSANT_OFFSET + enPassant % 8];
+    }
+
+    if (white) key ^= Polyglot::RANDOM64[TURN_OFFSET];
+
+    return key;
+}
+
+int CPolyglotBook::probe(const CBoard &board, CMove *moves, uint16_t *weights, int maxMoves) const {
+    if (!data_) return 0;
+
+    U64 key = CPolyglotBook::computeKey(board);
+    int count = 0;
+
+    for (std::size_t i = CPolyglotBook::lowerBound(key); i < entries_ and count < maxMoves and CPolyglotBook::keyAt(i) == key; ++i) {
+        CMove move = CPolyglotBook::decodeMove(board, CPolyglotBook::moveAt(i));
+        if (move == CMove()) continue;
+
+        moves[count] = move;
+        weights[count] = CPolyglotBook::weightAt(i);
+        ++count;
+    }
+
+    return count;
+}
+
+CMove CPolyglotBook::bestMove(const CBoard &board) const {
+    CMove moves[CPolyglotBook::MAX_MOVES];
+    uint16_t weights[CPolyglotBook::MAX_MOVES];
+    int count = CPolyglotBook::probe(board, moves, weights, CPolyglotBook::MAX_MOVES);
+
+    CMove best;
+    int bestWeight = -1;
+
+    for (int i = 0; i < count; ++i) {
+        if (weights[i] > bestWeight) {
+            best = moves[i];
+            bestWeight = weights[i];
+        }
+    }
+
+    return best;
+}
+
+CMove CPolyglotBook::weightedMove(const CBoard &board, U64 random) const {
+    CMove moves[CPolyglotBook::MAX_MOVES];
+    uint16_t weights[CPolyglotBook::MAX_MOVES];
+    int count = CPolyglotBook::probe(board, moves, weights, CPolyglotBook::MAX_MOVES);
+
+    U64 total = 0;
+    for (int i = 0; i < count; ++i) total += weights[i];
+
+    // Every move has zero weight, fall back to the first one
+    if (total == 0) return count > 0 ? moves[0] : CMove();
+
+    U64 pick = random % total;
+
+    for (int i = 0; i < count; ++i) {
+        if (pick < weights[i]) return moves[i];
+        pick -= weights[i];
+    }
+
+    return CMove();
+}
+
+std::size_t CPolyglotBook::lowerBound(U64 key) const {
+    std::size_t low = 0;
+    std::size_t high = entries_;
+
+    while (low < high) {
+        std::size_t mid = low + (high - low) / 2;
+
+        if (CPolyglotBook::keyAt(mid) < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+U64 CPolyglotBook::keyAt(std::size_t index) const {
+    return readBigEndian(data_ + index * ENTRY_SIZE, 8);
+}
+
+uint16_t CPolyglotBook::moveAt(std::size_t index) const {
+    return readBigEndian(data_ + index * ENTRY_SIZE + 8, 2);
+}
+
+uint16_t CPolyglotBook::weightAt(std::size_t index) const {
+    return readBigEndian(data_ + index * ENTRY_SIZE + 10, 2);
+}
+
+U64 CPolyglotBook::reachableSquares(const CBoard &board, enumSquare from) {
+    auto us = board.pieceColourOn(from);
+    auto them = us == enumPiece::nWhite ? enumPiece::nBlack : enumPiece::nWhite;
+    U64 occupied = board.getOccupiedSquares();
+    U64 friendly = board.getPieceSet(us);
+
+    switch (board.pieceTypeOn(from)) {
+        case enumPiece::nKnight:
+            return board.getKnightMoveset(from, friendly);
+        case enumPiece::nBishop:
+            return board.getBishopMoveset(from, occupied, friendly);
+        case enumPiece::nRook:
+            return board.getRookMoveset(from, occupied, friendly);
+        case enumPiece::nQueen:
+            return board.getQueenMoveset(from, occupied, friendly);
+        case enumPiece::nKing:
+            return board.getKingMoveset(from, friendly);
+        case enumPiece::nPawn: {
+            bool white = us == enumPiece::nWhite;
+            U64 fromBB = Bitboard::squareBB(from);
+            U64 targets = board.getPieceSet(them);
+
+            if (board.getEnPassantSquare() != enumSquare::no_sq) targets |= Bitboard::squareBB(board.getEnPassantSquare());
+
+            U64 single = (white ? Bitboard::shiftNorth(fromBB) : Bitboard::shiftSouth(fromBB)) & ~occupied;
+            U64 twice = (white ? Bitboard::shiftNorth(single) & Constants::RANK_4 : Bitboard::shiftSouth(single) & Constants::RANK_5) & ~occupied;
+            U64 captures = white ? Bitboard::shiftNorthEast(fromBB) | Bitboard::shiftNorthWest(fromBB)
+                                 : Bitboard::shiftSouthEast(fromBB) | Bitboard::shiftSouthWest(fromBB);
+
+            return single | twice | (captures & targets);
+        }
+        default:
+            return 0ULL;
+    }
+}
+
+CMove CPolyglotBook::decodeMove(const CBoard &board, uint16_t move) {
+    // Files and rows count from a1
+    int toFile = move & 0x7;
+    int toRow = (move >> 3) & 0x7;
+    int fromFile = (move >> 6) & 0x7;
+    int fromRow = (move >> 9) & 0x7;
+    int promotion = (move >> 12) & 0x7;
+
+    auto from = static_cast<enumSquare>((7 - fromRow) * 8 + fromFile);
+    auto to = static_cast<enumSquare>((7 - toRow) * 8 + toFile);
+
+    auto us = board.getSideToMove() == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+    enumPiece moving = board.pieceTypeOn(from);
+
+    if (board.pieceOn(from) == Constants::NO_PIECE or board.pieceColourOn(from) != us) return CMove();
+
+    unsigned int flags = Constants::QUIET_FLAG;
+
+    if (moving == enumPiece::nKing and board.pieceOn(to) != Constants::NO_PIECE and board.pieceColourOn(to) == us) {
+        // Castling is written as the king capturing its own rook
+        if (board.pieceTypeOn(to) != enumPiece::nRook) return CMove();
+
+        bool kingside = to > from;
+        flags = kingside ? Constants::KING_CASTLE_FLAG : Constants::QUEEN_CASTLE_FLAG;
+        to = static_cast<enumSquare>(kingside ? from + 2 : from - 2);
+
+        unsigned int right = us == enumPiece::nWhite
+            ? (kingside ? Constants::WHITE_KINGSIDE_CASTLE : Constants::WHITE_QUEENSIDE_CASTLE)
+            : (kingside ? Constants::BLACK_KINGSIDE_CASTLE : Constants::BLACK_QUEENSIDE_CASTLE);
+
+        if (!(board.getCastleState() & right)) return CMove();
+        if (Bitboard::between(from, static_cast<enumSquare>(kingside ? to + 1 : to - 2)) & board.getOccupiedSquares()) return CMove();
+    } else {
+        if (board.pieceOn(to) != Constants::NO_PIECE) {
+            if (board.pieceColourOn(to) == us) return CMove();
+            flags = Constants::CAPTURE_FLAG;
+        }
+
+        if (moving == enumPiece::nPawn) {
+            if (to == board.getEnPassantSquare() and fromFile != toFile) flags = Constants::EP_CAPTURE_FLAG;
+            else if (fromRow - toRow == 2 or toRow - fromRow == 2) flags = Constants::DOUBLE_PAWN_PUSH_FLAG;
+        }
+
+        // Polyglot promotion pieces are 1 - 4 for knight to queen, matching the order of the promotion flags
+        if (promotion) flags |= Constants::PROMO_FLAG_MASK | (promotion - 1);
+    }
+
+    // Keys can collide, so make sure the move is pseudo-legal before isLegal decides the rest
+    if (flags != Constants::KING_CASTLE_FLAG and flags != Constants::QUEEN_CASTLE_FLAG) {
+        if (!(CPolyglotBook::reachableSquares(board, from) & Bitboard::squareBB(to))) return CMove();
+
+        bool lastRank = toRow == 0 or toRow == 7;
+        if ((moving == enumPiece::nPawn and lastRank) != (promotion != 0)) return CMove();
+    }
+
+    CMove decoded(from, to, flags);
+
+    return board.isLegal(decoded) ? decoded : CMove();
+}
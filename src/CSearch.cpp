@@ -0,0 +1,659 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "chessbot/bitbase.h"
+#include "chessbot/bitboard.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/evaluate.h"
+#include "chessbot/profile.h"
+
+// Late move reductions indexed by depth and move number, grows with the log of both
+static const std::array<std::array<int, 64>, 64> REDUCTIONS = [] {
+    std::array<std::array<int, 64>, 64> reductions = {};
+
+    for (int depth = 1; depth < 64; ++depth) {
+        for (int moveNumber = 1; moveNumber < 64; ++moveNumber) {
+            reductions[depth][moveNumber] = int(0.75 + std::log(depth) * std::log(moveNumber) / 2.25);
+        }
+    }
+
+    return reductions;
+}();
+
+// Victim values for ordering captures, indexed by enumPiece
+constexpr std::array<int, 8> MVV_VALUES = { 0, 0, 100, 320, 300, 500, 900, 0 };
+
+constexpr int TT_MOVE_SCORE = 1 << 30;
+constexpr int CAPTURE_SCORE = 1 << 28;
+constexpr int KILLER_SCORE = 1 << 27;
+constexpr int HISTORY_MAX = 1 << 14;
+
+// Nodes between clock checks
+constexpr U64 CHECK_INTERVAL = 2048;
+
+// Shallower nodes are cheaper to search twice than to coordinate
+constexpr int EXCLUSIVE_MIN_DEPTH = 3;
+
+CSearch::CSearch(CTranspositionTable *tt)
+    : tt_(tt), exclusive_(nullptr), shared_(false), stop_(false), allocatedTime_(0), nodes_(0), selDepth_(0), tbCardinality_(0), tbHits_(0), rootInTb_(false), rootTbScore_(0) {
+    for (auto &moves : moveLists_) moves.reserve(256);
+    for (auto &scores : moveScores_) scores.reserve(256);
+    for (auto &quiets : triedQuiets_) quiets.reserve(256);
+    for (auto &deferred : deferredMoves_) deferred.reserve(256);
+    for (auto &moves : tbMoveLists_) moves.reserve(256);
+
+    CSearch::clearHistory();
+}
+
+SearchResult CSearch::search(CBoard &board, const SearchLimits &limits) {
+    PROFILE_SCOPE(search);
+
+    limits_ = limits;
+    start_ = std::chrono::steady_clock::now();
+    stop_ = cancelCheck_ and cancelCheck_();
+    nodes_ = 0;
+    selDepth_ = 0;
+    tbHits_ = 0;
+    stats_.clear();
+
+    for (auto &killers : killers_) killers = { CMove(), CMove() };
+
+    // Aim for a fraction of the remaining time, the search stops early if the next iteration looks too long
+    int us = board.getSideToMove();
+    allocatedTime_ = 0;
+
+    if (limits.movetime > 0) {
+        allocatedTime_ = limits.movetime;
+    } else if (limits.time[us] > 0 and !limits.infinite) {
+        int movesLeft = limits.movestogo > 0 ? limits.movestogo : 30;
+        allocatedTime_ = limits.time[us] / movesLeft + limits.increment[us] * 3 / 4;
+        allocatedTime_ = std::max(1LL, std::min(allocatedTime_, limits.time[us] - 50));
+    }
+
+    if (!shared_) tt_->newSearch();
+
+    SearchResult result = { CMove(), 0, 0, 0 };
+
+    rootMoves_.clear();
+    board.generateLegalMoves(&rootMoves_);
+    if (rootMoves_.empty()) {
+        result.score = board.isInCheck() ? -Constants::MATE_SCORE : Constants::DRAW_SCORE;
+        return result;
+    }
+
+    CSearch::probeRoot(board);
+
+    // Something to play even if the first iteration is interrupted
+    result.bestMove = rootMoves_[0];
+
+    int score = 0;
+    int maxDepth = std::min(limits.depth, Constants::MAX_PLY - 1);
+
+    for (int depth = 1; depth <= maxDepth; ++depth) {
+        // Aspiration window around the previous score, widened on each failure
+        int delta = 25;
+        int alpha = -Constants::INFINITE_SCORE;
+        int beta = Constants::INFINITE_SCORE;
+
+        if (depth >= 5) {
+            alpha = std::max(score - delta, -Constants::INFINITE_SCORE);
+            beta = std::min(score + delta, Constants::INFINITE_SCORE);
+        }
+
+        while (true) {
+            score = CSearch::negamax(board, alpha, beta, depth, 0, false);
+
+            if (stop_) break;
+
+            if (score <= alpha) {
+                beta = (alpha + beta) / 2;
+                alpha = std::max(score - delta, -Constants::INFINITE_SCORE);
+            } else if (score >= beta) {
+                beta = std::min(score + delta, Constants::INFINITE_SCORE);
+            } else {
+                break;
+            }
+
+            delta += delta / 2;
+        }
+
+        if (stop_) break;
+
+        result.bestMove = pv_[0][0];
+        result.score = score;
+        result.depth = depth;
+
+        // The tablebase result is exact unless the search has found a mate
+        if (rootInTb_ and std::abs(score) < Constants::MATE_IN_MAX_PLY) result.score = rootTbScore_;
+
+        if (infoCallback_) {
+            SearchInfo info = { depth, selDepth_, result.score, nodes_, CSearch::elapsed(), tt_->hashfull(), tbHits_, {} };
+            info.pv.assign(pv_[0].begin(), pv_[0].begin() + pvLength_[0]);
+            infoCallback_(info);
+        }
+
+        // Another iteration takes several times longer than this one, so there is no point starting it
+        if (allocatedTime_ > 0 and !limits.infinite and CSearch::elapsed() > allocatedTime_ / 2) break;
+    }
+
+    result.nodes = nodes_;
+
+    return result;
+}
+
+int CSearch::resolve(CBoard &board, std::vector<CMove> *pv) {
+    limits_ = SearchLimits();
+    start_ = std::chrono::steady_clock::now();
+    stop_ = false;
+    allocatedTime_ = 0;
+    nodes_ = 0;
+    selDepth_ = 0;
+
+    int score = CSearch::quiescence(board, -Constants::INFINITE_SCORE, Constants::INFINITE_SCORE, 0);
+    pv->assign(pv_[0].begin(), pv_[0].begin() + pvLength_[0]);
+
+    return score;
+}
+
+void CSearch::stop() {
+    stop_ = true;
+}
+
+void CSearch::clearHistory() {
+    for (auto &killers : killers_) killers = { CMove(), CMove() };
+
+    for (auto &colour : history_) {
+        for (auto &from : colour) from.fill(0);
+    }
+}
+
+void CSearch::setInfoCallback(std::function<void(const SearchInfo &)> callback) {
+    infoCallback_ = callback;
+}
+
+void CSearch::setCancelCheck(std::function<bool()> check) {
+    cancelCheck_ = check;
+}
+
+void CSearch::setTablebases(const TablebaseConfig &config) {
+    tbConfig_ = config;
+}
+
+void CSearch::setExclusiveTable(CExclusiveTable *table) {
+    exclusive_ = table;
+}
+
+void CSearch::setShared(bool shared) {
+    shared_ = shared;
+}
+
+U64 CSearch::getNodes() const {
+    return nodes_;
+}
+
+U64 CSearch::getTbHits() const {
+    return tbHits_;
+}
+
+const SearchStats &CSearch::getStats() const {
+    return stats_;
+}
+
+void CSearch::probeRoot(CBoard &board) {
+    rootInTb_ = false;
+    tbCardinality_ = 0;
+
+    const CSyzygy *tablebases = tbConfig_.tablebases;
+    if (!tablebases) return;
+
+    tbCardinality_ = std::min(tbConfig_.probeLimit, tablebases->maxPieces());
+
+    if (Bitboard::popcount(board.getOccupiedSquares()) > tbCardinality_) return;
+
+    // DTZ keeps only moves which make progress, without it the search has to find the way to zeroing moves
+    bool dtz = tablebases->rootProbe(board, &rootMoves_, tbConfig_.rule50, &rootTbScore_);
+    rootInTb_ = dtz or tablebases->rootProbeWdl(board, &rootMoves_, tbConfig_.rule50, &rootTbScore_);
+
+    if (!rootInTb_) return;
+
+    tbHits_ = rootMoves_.size();
+    STATS_ADD(stats_, tbHits, rootMoves_.size());
+
+    // Probing inside the tree only helps to find how to convert a win
+    if (dtz or rootTbScore_ <= Constants::DRAW_SCORE) tbCardinality_ = 0;
+}
+
+template <enumGenType Type>
+void CSearch::generateMoves(const CBoard &board, std::vector<CMove> *moves) {
+    STATS_INC(stats_, moveGenCalls);
+    StatsTimer timer(&stats_.moveGenCycles, stats_.moveGenCalls);
+
+#ifdef CHESSBOT_STATS
+    auto us = board.getSideToMove() == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+    for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+        stats_.moveGenPieces[piece] += Bitboard::popcount(board.getPieceSet(static_cast<enumPiece>(piece), us));
+    }
+#endif
+
+    board.generateMoves<Type>(moves);
+}
+
+int CSearch::evaluate(const CBoard &board) {
+    STATS_INC(stats_, evalCalls);
+    StatsTimer timer(&stats_.evalCycles, stats_.evalCalls);
+
+    return Evaluation::evaluate(board);
+}
+
+int CSearch::negamax(CBoard &board, int alpha, int beta, int depth, int ply, bool nullAllowed) {
+    bool rootNode = ply == 0;
+    bool pvNode = beta - alpha > 1;
+    bool inCheck = board.isInCheck();
+
+    pvLength_[ply] = ply;
+
+    // Check extension
+    if (inCheck) ++depth;
+
+    if (depth <= 0) return CSearch::quiescence(board, alpha, beta, ply);
+
+    ++nodes_;
+    STATS_INC(stats_, nodes);
+    if (CSearch::shouldStop()) return 0;
+
+    selDepth_ = std::max(selDepth_, ply);
+
+    if (!rootNode) {
+        if (board.isDraw(ply)) return Constants::DRAW_SCORE;
+        if (ply >= Constants::MAX_PLY - 1) return inCheck ? Constants::DRAW_SCORE : CSearch::evaluate(board);
+
+        // Mate distance pruning, a shorter mate has already been found elsewhere
+        alpha = std::max(alpha, -Constants::MATE_SCORE + ply);
+        beta = std::min(beta, Constants::MATE_SCORE - ply - 1);
+        if (alpha >= beta) return alpha;
+
+        // King and pawn against king draws are exact, wins are left to the search and the evaluation
+        bool kpkWin;
+        if (Bitbase::probeKpk(board, &kpkWin) and !kpkWin) return Constants::DRAW_SCORE;
+
+        // A draw by repetition is one move away, so the node is worth at least a draw
+        if (alpha < Constants::DRAW_SCORE and board.hasUpcomingRepetition(ply)) {
+            alpha = Constants::DRAW_SCORE;
+            if (alpha >= beta) return alpha;
+        }
+    }
+
+    TTData ttData = {};
+    bool ttHit = tt_->probe(board.getKey(), &ttData);
+    CMove ttMove = ttHit ? ttData.move : CMove();
+
+    STATS_INC(stats_, ttProbes);
+#ifdef CHESSBOT_STATS
+    if (ttHit) ++stats_.ttHits;
+    else if (tt_->isCollision(board.getKey())) ++stats_.ttCollisions;
+#endif
+
+    if (ttHit and !pvNode and ttData.depth >= depth) {
+        int ttScore = CSearch::scoreFromTT(ttData.score, ply);
+
+        if (ttData.bound == enumBound::exactBound
+            or (ttData.bound == enumBound::lowerBound and ttScore >= beta)
+            or (ttData.bound == enumBound::upperBound and ttScore <= alpha)) return ttScore;
+    }
+
+    // Tablebases, only right after a capture or pawn move so the fifty move count of the result is known
+    int pieces = Bitboard::popcount(board.getOccupiedSquares());
+
+    if (!rootNode and pieces <= tbCardinality_ and (pieces < tbCardinality_ or depth >= tbConfig_.probeDepth)
+        and board.getHalfmoves() == 0 and !board.getCastleState()) {
+        int wdl;
+        STATS_INC(stats_, tbProbes);
+
+        if (tbConfig_.tablebases->probeWdl(board, &wdl, &tbMoveLists_)) {
+            ++tbHits_;
+            STATS_INC(stats_, tbHits);
+
+            // Without the fifty move rule cursed wins and blessed losses are real results
+            int drawScore = tbConfig_.rule50 ? 1 : 0;
+            int score = wdl < -drawScore ? -Constants::TB_WIN_SCORE + ply
+                      : wdl > drawScore ? Constants::TB_WIN_SCORE - ply
+                      : Constants::DRAW_SCORE + 2 * wdl * drawScore;
+
+            enumBound bound = wdl < -drawScore ? enumBound::upperBound
+                            : wdl > drawScore ? enumBound::lowerBound
+                            : enumBound::exactBound;
+
+            if (bound == enumBound::exactBound
+                or (bound == enumBound::lowerBound and score >= beta)
+                or (bound == enumBound::upperBound and score <= alpha)) {
+                int eval = inCheck ? -Constants::INFINITE_SCORE : CSearch::evaluate(board);
+                tt_->store(board.getKey(), CMove(), CSearch::scoreToTT(score, ply), eval,
+                           std::min(Constants::MAX_PLY - 1, depth + 6), bound);
+                return score;
+            }
+        }
+    }
+
+    int staticEval = -Constants::INFINITE_SCORE;
+    if (!inCheck) staticEval = ttHit ? ttData.eval : CSearch::evaluate(board);
+
+    if (!pvNode and !inCheck) {
+        // Reverse futility pruning, the position is so far above beta that a shallow search will not bring it back
+        if (depth <= 6 and staticEval - 80 * depth >= beta and std::abs(beta) < Constants::MATE_IN_MAX_PLY) return staticEval;
+
+        // Null move pruning, skipped without pieces because of zugzwang
+        auto us = board.getSideToMove() == enumColour::white ? enumPiece::nWhite : enumPiece::nBlack;
+        U64 pieces = board.getPieceSet(us) & ~board.getPieceSet(enumPiece::nPawn) & ~board.getPieceSet(enumPiece::nKing);
+
+        if (nullAllowed and depth >= 3 and staticEval >= beta and pieces) {
+            int reduction = 3 + depth / 6;
+
+            STATS_INC(stats_, nullMoveTries);
+
+            board.makeNullMove();
+            int score = -CSearch::negamax(board, -beta, -beta + 1, depth - 1 - reduction, ply + 1, false);
+            board.unmakeNullMove();
+
+            if (stop_) return 0;
+
+            // Unproven mates are not returned
+            if (score >= beta) {
+                STATS_INC(stats_, nullMoveCutoffs);
+                return score >= Constants::TB_WIN_IN_MAX_PLY ? beta : score;
+            }
+        }
+    }
+
+    std::vector<CMove> &moves = moveLists_[ply];
+    std::vector<int> &scores = moveScores_[ply];
+    std::vector<CMove> &triedQuiets = triedQuiets_[ply];
+    std::vector<CMove> &deferred = deferredMoves_[ply];
+
+    moves.clear();
+    triedQuiets.clear();
+    deferred.clear();
+
+    if (inCheck) {
+        CSearch::generateMoves<genEvasions>(board, &moves);
+    } else {
+        CSearch::generateMoves<genAll>(board, &moves);
+    }
+
+    CSearch::scoreMoves(board, moves, ttMove, ply, &scores);
+
+    int originalAlpha = alpha;
+    int bestScore = -Constants::INFINITE_SCORE;
+    CMove bestMove;
+    int legalMoves = 0;
+
+    bool exclusive = exclusive_ and depth >= EXCLUSIVE_MIN_DEPTH;
+    U64 key = board.getKey();
+    std::size_t deferredIndex = 0;
+
+    // Deferred moves are searched after the rest, by which time the thread searching them has usually stored its result
+    for (std::size_t i = 0; i < moves.size() or deferredIndex < deferred.size(); ++i) {
+        CMove move;
+
+        if (i < moves.size()) {
+            move = CSearch::pickMove(&moves, &scores, i);
+
+            if (!board.isLegal(move)) continue;
+
+            // Root moves which throw away a tablebase result are not searched
+            if (rootNode and rootInTb_ and std::find(rootMoves_.begin(), rootMoves_.end(), move) == rootMoves_.end()) continue;
+
+            // Every thread searches the eldest brother, the younger ones are left to whichever thread gets to them first
+            if (exclusive and legalMoves > 0 and exclusive_->isBusy(key, move)) {
+                deferred.push_back(move);
+                continue;
+            }
+        } else {
+            move = deferred[deferredIndex++];
+        }
+
+        ++legalMoves;
+
+        bool quiet = !move.isCapture() and !(move.getFlags() & Constants::PROMO_FLAG_MASK);
+        bool givesCheck = board.givesCheck(move);
+        bool entered = exclusive and legalMoves > 1;
+
+        if (entered) exclusive_->enter(key, move);
+        board.makeMove(move);
+
+        int newDepth = depth - 1;
+        int score;
+
+        if (legalMoves == 1) {
+            score = -CSearch::negamax(board, -beta, -alpha, newDepth, ply + 1, true);
+        } else {
+            // Late move reductions for quiet moves which ordering put near the end
+            int reduction = 0;
+
+            if (depth >= 3 and legalMoves > 3 and quiet and !inCheck and !givesCheck) {
+                reduction = REDUCTIONS[std::min(depth, 63)][std::min(legalMoves, 63)];
+                if (pvNode) --reduction;
+                if (move == killers_[ply][0] or move == killers_[ply][1]) --reduction;
+                reduction = std::clamp(reduction, 0, newDepth - 1);
+            }
+
+            if (reduction > 0) STATS_INC(stats_, lmrReductions);
+
+            score = -CSearch::negamax(board, -alpha - 1, -alpha, newDepth - reduction, ply + 1, true);
+
+            if (score > alpha and reduction > 0) {
+                STATS_INC(stats_, lmrResearches);
+                score = -CSearch::negamax(board, -alpha - 1, -alpha, newDepth, ply + 1, true);
+            }
+
+            if (score > alpha and score < beta) {
+                score = -CSearch::negamax(board, -beta, -alpha, newDepth, ply + 1, true);
+            }
+        }
+
+        board.unmakeMove(move);
+        if (entered) exclusive_->leave(key, move);
+
+        if (stop_) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+
+            if (score > alpha) {
+                bestMove = move;
+                alpha = score;
+                CSearch::updatePv(ply, move);
+
+                if (alpha >= beta) {
+                    STATS_INC(stats_, betaCutoffs);
+                    if (legalMoves == 1) STATS_INC(stats_, firstMoveCutoffs);
+
+                    if (quiet) CSearch::updateQuietStats(board, move, triedQuiets, depth, ply);
+                    break;
+                }
+            }
+        }
+
+        if (quiet) triedQuiets.push_back(move);
+    }
+
+    if (legalMoves == 0) return inCheck ? -Constants::MATE_SCORE + ply : Constants::DRAW_SCORE;
+
+    enumBound bound = bestScore >= beta ? enumBound::lowerBound
+                    : bestScore > originalAlpha ? enumBound::exactBound
+                    : enumBound::upperBound;
+
+    tt_->store(board.getKey(), bestMove, CSearch::scoreToTT(bestScore, ply), staticEval, depth, bound);
+
+    return bestScore;
+}
+
+int CSearch::quiescence(CBoard &board, int alpha, int beta, int ply) {
+    ++nodes_;
+    STATS_INC(stats_, qnodes);
+    if (CSearch::shouldStop()) return 0;
+
+    selDepth_ = std::max(selDepth_, ply);
+    pvLength_[ply] = ply;
+
+    if (board.isDraw(ply)) return Constants::DRAW_SCORE;
+
+    bool inCheck = board.isInCheck();
+
+    if (ply >= Constants::MAX_PLY - 1) return inCheck ? Constants::DRAW_SCORE : CSearch::evaluate(board);
+
+    // Standing pat is not an option in check, every evasion is searched instead
+    int bestScore = -Constants::INFINITE_SCORE;
+
+    if (!inCheck) {
+        bestScore = CSearch::evaluate(board);
+        if (bestScore >= beta) return bestScore;
+        alpha = std::max(alpha, bestScore);
+    }
+
+    std::vector<CMove> &moves = moveLists_[ply];
+    std::vector<int> &scores = moveScores_[ply];
+
+    moves.clear();
+
+    // Only captures and promotions unless escaping check
+    if (inCheck) {
+        CSearch::generateMoves<genEvasions>(board, &moves);
+    } else {
+        CSearch::generateMoves<genCaptures>(board, &moves);
+    }
+
+    CSearch::scoreMoves(board, moves, CMove(), ply, &scores);
+
+    int legalMoves = 0;
+
+    for (std::size_t i = 0; i < moves.size(); ++i) {
+        CMove move = CSearch::pickMove(&moves, &scores, i);
+
+        if (!board.isLegal(move)) continue;
+        ++legalMoves;
+
+        board.makeMove(move);
+        int score = -CSearch::quiescence(board, -beta, -alpha, ply + 1);
+        board.unmakeMove(move);
+
+        if (stop_) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+
+            if (score > alpha) {
+                alpha = score;
+                CSearch::updatePv(ply, move);
+
+                if (alpha >= beta) break;
+            }
+        }
+    }
+
+    if (inCheck and legalMoves == 0) return -Constants::MATE_SCORE + ply;
+
+    return bestScore;
+}
+
+void CSearch::scoreMoves(const CBoard &board, const std::vector<CMove> &moves, CMove ttMove, int ply, std::vector<int> *scores) const {
+    int us = board.getSideToMove();
+
+    scores->resize(moves.size());
+
+    for (std::size_t i = 0; i < moves.size(); ++i) {
+        CMove move = moves[i];
+        auto from = static_cast<enumSquare>(move.getFrom());
+        auto to = static_cast<enumSquare>(move.getTo());
+        int &score = (*scores)[i];
+
+        if (move == ttMove) {
+            score = TT_MOVE_SCORE;
+        } else if (move.isCapture() or (move.getFlags() & Constants::PROMO_FLAG_MASK)) {
+            // Most valuable victim, then least valuable attacker
+            enumPiece victim = move.getFlags() == Constants::EP_CAPTURE_FLAG ? enumPiece::nPawn : board.pieceTypeOn(to);
+            score = CAPTURE_SCORE + MVV_VALUES[victim] * 8 - board.pieceTypeOn(from);
+
+            if (move.getFlags() & Constants::PROMO_FLAG_MASK) {
+                score += MVV_VALUES[Constants::PROMOTION_PIECES[move.getFlags() & 3]];
+            }
+        } else if (move == killers_[ply][0]) {
+            score = KILLER_SCORE + 1;
+        } else if (move == killers_[ply][1]) {
+            score = KILLER_SCORE;
+        } else {
+            score = history_[us][from][to];
+        }
+    }
+}
+
+CMove CSearch::pickMove(std::vector<CMove> *moves, std::vector<int> *scores, std::size_t index) {
+    std::size_t best = index;
+
+    for (std::size_t i = index + 1; i < moves->size(); ++i) {
+        if ((*scores)[i] > (*scores)[best]) best = i;
+    }
+
+    std::swap((*moves)[index], (*moves)[best]);
+    std::swap((*scores)[index], (*scores)[best]);
+
+    return (*moves)[index];
+}
+
+void CSearch::updateQuietStats(const CBoard &board, CMove best, const std::vector<CMove> &triedQuiets, int depth, int ply) {
+    int us = board.getSideToMove();
+
+    if (!(best == killers_[ply][0])) {
+        killers_[ply][1] = killers_[ply][0];
+        killers_[ply][0] = best;
+    }
+
+    // Gravity keeps entries within HISTORY_MAX so they stay below the killer scores
+    auto update = [&](CMove move, int bonus) {
+        int &entry = history_[us][move.getFrom()][move.getTo()];
+        entry += bonus - entry * std::abs(bonus) / HISTORY_MAX;
+    };
+
+    int bonus = std::min(depth * depth, 400);
+
+    update(best, bonus);
+    for (auto move : triedQuiets) update(move, -bonus);
+}
+
+void CSearch::updatePv(int ply, CMove move) {
+    pv_[ply][ply] = move;
+
+    for (int i = ply + 1; i < pvLength_[ply + 1]; ++i) pv_[ply][i] = pv_[ply + 1][i];
+
+    pvLength_[ply] = std::max(pvLength_[ply + 1], ply + 1);
+}
+
+bool CSearch::shouldStop() {
+    if (stop_) return true;
+
+    if (limits_.nodes > 0 and nodes_ >= limits_.nodes) {
+        stop_ = true;
+    } else if (nodes_ % CHECK_INTERVAL == 0) {
+        if (allocatedTime_ > 0 and CSearch::elapsed() >= allocatedTime_) stop_ = true;
+        else if (cancelCheck_ and cancelCheck_()) stop_ = true;
+    }
+
+    return stop_;
+}
+
+long long CSearch::elapsed() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_).count();
+}
+
+// Mate and tablebase scores are stored relative to the node so they stay correct when reached from a different ply
+int CSearch::scoreToTT(int score, int ply) {
+    if (score >= Constants::TB_WIN_IN_MAX_PLY) return score + ply;
+    if (score <= -Constants::TB_WIN_IN_MAX_PLY) return score - ply;
+    return score;
+}
+
+int CSearch::scoreFromTT(int score, int ply) {
+    if (score >= Constants::TB_WIN_IN_MAX_PLY) return score - ply;
+    if (score <= -Constants::TB_WIN_IN_MAX_PLY) return score + ply;
+    return score;
+}
@@ -0,0 +1,1103 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/constants.h"
+#include "chessbot/CSyzygy.h"
+
+// Probing follows the reference implementation by Ronald de Man
+// Inside this file squares are numbered as in the tables, from a1 (0) to h8 (63), which is CBoard's square ^ 56
+// Pieces are numbered as in the tables too: pawn 1, knight 2, bishop 3, rook 4, queen 5, king 6, plus 8 for Black
+
+constexpr std::array<uint8_t, 4> WDL_MAGIC = { 0x71, 0xE8, 0x23, 0x5D };
+constexpr std::array<uint8_t, 4> DTZ_MAGIC = { 0xD7, 0x66, 0x0C, 0xA5 };
+
+// File header flag
+constexpr uint8_t HAS_PAWNS_FLAG = 2;
+
+// Flags of each compressed table
+constexpr uint8_t STM_FLAG = 1;
+constexpr uint8_t MAPPED_FLAG = 2;
+constexpr uint8_t WIN_PLIES_FLAG = 4;
+constexpr uint8_t LOSS_PLIES_FLAG = 8;
+constexpr uint8_t WIDE_FLAG = 16;
+constexpr uint8_t SINGLE_VALUE_FLAG = 128;
+
+// Table piece type indexed by enumPiece
+constexpr std::array<int, 8> TB_TYPE = { 0, 0, 1, 3, 2, 4, 5, 6 };
+
+// Piece letters in the order used by table file names, indexed by table piece type
+constexpr char TB_LETTERS[] = " PNBRQK";
+
+// Root move ranks, wins within the fifty move rule rank highest
+constexpr int MAX_DTZ = 1 << 18;
+
+constexpr int PAWN_SCORE = 100;
+
+// Binomial coefficients and square maps used to turn a position into a table index
+struct Encoding {
+    // Squares below the a1-h8 diagonal to 0..27
+    std::array<int, 64> mapB1H1H7;
+
+    // Squares in the a1-d1-d4 triangle to 0..9, diagonal squares last
+    std::array<int, 64> mapA1D1D4;
+
+    // The 462 placements of two kings with the first in the a1-d1-d4 triangle
+    std::array<std::array<int, 64>, 10> mapKK;
+
+    // binomial[k][n] ways to choose k of n squares
+    std::array<std::array<U64, 64>, CSyzygy::MAX_PIECES> binomial;
+
+    // Squares a2-h7 to 0..47, the leading pawn is the one with the highest value
+    std::array<int, 64> mapPawns;
+
+    std::array<std::array<int, 64>, CSyzygy::MAX_PIECES> leadPawnIdx;
+    std::array<std::array<int, 4>, CSyzygy::MAX_PIECES> leadPawnsSize;
+};
+
+static int offA1H8(int square) {
+    return (square >> 3) - (square & 7);
+}
+
+static int flipFile(int square) {
+    return square ^ 7;
+}
+
+static int flipRank(int square) {
+    return square ^ 56;
+}
+
+static const Encoding ENCODING = [] {
+    Encoding e = {};
+
+    int code = 0;
+    for (int s = 0; s < 64; ++s) {
+        if (offA1H8(s) < 0) e.mapB1H1H7[s] = code++;
+    }
+
+    std::vector<int> diagonal;
+    code = 0;
+    for (int s = 0; s <= 27; ++s) {
+        if (offA1H8(s) < 0 and (s & 7) <= 3) e.mapA1D1D4[s] = code++;
+        else if (offA1H8(s) == 0 and (s & 7) <= 3) diagonal.push_back(s);
+    }
+    for (int s : diagonal) e.mapA1D1D4[s] = code++;
+
+    auto kingsTouch = [](int s1, int s2) {
+        return std::abs((s1 >> 3) - (s2 >> 3)) <= 1 and std::abs((s1 & 7) - (s2 & 7)) <= 1;
+    };
+
+    std::vector<std::pair<int, int>> bothOnDiagonal;
+    code = 0;
+    for (int idx = 0; idx < 10; ++idx) {
+        for (int s1 = 0; s1 <= 27; ++s1) {
+            // b1 is the only square mapped to 0 which is in the triangle
+            if (e.mapA1D1D4[s1] != idx or (idx == 0 and s1 != 1)) continue;
+
+            for (int s2 = 0; s2 < 64; ++s2) {
+                if (kingsTouch(s1, s2)) continue;
+                else if (offA1H8(s1) == 0 and offA1H8(s2) > 0) continue;
+                else if (offA1H8(s1) == 0 and offA1H8(s2) == 0) bothOnDiagonal.emplace_back(idx, s2);
+                else e.mapKK[idx][s2] = code++;
+            }
+        }
+    }
+    for (auto [idx, s2] : bothOnDiagonal) e.mapKK[idx][s2] = code++;
+
+    e.binomial[0][0] = 1;
+    for (int n = 1; n < 64; ++n) {
+        for (int k = 0; k < CSyzygy::MAX_PIECES and k <= n; ++k) {
+            e.binomial[k][n] = (k > 0 ? e.binomial[k - 1][n - 1] : 0) + (k < n ? e.binomial[k][n - 1] : 0);
+        }
+    }
+
+    int availableSquares = 47;
+    for (int leadPawns = 1; leadPawns < CSyzygy::MAX_PIECES; ++leadPawns) {
+        for (int file = 0; file < 4; ++file) {
+            int idx = 0;
+
+            for (int rank = 1; rank <= 6; ++rank) {
+                int s = rank * 8 + file;
+
+                if (leadPawns == 1) {
+                    e.mapPawns[s] = availableSquares--;
+                    e.mapPawns[flipFile(s)] = availableSquares--;
+                }
+
+                e.leadPawnIdx[leadPawns][s] = idx;
+                idx += e.binomial[leadPawns - 1][e.mapPawns[s]];
+            }
+
+            e.leadPawnsSize[leadPawns][file] = idx;
+        }
+    }
+
+    return e;
+}();
+
+static bool pawnsCompare(int s1, int s2) {
+    return ENCODING.mapPawns[s1] < ENCODING.mapPawns[s2];
+}
+
+static uint16_t readLE16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t readLE32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+}
+
+static uint32_t readBE32(const uint8_t *p) {
+    return (uint32_t(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static U64 readBE64(const uint8_t *p) {
+    return (U64(readBE32(p)) << 32) | readBE32(p + 4);
+}
+
+// Compressed values of one side to move (and one leading pawn file in pawn tables)
+// Values are Huffman coded symbols, each symbol expanding into a pair of symbols (recursive pairing)
+struct PairsData {
+    uint8_t flags;
+    int maxSymLen;
+    int minSymLen;
+    uint32_t numBlocks;
+    std::size_t sizeofBlock;
+    std::size_t span;
+
+    // Little-endian 16 bit lowest symbol of each code length
+    const uint8_t *lowestSym;
+
+    // Left and right child of each symbol, 12 bits each
+    const uint8_t *btree;
+
+    // Little-endian 16 bit number of values in each block, minus one
+    const uint8_t *blockLength;
+    std::size_t blockLengthSize;
+
+    // Block (32 bits) and offset (16 bits) of every span-th value
+    const uint8_t *sparseIndex;
+    std::size_t sparseIndexSize;
+
+    const uint8_t *data;
+
+    // Smallest left aligned code of each length, longest codes first
+    std::vector<U64> base64;
+
+    // Number of values each symbol expands into, minus one
+    std::vector<uint8_t> symlen;
+
+    std::array<uint8_t, CSyzygy::MAX_PIECES> pieces;
+    std::array<U64, CSyzygy::MAX_PIECES + 1> groupIdx;
+    std::array<int, CSyzygy::MAX_PIECES + 1> groupLen;
+
+    // Offsets of the DTZ value maps for each WDL result
+    std::array<uint16_t, 4> mapIdx;
+
+    int left(int symbol) const {
+        const uint8_t *lr = btree + 3 * symbol;
+        return ((lr[1] & 0xF) << 8) | lr[0];
+    }
+
+    int right(int symbol) const {
+        const uint8_t *lr = btree + 3 * symbol;
+        return (lr[2] << 4) | (lr[1] >> 4);
+    }
+};
+
+struct CSyzygy::Table {
+    bool dtz = false;
+
+    // Material key with the pieces before the 'v' as White, and with the colours swapped
+    U64 key = 0;
+    U64 key2 = 0;
+
+    int pieceCount = 0;
+    bool hasPawns = false;
+    bool hasUniquePieces = false;
+
+    // Pawns of the leading colour, then of the other colour
+    std::array<int, 2> pawnCount = { 0, 0 };
+
+    const uint8_t *mapping = nullptr;
+    std::size_t length = 0;
+
+    // DTZ value maps
+    const uint8_t *map = nullptr;
+
+    // Indexed by side to move and leading pawn file
+    std::array<std::array<PairsData, 4>, 2> items = {};
+
+    ~Table() {
+        if (mapping) munmap(const_cast<uint8_t *>(mapping), length);
+    }
+
+    PairsData *get(int stm, int file) {
+        return &items[dtz ? 0 : stm][hasPawns ? file : 0];
+    }
+};
+
+static int setSymlen(PairsData *d, int symbol, std::vector<bool> *visited) {
+    (*visited)[symbol] = true;
+
+    int right = d->right(symbol);
+    if (right == 0xFFF) return 0;
+
+    int left = d->left(symbol);
+    if (!(*visited)[left]) d->symlen[left] = setSymlen(d, left, visited);
+    if (!(*visited)[right]) d->symlen[right] = setSymlen(d, right, visited);
+
+    return d->symlen[left] + d->symlen[right] + 1;
+}
+
+// Reads the Huffman code description, returns nullptr if it runs past end
+static const uint8_t *setSizes(PairsData *d, const uint8_t *data, const uint8_t *end) {
+    if (data + 2 > end) return nullptr;
+
+    d->flags = *data++;
+
+    if (d->flags & SINGLE_VALUE_FLAG) {
+        d->numBlocks = 0;
+        d->span = 0;
+        d->blockLengthSize = 0;
+        d->sparseIndexSize = 0;
+
+        // The single value is stored as the minimum symbol length
+        d->minSymLen = *data++;
+        return data;
+    }
+
+    if (data + 10 > end) return nullptr;
+
+    // Group lengths are zero terminated, the index after the last group is the table size
+    int groups = std::find(d->groupLen.begin(), d->groupLen.end(), 0) - d->groupLen.begin();
+    U64 tbSize = d->groupIdx[groups];
+
+    d->sizeofBlock = std::size_t(1) << *data++;
+    d->span = std::size_t(1) << *data++;
+    d->sparseIndexSize = (tbSize + d->span - 1) / d->span;
+    int padding = *data++;
+    d->numBlocks = readLE32(data);
+    data += 4;
+
+    // Padded so the sparse index never points past the end
+    d->blockLengthSize = d->numBlocks + padding;
+
+    d->maxSymLen = *data++;
+    d->minSymLen = *data++;
+    d->lowestSym = data;
+
+    if (d->maxSymLen < d->minSymLen or d->maxSymLen > 64) return nullptr;
+
+    d->base64.assign(d->maxSymLen - d->minSymLen + 1, 0);
+    if (data + 2 * d->base64.size() + 2 > end) return nullptr;
+
+    // Longer codes have lower values, so base64 is decreasing
+    for (int i = int(d->base64.size()) - 2; i >= 0; --i) {
+        d->base64[i] = (d->base64[i + 1] + readLE16(d->lowestSym + 2 * i) - readLE16(d->lowestSym + 2 * (i + 1))) / 2;
+    }
+
+    for (std::size_t i = 0; i < d->base64.size(); ++i) d->base64[i] <<= 64 - i - d->minSymLen;
+
+    data += 2 * d->base64.size();
+
+    d->symlen.assign(readLE16(data), 0);
+    data += 2;
+    d->btree = data;
+
+    if (data + 3 * d->symlen.size() > end) return nullptr;
+
+    std::vector<bool> visited(d->symlen.size());
+    for (std::size_t symbol = 0; symbol < d->symlen.size(); ++symbol) {
+        if (!visited[symbol]) d->symlen[symbol] = setSymlen(d, symbol, &visited);
+    }
+
+    return data + 3 * d->symlen.size() + (d->symlen.size() & 1);
+}
+
+// Splits the pieces into groups which are encoded together and sets the index multiplier of each group
+// order gives where the leading group and the remaining pawns come in the encoding
+static void setGroups(PairsData *d, int pieceCount, bool hasPawns, bool hasUniquePieces, int otherPawns, const int *order, int file) {
+    const Encoding &e = ENCODING;
+
+    int n = 0;
+    int firstLen = hasPawns ? 0 : hasUniquePieces ? 3 : 2;
+    d->groupLen[n] = 1;
+
+    for (int i = 1; i < pieceCount; ++i) {
+        if (--firstLen > 0 or d->pieces[i] == d->pieces[i - 1]) ++d->groupLen[n];
+        else d->groupLen[++n] = 1;
+    }
+
+    d->groupLen[++n] = 0;
+
+    bool bothPawns = hasPawns and otherPawns > 0;
+    int next = bothPawns ? 2 : 1;
+    int freeSquares = 64 - d->groupLen[0] - (bothPawns ? d->groupLen[1] : 0);
+    U64 idx = 1;
+
+    for (int k = 0; next < n or k == order[0] or k == order[1]; ++k) {
+        if (k == order[0]) {
+            // Leading pawns or pieces
+            d->groupIdx[0] = idx;
+            idx *= hasPawns ? e.leadPawnsSize[d->groupLen[0]][file] : hasUniquePieces ? 31332 : 462;
+        } else if (k == order[1]) {
+            // Remaining pawns
+            d->groupIdx[1] = idx;
+            idx *= e.binomial[d->groupLen[1]][48 - d->groupLen[0]];
+        } else {
+            // Remaining pieces
+            d->groupIdx[next] = idx;
+            idx *= e.binomial[d->groupLen[next]][freeSquares];
+            freeSquares -= d->groupLen[next++];
+        }
+    }
+
+    d->groupIdx[n] = idx;
+}
+
+// Value number idx of the table
+static int decompressPairs(const PairsData *d, U64 idx) {
+    if (d->flags & SINGLE_VALUE_FLAG) return d->minSymLen;
+
+    // The sparse index gives a block and offset near idx, which are then moved to the exact value
+    uint32_t k = idx / d->span;
+    uint32_t block = readLE32(d->sparseIndex + 6 * k);
+    int offset = readLE16(d->sparseIndex + 6 * k + 4);
+
+    offset += int(idx % d->span) - int(d->span / 2);
+
+    while (offset < 0) offset += readLE16(d->blockLength + 2 * --block) + 1;
+
+    while (offset > readLE16(d->blockLength + 2 * block)) offset -= readLE16(d->blockLength + 2 * block++) + 1;
+
+    // Walk the symbols of the block until the one covering offset
+    const uint8_t *ptr = d->data + U64(block) * d->sizeofBlock;
+    U64 buf64 = readBE64(ptr);
+    ptr += 8;
+    int buf64Size = 64;
+    int symbol;
+
+    while (true) {
+        int len = 0;
+        while (buf64 < d->base64[len]) ++len;
+
+        symbol = int((buf64 - d->base64[len]) >> (64 - len - d->minSymLen));
+        symbol += readLE16(d->lowestSym + 2 * len);
+
+        if (offset < d->symlen[symbol] + 1) break;
+
+        offset -= d->symlen[symbol] + 1;
+        len += d->minSymLen;
+        buf64 <<= len;
+        buf64Size -= len;
+
+        if (buf64Size <= 32) {
+            buf64Size += 32;
+            buf64 |= U64(readBE32(ptr)) << (64 - buf64Size);
+            ptr += 4;
+        }
+    }
+
+    // Expand the symbol down to the single value at offset
+    while (d->symlen[symbol]) {
+        int left = d->left(symbol);
+
+        if (offset < d->symlen[left] + 1) {
+            symbol = left;
+        } else {
+            offset -= d->symlen[left] + 1;
+            symbol = d->right(symbol);
+        }
+    }
+
+    return d->left(symbol);
+}
+
+// DTZ value stored before the next capture or pawn move, given the result after it
+static int dtzBeforeZeroing(int wdl) {
+    switch (wdl) {
+        case wdlWin: return 1;
+        case wdlCursedWin: return 101;
+        case wdlBlessedLoss: return -101;
+        case wdlLoss: return -1;
+        default: return 0;
+    }
+}
+
+static int sign(int value) {
+    return (value > 0) - (value < 0);
+}
+
+// Removes the moves ranked below the best one
+static void keepBestRanked(std::vector<CMove> *moves, const std::vector<int> &ranks) {
+    int best = *std::max_element(ranks.begin(), ranks.end());
+    std::size_t kept = 0;
+
+    for (std::size_t i = 0; i < moves->size(); ++i) {
+        if (ranks[i] == best) (*moves)[kept++] = (*moves)[i];
+    }
+
+    moves->resize(kept);
+}
+
+// Material counts from a table name such as KRPvKR, indexed by colour and table piece type
+static bool parseName(const std::string &name, std::array<std::array<int, 7>, 2> *counts) {
+    *counts = {};
+    int colour = 0;
+
+    for (char c : name) {
+        if (c == 'v' and colour == 0) {
+            colour = 1;
+            continue;
+        }
+
+        const char *letter = std::strchr(TB_LETTERS + 1, c);
+        if (c == '\0' or !letter) return false;
+
+        ++(*counts)[colour][letter - TB_LETTERS];
+    }
+
+    return colour == 1 and (*counts)[0][6] == 1 and (*counts)[1][6] == 1;
+}
+
+static U64 countsKey(const std::array<int, 7> &white, const std::array<int, 7> &black) {
+    U64 key = 0;
+
+    for (int type = 1; type <= 6; ++type) {
+        key |= U64(white[type]) << (4 * (type - 1));
+        key |= U64(black[type]) << (4 * (type + 5));
+    }
+
+    return key;
+}
+
+CSyzygy::CSyzygy() : maxPieces_(0) {}
+
+CSyzygy::~CSyzygy() = default;
+
+int CSyzygy::init(const std::string &paths) {
+    CSyzygy::clear();
+
+    std::istringstream ss(paths);
+    std::string directory;
+
+    while (std::getline(ss, directory, ':')) {
+        std::error_code error;
+
+        for (auto &entry : std::filesystem::directory_iterator(directory, error)) {
+            std::string extension = entry.path().extension().string();
+            std::string name = entry.path().stem().string();
+
+            if (extension == ".rtbw") CSyzygy::loadTable(entry.path().string(), name, false);
+            else if (extension == ".rtbz") CSyzygy::loadTable(entry.path().string(), name, true);
+        }
+    }
+
+    // Each WDL table is indexed under one or two keys
+    int count = 0;
+    for (auto &table : tables_) {
+        if (!table->dtz) ++count;
+    }
+
+    return count;
+}
+
+void CSyzygy::clear() {
+    wdlTables_.clear();
+    dtzTables_.clear();
+    tables_.clear();
+    maxPieces_ = 0;
+}
+
+int CSyzygy::maxPieces() const {
+    return maxPieces_;
+}
+
+bool CSyzygy::loadTable(const std::string &path, const std::string &name, bool dtz) {
+    std::array<std::array<int, 7>, 2> counts;
+    if (!parseName(name, &counts)) return false;
+
+    auto table = std::make_unique<Table>();
+    Table &e = *table;
+
+    e.dtz = dtz;
+    e.key = countsKey(counts[0], counts[1]);
+    e.key2 = countsKey(counts[1], counts[0]);
+
+    auto &index = dtz ? dtzTables_ : wdlTables_;
+    if (index.count(e.key)) return false;
+
+    for (int colour = 0; colour < 2; ++colour) {
+        for (int type = 1; type <= 6; ++type) {
+            e.pieceCount += counts[colour][type];
+            if (type < 6 and counts[colour][type] == 1) e.hasUniquePieces = true;
+        }
+    }
+
+    if (e.pieceCount > MAX_PIECES) return false;
+
+    // The leading colour is the one with fewer pawns, which compresses better
+    int whitePawns = counts[0][1];
+    int blackPawns = counts[1][1];
+    bool whiteLeads = blackPawns == 0 or (whitePawns > 0 and blackPawns >= whitePawns);
+
+    e.hasPawns = whitePawns + blackPawns > 0;
+    e.pawnCount = { whiteLeads ? whitePawns : blackPawns, whiteLeads ? blackPawns : whitePawns };
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 or info.st_size < 16) {
+        ::close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) return false;
+
+    // Probes touch a few scattered blocks
+    madvise(mapping, info.st_size, MADV_RANDOM);
+
+    e.mapping = static_cast<const uint8_t *>(mapping);
+    e.length = info.st_size;
+
+    const uint8_t *data = e.mapping;
+    const uint8_t *end = e.mapping + e.length;
+    const auto &magic = dtz ? DTZ_MAGIC : WDL_MAGIC;
+
+    if (!std::equal(magic.begin(), magic.end(), data)) return false;
+    data += magic.size();
+
+    if (bool(*data & HAS_PAWNS_FLAG) != e.hasPawns) return false;
+    ++data;
+
+    // WDL tables hold both sides to move unless the material is the same for both colours
+    int sides = !dtz and e.key != e.key2 ? 2 : 1;
+    int maxFile = e.hasPawns ? 3 : 0;
+    bool bothPawns = e.hasPawns and e.pawnCount[1] > 0;
+
+    for (int file = 0; file <= maxFile; ++file) {
+        if (data + 1 + bothPawns + e.pieceCount > end) return false;
+
+        int order[2][2] = {
+            { *data & 0xF, bothPawns ? *(data + 1) & 0xF : 0xF },
+            { *data >> 4, bothPawns ? *(data + 1) >> 4 : 0xF }
+        };
+        data += 1 + bothPawns;
+
+        for (int k = 0; k < e.pieceCount; ++k, ++data) {
+            for (int i = 0; i < sides; ++i) e.get(i, file)->pieces[k] = i ? *data >> 4 : *data & 0xF;
+        }
+
+        for (int i = 0; i < sides; ++i) {
+            setGroups(e.get(i, file), e.pieceCount, e.hasPawns, e.hasUniquePieces, e.pawnCount[1], order[i], file);
+        }
+    }
+
+    // Word alignment, the mapping itself is page aligned
+    data += (data - e.mapping) & 1;
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            data = setSizes(e.get(i, file), data, end);
+            if (!data) return false;
+        }
+    }
+
+    if (dtz) {
+        e.map = data;
+
+        for (int file = 0; file <= maxFile; ++file) {
+            PairsData *d = e.get(0, file);
+            if (!(d->flags & MAPPED_FLAG)) continue;
+
+            if (d->flags & WIDE_FLAG) {
+                data += (data - e.mapping) & 1;
+
+                for (int i = 0; i < 4; ++i) {
+                    if (data + 2 > end) return false;
+                    d->mapIdx[i] = (data - e.map) / 2 + 1;
+                    data += 2 * readLE16(data) + 2;
+                }
+            } else {
+                for (int i = 0; i < 4; ++i) {
+                    if (data + 1 > end) return false;
+                    d->mapIdx[i] = data - e.map + 1;
+                    data += *data + 1;
+                }
+            }
+        }
+
+        data += (data - e.mapping) & 1;
+    }
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            PairsData *d = e.get(i, file);
+            d->sparseIndex = data;
+            data += 6 * d->sparseIndexSize;
+        }
+    }
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            PairsData *d = e.get(i, file);
+            d->blockLength = data;
+            data += 2 * d->blockLengthSize;
+        }
+    }
+
+    for (int file = 0; file <= maxFile; ++file) {
+        for (int i = 0; i < sides; ++i) {
+            PairsData *d = e.get(i, file);
+            if (d->numBlocks == 0) continue;
+
+            // Blocks are 64 byte aligned
+            data = e.mapping + (((data - e.mapping) + 0x3F) & ~std::ptrdiff_t(0x3F));
+            d->data = data;
+            data += d->numBlocks * d->sizeofBlock;
+        }
+    }
+
+    if (data > end) return false;
+
+    index[e.key] = table.get();
+    index[e.key2] = table.get();
+
+    if (!dtz) maxPieces_ = std::max(maxPieces_, e.pieceCount);
+
+    tables_.push_back(std::move(table));
+
+    return true;
+}
+
+U64 CSyzygy::materialKey(const CBoard &board, bool mirrored) {
+    std::array<std::array<int, 7>, 2> counts = {};
+
+    for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+        counts[0][TB_TYPE[piece]] = Bitboard::popcount(board.getPieceSet(static_cast<enumPiece>(piece), enumPiece::nWhite));
+        counts[1][TB_TYPE[piece]] = Bitboard::popcount(board.getPieceSet(static_cast<enumPiece>(piece), enumPiece::nBlack));
+    }
+
+    return mirrored ? countsKey(counts[1], counts[0]) : countsKey(counts[0], counts[1]);
+}
+
+int CSyzygy::probeTable(const CBoard &board, bool dtz, int wdl, ProbeState *state) const {
+    const Encoding &enc = ENCODING;
+
+    U64 occupied = board.getOccupiedSquares();
+
+    // KvK has no table
+    if (Bitboard::popcount(occupied) == 2) return wdlDraw;
+
+    const auto &index = dtz ? dtzTables_ : wdlTables_;
+    auto found = index.find(CSyzygy::materialKey(board, false));
+
+    if (found == index.end()) {
+        *state = probeFail;
+        return 0;
+    }
+
+    Table *entry = found->second;
+
+    // Tables are stored with the stronger side as White, and symmetric ones only with White to move
+    // Otherwise the colours are swapped and the board flipped vertically
+    int sideToMove = board.getSideToMove();
+    bool symmetricBlackToMove = entry->key == entry->key2 and sideToMove == enumColour::black;
+    bool blackStronger = CSyzygy::materialKey(board, false) != entry->key;
+    bool flip = symmetricBlackToMove or blackStronger;
+
+    int flipColour = flip ? 8 : 0;
+    int flipSquares = flip ? 56 : 0;
+    int stm = flip ^ sideToMove;
+
+    std::array<int, MAX_PIECES> squares;
+    std::array<int, MAX_PIECES> pieces;
+    int size = 0;
+    int leadPawnsCount = 0;
+    U64 leadPawns = 0;
+    int tbFile = 0;
+
+    // Pawn tables are split by the file of the leading pawn
+    if (entry->hasPawns) {
+        int leadColour = (entry->get(0, 0)->pieces[0] ^ flipColour) >> 3;
+        leadPawns = board.getPieceSet(enumPiece::nPawn, leadColour ? enumPiece::nBlack : enumPiece::nWhite);
+
+        for (auto square : Bitboard::squares(leadPawns)) squares[size++] = (square ^ 56) ^ flipSquares;
+
+        leadPawnsCount = size;
+        std::swap(squares[0], *std::max_element(squares.begin(), squares.begin() + leadPawnsCount, pawnsCompare));
+
+        tbFile = std::min(squares[0] & 7, 7 - (squares[0] & 7));
+    }
+
+    // DTZ tables only hold one side to move
+    if (dtz) {
+        PairsData *d = entry->get(stm, tbFile);
+        bool stmMatches = (d->flags & STM_FLAG) == stm or (entry->key == entry->key2 and !entry->hasPawns);
+
+        if (!stmMatches) {
+            *state = probeChangeStm;
+            return 0;
+        }
+    }
+
+    for (auto square : Bitboard::squares(occupied & ~leadPawns)) {
+        uint8_t code = board.pieceOn(square);
+
+        squares[size] = (square ^ 56) ^ flipSquares;
+        pieces[size++] = (TB_TYPE[code & Constants::PIECE_TYPE_MASK] | ((code >> Constants::PIECE_COLOUR_SHIFT) << 3)) ^ flipColour;
+    }
+
+    PairsData *d = entry->get(stm, tbFile);
+
+    // Reorder the pieces to the sequence the table was encoded with
+    for (int i = leadPawnsCount; i < size - 1; ++i) {
+        for (int j = i + 1; j < size; ++j) {
+            if (d->pieces[i] == pieces[j]) {
+                std::swap(pieces[i], pieces[j]);
+                std::swap(squares[i], squares[j]);
+                break;
+            }
+        }
+    }
+
+    // Mirror so the leading piece is on files a-d
+    if ((squares[0] & 7) > 3) {
+        for (int i = 0; i < size; ++i) squares[i] = flipFile(squares[i]);
+    }
+
+    U64 idx;
+    int next = 0;
+
+    if (entry->hasPawns) {
+        idx = enc.leadPawnIdx[leadPawnsCount][squares[0]];
+
+        std::stable_sort(squares.begin() + 1, squares.begin() + leadPawnsCount, pawnsCompare);
+
+        for (int i = 1; i < leadPawnsCount; ++i) idx += enc.binomial[i][enc.mapPawns[squares[i]]];
+    } else {
+        // Without pawns the board can also be flipped vertically and along the a1-h8 diagonal
+        if ((squares[0] >> 3) > 3) {
+            for (int i = 0; i < size; ++i) squares[i] = flipRank(squares[i]);
+        }
+
+        for (int i = 0; i < d->groupLen[0]; ++i) {
+            if (!offA1H8(squares[i])) continue;
+
+            if (offA1H8(squares[i]) > 0) {
+                for (int j = i; j < size; ++j) squares[j] = ((squares[j] >> 3) | (squares[j] << 3)) & 63;
+            }
+
+            break;
+        }
+
+        if (entry->hasUniquePieces) {
+            // The first three pieces are encoded together
+            int adjust1 = squares[1] > squares[0];
+            int adjust2 = (squares[2] > squares[0]) + (squares[2] > squares[1]);
+
+            if (offA1H8(squares[0])) {
+                idx = (enc.mapA1D1D4[squares[0]] * 63 + (squares[1] - adjust1)) * 62 + squares[2] - adjust2;
+            } else if (offA1H8(squares[1])) {
+                idx = (6 * 63 + (squares[0] >> 3) * 28 + enc.mapB1H1H7[squares[1]]) * 62 + squares[2] - adjust2;
+            } else if (offA1H8(squares[2])) {
+                idx = 6 * 63 * 62 + 4 * 28 * 62 + (squares[0] >> 3) * 7 * 28
+                    + ((squares[1] >> 3) - adjust1) * 28 + enc.mapB1H1H7[squares[2]];
+            } else {
+                idx = 6 * 63 * 62 + 4 * 28 * 62 + 4 * 7 * 28 + (squares[0] >> 3) * 7 * 6
+                    + ((squares[1] >> 3) - adjust1) * 6 + ((squares[2] >> 3) - adjust2);
+            }
+        } else {
+            // Only the kings
+            idx = enc.mapKK[enc.mapA1D1D4[squares[0]]][squares[1]];
+        }
+    }
+
+    idx *= d->groupIdx[0];
+
+    // Remaining pawns and then pieces, each group in ascending square order
+    int *groupSquares = squares.data() + d->groupLen[0];
+    bool remainingPawns = entry->hasPawns and entry->pawnCount[1] > 0;
+
+    while (d->groupLen[++next]) {
+        std::stable_sort(groupSquares, groupSquares + d->groupLen[next]);
+        U64 n = 0;
+
+        // Squares taken by earlier groups are skipped
+        for (int i = 0; i < d->groupLen[next]; ++i) {
+            int adjust = std::count_if(squares.data(), groupSquares, [&](int square) { return groupSquares[i] > square; });
+            n += enc.binomial[i + 1][groupSquares[i] - adjust - 8 * remainingPawns];
+        }
+
+        remainingPawns = false;
+        idx += n * d->groupIdx[next];
+        groupSquares += d->groupLen[next];
+    }
+
+    int value = decompressPairs(d, idx);
+
+    if (!dtz) return value - 2;
+
+    // DTZ values may be stored through a map and in moves rather than plies
+    constexpr int WDL_MAP[] = { 1, 3, 0, 2, 0 };
+    PairsData *first = entry->get(0, tbFile);
+
+    if (first->flags & MAPPED_FLAG) {
+        int offset = first->mapIdx[WDL_MAP[wdl + 2]] + value;
+        value = first->flags & WIDE_FLAG ? readLE16(entry->map + 2 * offset) : entry->map[offset];
+    }
+
+    if ((wdl == wdlWin and !(first->flags & WIN_PLIES_FLAG))
+        or (wdl == wdlLoss and !(first->flags & LOSS_PLIES_FLAG))
+        or wdl == wdlCursedWin or wdl == wdlBlessedLoss) value *= 2;
+
+    return value + 1;
+}
+
+int CSyzygy::searchZeroing(CBoard &board, bool checkZeroing, ProbeState *state, MoveLists *lists, int ply) const {
+    if (ply >= PROBE_DEPTH) {
+        *state = probeFail;
+        return wdlDraw;
+    }
+
+    // Tables store "don't care" values where a capture wins, so captures are searched first
+    int bestValue = wdlLoss;
+
+    std::vector<CMove> &moves = (*lists)[ply];
+    moves.clear();
+    board.generateLegalMoves(&moves);
+    std::size_t moveCount = 0;
+
+    for (auto move : moves) {
+        bool pawnMove = board.pieceTypeOn(static_cast<enumSquare>(move.getFrom())) == enumPiece::nPawn;
+        if (!move.isCapture() and !(checkZeroing and pawnMove)) continue;
+
+        ++moveCount;
+
+        board.makeMove(move);
+        int value = -CSyzygy::searchZeroing(board, false, state, lists, ply + 1);
+        board.unmakeMove(move);
+
+        if (*state == probeFail) return wdlDraw;
+
+        if (value > bestValue) {
+            bestValue = value;
+
+            if (value >= wdlWin) {
+                *state = probeZeroingBestMove;
+                return value;
+            }
+        }
+    }
+
+    // When every move was searched the table is not needed, it would be wrong with en passant anyway
+    bool noMoreMoves = moveCount > 0 and moveCount == moves.size();
+    int value = bestValue;
+
+    if (!noMoreMoves) {
+        value = CSyzygy::probeTable(board, false, wdlDraw, state);
+        if (*state == probeFail) return wdlDraw;
+    }
+
+    if (bestValue >= value) {
+        *state = bestValue > wdlDraw or noMoreMoves ? probeZeroingBestMove : probeOk;
+        return bestValue;
+    }
+
+    *state = probeOk;
+    return value;
+}
+
+bool CSyzygy::probeWdl(CBoard &board, int *wdl) const {
+    MoveLists lists;
+    return CSyzygy::probeWdl(board, wdl, &lists);
+}
+
+bool CSyzygy::probeWdl(CBoard &board, int *wdl, MoveLists *lists) const {
+    if (board.getCastleState()) return false;
+
+    ProbeState state = probeOk;
+    *wdl = CSyzygy::searchZeroing(board, false, &state, lists, 0);
+
+    return state != probeFail;
+}
+
+bool CSyzygy::probeDtz(CBoard &board, int *dtz) const {
+    MoveLists lists;
+    return CSyzygy::probeDtz(board, dtz, &lists);
+}
+
+bool CSyzygy::probeDtz(CBoard &board, int *dtz, MoveLists *lists) const {
+    if (board.getCastleState()) return false;
+
+    ProbeState state = probeOk;
+    *dtz = CSyzygy::probeDtz(board, &state, lists, 0);
+
+    return state != probeFail;
+}
+
+int CSyzygy::probeDtz(CBoard &board, ProbeState *state, MoveLists *lists, int ply) const {
+    *state = probeOk;
+    int wdl = CSyzygy::searchZeroing(board, true, state, lists, ply);
+
+    // Draws are not stored
+    if (*state == probeFail or wdl == wdlDraw) return 0;
+
+    if (*state == probeZeroingBestMove) return dtzBeforeZeroing(wdl);
+
+    int dtz = CSyzygy::probeTable(board, true, wdl, state);
+    if (*state == probeFail) return 0;
+
+    if (*state != probeChangeStm) {
+        return (dtz + 100 * (wdl == wdlBlessedLoss or wdl == wdlCursedWin)) * sign(wdl);
+    }
+
+    // The table holds the other side to move, so take the best DTZ one ply ahead
+    int minDtz = 0xFFFF;
+
+    // searchZeroing above is done with this level's list
+    std::vector<CMove> &moves = (*lists)[ply];
+    moves.clear();
+    board.generateLegalMoves(&moves);
+
+    for (auto move : moves) {
+        bool zeroing = move.isCapture() or board.pieceTypeOn(static_cast<enumSquare>(move.getFrom())) == enumPiece::nPawn;
+
+        board.makeMove(move);
+
+        // For a zeroing move only the result after it matters
+        dtz = zeroing ? -dtzBeforeZeroing(CSyzygy::searchZeroing(board, false, state, lists, ply + 1))
+                      : -CSyzygy::probeDtz(board, state, lists, ply + 1);
+
+        // A mating move has DTZ 1, the probes of the move are done with the level below
+        if (dtz == 1 and board.isInCheck() and ply + 1 < PROBE_DEPTH) {
+            std::vector<CMove> &replies = (*lists)[ply + 1];
+            replies.clear();
+            board.generateLegalMoves(&replies);
+            if (replies.empty()) minDtz = 1;
+        }
+
+        if (!zeroing) dtz += sign(dtz);
+
+        if (dtz < minDtz and sign(dtz) == sign(wdl)) minDtz = dtz;
+
+        board.unmakeMove(move);
+
+        if (*state == probeFail) return 0;
+    }
+
+    // No legal moves means mate
+    return minDtz == 0xFFFF ? -1 : minDtz;
+}
+
+bool CSyzygy::rootProbe(CBoard &board, std::vector<CMove> *moves, bool rule50, int *score) const {
+    if (board.getCastleState() or moves->empty()) return false;
+
+    int halfmoves = board.getHalfmoves();
+
+    // Once the root has repeated, wins are ranked by DTZ so the engine cannot go round in circles
+    bool repeated = board.isRepetition(Constants::MAX_PLY);
+    int bound = rule50 ? MAX_DTZ - 100 : 1;
+
+    // Only probed once per search, so the lists are not worth keeping
+    MoveLists lists;
+    std::vector<int> ranks;
+
+    for (auto move : *moves) {
+        ProbeState state = probeOk;
+        int dtz;
+
+        board.makeMove(move);
+
+        if (board.getHalfmoves() == 0) {
+            // Zeroing moves only need the result after them
+            int wdl = -CSyzygy::searchZeroing(board, false, &state, &lists, 0);
+            dtz = dtzBeforeZeroing(wdl);
+        } else if (board.isDraw(1)) {
+            dtz = 0;
+        } else {
+            dtz = -CSyzygy::probeDtz(board, &state, &lists, 0);
+            dtz = dtz > 0 ? dtz + 1 : dtz < 0 ? dtz - 1 : dtz;
+        }
+
+        if (dtz == 2 and board.isInCheck()) {
+            std::vector<CMove> &replies = lists[0];
+            replies.clear();
+            board.generateLegalMoves(&replies);
+            if (replies.empty()) dtz = 1;
+        }
+
+        board.unmakeMove(move);
+
+        if (state == probeFail) return false;
+
+        // Wins inside the fifty move rule rank equally unless the root has repeated, losses rank equally
+        // unless the opponent is running out of time to win
+        int rank = dtz > 0 ? (dtz + halfmoves <= 99 and !repeated ? MAX_DTZ : MAX_DTZ - (dtz + halfmoves))
+                 : dtz < 0 ? (-dtz * 2 + halfmoves < 100 ? -MAX_DTZ : -MAX_DTZ + (-dtz + halfmoves))
+                 : 0;
+
+        ranks.push_back(rank);
+    }
+
+    keepBestRanked(moves, ranks);
+
+    // Cursed wins and blessed losses get a small score which grows as the fifty move rule gets closer
+    int rank = *std::max_element(ranks.begin(), ranks.end());
+
+    *score = rank >= bound ? Constants::TB_WIN_SCORE
+           : rank > 0 ? std::max(3, rank - (MAX_DTZ - 200)) * PAWN_SCORE / 200
+           : rank == 0 ? Constants::DRAW_SCORE
+           : rank > -bound ? std::min(-3, rank + (MAX_DTZ - 200)) * PAWN_SCORE / 200
+           : -Constants::TB_WIN_SCORE;
+
+    return true;
+}
+
+bool CSyzygy::rootProbeWdl(CBoard &board, std::vector<CMove> *moves, bool rule50, int *score) const {
+    if (board.getCastleState() or moves->empty()) return false;
+
+    constexpr int WDL_TO_RANK[] = { -MAX_DTZ, -MAX_DTZ + 101, 0, MAX_DTZ - 101, MAX_DTZ };
+    constexpr int WDL_TO_SCORE[] = {
+        -Constants::TB_WIN_SCORE, Constants::DRAW_SCORE - 2, Constants::DRAW_SCORE,
+        Constants::DRAW_SCORE + 2, Constants::TB_WIN_SCORE
+    };
+
+    MoveLists lists;
+    std::vector<int> ranks;
+    int bestWdl = wdlLoss;
+
+    for (auto move : *moves) {
+        ProbeState state = probeOk;
+
+        board.makeMove(move);
+        int wdl = -CSyzygy::searchZeroing(board, false, &state, &lists, 0);
+        board.unmakeMove(move);
+
+        if (state == probeFail) return false;
+
+        ranks.push_back(WDL_TO_RANK[wdl + 2]);
+        bestWdl = std::max(bestWdl, wdl);
+    }
+
+    keepBestRanked(moves, ranks);
+
+    // Without the fifty move rule cursed wins are wins
+    if (!rule50) bestWdl = bestWdl > wdlDraw ? wdlWin : bestWdl < wdlDraw ? wdlLoss : wdlDraw;
+
+    *score = WDL_TO_SCORE[bestWdl + 2];
+
+    return true;
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/CTrainingData.h"
+
+CTrainingData::CTrainingData() : entries_(nullptr), size_(0), length_(0) {}
+
+CTrainingData::CTrainingData(const std::string &path) : CTrainingData() {
+    if (!CTrainingData::open(path)) throw std::invalid_argument("Could not open training data " + path);
+}
+
+CTrainingData::~CTrainingData() {
+    CTrainingData::close();
+}
+
+bool CTrainingData::open(const std::string &path) {
+    CTrainingData::close();
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 or info.st_size == 0 or info.st_size % sizeof(TrainingEntry) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) return false;
+
+    // Batches are usually read in order
+    madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+
+    entries_ = static_cast<const TrainingEntry *>(mapping);
+    length_ = info.st_size;
+    size_ = length_ / sizeof(TrainingEntry);
+
+    return true;
+}
+
+void CTrainingData::close() {
+    if (entries_) munmap(const_cast<TrainingEntry *>(entries_), length_);
+
+    entries_ = nullptr;
+    size_ = 0;
+    length_ = 0;
+}
+
+bool CTrainingData::isOpen() const {
+    return entries_ != nullptr;
+}
+
+std::size_t CTrainingData::size() const {
+    return size_;
+}
+
+const TrainingEntry *CTrainingData::data() const {
+    return entries_;
+}
+
+const TrainingEntry &CTrainingData::operator[](std::size_t index) const {
+    return entries_[index];
+}
+
+TrainingEntry CTrainingData::pack(const CBoard &board, int score, int result) {
+    U64 occupied = board.getOccupiedSquares();
+    if (Bitboard::popcount(occupied) > 32) throw std::invalid_argument("Too many pieces to pack");
+
+    TrainingEntry entry = {};
+    entry.occupied = occupied;
+    entry.score = static_cast<int16_t>(std::clamp(score, -32767, 32767));
+    entry.result = static_cast<int8_t>(std::clamp(result, -1, 1));
+    entry.sideToMove = board.getSideToMove();
+
+    int index = 0;
+
+    for (auto square : Bitboard::squares(occupied)) {
+        int colour = board.pieceColourOn(square);
+        int code = colour << 3 | (board.pieceTypeOn(square) - enumPiece::nPawn);
+
+        entry.pieces[index / 2] |= code << (index % 2 * 4);
+        ++index;
+    }
+
+    return entry;
+}
+
+bool CTrainingData::unpack(const TrainingEntry &entry, std::array<U64, 8> *pieceBB) {
+    pieceBB->fill(0ULL);
+
+    U64 occupied = entry.occupied;
+    if (Bitboard::popcount(occupied) > 32) return false;
+
+    for (int index = 0; occupied; ++index) {
+        U64 squareBB = occupied & -occupied;
+        occupied ^= squareBB;
+
+        int code = entry.pieces[index / 2] >> (index % 2 * 4) & 0xF;
+        if ((code & 7) > enumPiece::nKing - enumPiece::nPawn) return false;
+
+        (*pieceBB)[code >> 3] |= squareBB;
+        (*pieceBB)[(code & 7) + enumPiece::nPawn] |= squareBB;
+    }
+
+    return true;
+}
+
+bool CTrainingData::write(const std::string &path, const std::vector<TrainingEntry> &entries) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(TrainingEntry));
+
+    return static_cast<bool>(file);
+}
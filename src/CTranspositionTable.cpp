@@ -0,0 +1,342 @@
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/profile.h"
+#include "chessbot/zobrist.h"
+
+CTranspositionTable::CTranspositionTable(std::size_t megabytes)
+    : entries_(nullptr), size_(0), generation_(&privateGeneration_), privateGeneration_(0), mapping_(nullptr), mappingLength_(0) {
+    CTranspositionTable::resize(megabytes);
+}
+
+CTranspositionTable::~CTranspositionTable() {
+    CTranspositionTable::unmapShared();
+}
+
+void CTranspositionTable::resize(std::size_t megabytes) {
+    // Allocated first, so the table is left as it was if this throws
+    std::size_t size = CTranspositionTable::entriesFor(megabytes);
+    auto entries = std::make_unique<Entry[]>(size);
+
+    CTranspositionTable::unmapShared();
+
+    size_ = size;
+    privateEntries_ = std::move(entries);
+    entries_ = privateEntries_.get();
+    generation_ = &privateGeneration_;
+
+    CTranspositionTable::clear();
+}
+
+void CTranspositionTable::clear() {
+    for (std::size_t i = 0; i < size_; ++i) {
+        entries_[i].key.store(0ULL, std::memory_order_relaxed);
+        entries_[i].data.store(0ULL, std::memory_order_relaxed);
+    }
+
+    generation_->store(0, std::memory_order_relaxed);
+}
+
+bool CTranspositionTable::openSharedMemory(const std::string &name, std::size_t megabytes) {
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    return fd >= 0 and CTranspositionTable::mapShared(fd, megabytes);
+}
+
+bool CTranspositionTable::openFile(const std::string &path, std::size_t megabytes) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    return fd >= 0 and CTranspositionTable::mapShared(fd, megabytes);
+}
+
+bool CTranspositionTable::removeSharedMemory(const std::string &name) {
+    return shm_unlink(name.c_str()) == 0;
+}
+
+bool CTranspositionTable::isShared() const {
+    return mapping_ != nullptr;
+}
+
+bool CTranspositionTable::saveSnapshot(const std::string &path, int minDepth, std::size_t *saved) const {
+    std::string partial = path + ".partial";
+    std::ofstream file(partial, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    // Rewritten with the counts once the records are out
+    SnapshotHeader header = { SNAPSHOT_MAGIC, SNAPSHOT_VERSION, 2 * sizeof(U64), Zobrist::FINGERPRINT, 0, 0 };
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    for (std::size_t i = 0; i < size_; ++i) {
+        U64 data = entries_[i].data.load(std::memory_order_relaxed);
+        U64 key = entries_[i].key.load(std::memory_order_relaxed) ^ data;
+
+        if (data == 0ULL or CTranspositionTable::depthOf(data) < minDepth) continue;
+
+        U64 record[2] = { key, data };
+        file.write(reinterpret_cast<const char *>(record), sizeof(record));
+
+        ++header.records;
+        header.checksum = CTranspositionTable::checksum(header.checksum, key, data);
+    }
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.close();
+
+    if (!file or std::rename(partial.c_str(), path.c_str()) != 0) {
+        std::remove(partial.c_str());
+        return false;
+    }
+
+    if (saved) *saved = header.records;
+
+    return true;
+}
+
+bool CTranspositionTable::loadSnapshot(const std::string &path, std::size_t *loaded) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 or static_cast<std::size_t>(info.st_size) < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) return false;
+
+    madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+
+    const auto *header = static_cast<const SnapshotHeader *>(mapping);
+    const auto *records = reinterpret_cast<const U64 *>(header + 1);
+
+    bool valid = header->magic == SNAPSHOT_MAGIC and header->version == SNAPSHOT_VERSION
+                 and header->recordSize == 2 * sizeof(U64) and header->zobrist == Zobrist::FINGERPRINT
+                 and header->records == (info.st_size - sizeof(SnapshotHeader)) / header->recordSize
+                 and (info.st_size - sizeof(SnapshotHeader)) % header->recordSize == 0;
+
+    // Checked in full before anything is added, so a damaged file leaves the table as it was
+    U64 sum = 0;
+    for (U64 i = 0; valid and i < header->records; ++i) sum = CTranspositionTable::checksum(sum, records[2 * i], records[2 * i + 1]);
+    valid = valid and sum == header->checksum;
+
+    std::size_t added = 0;
+    U64 generation = generation_->load(std::memory_order_relaxed);
+
+    for (U64 i = 0; valid and i < header->records; ++i) {
+        U64 key = records[2 * i];
+        U64 data = (records[2 * i + 1] & ~(0x3FULL << 58)) | (generation << 58);
+
+        Entry &entry = CTranspositionTable::entryFor(key);
+        U64 oldData = entry.data.load(std::memory_order_relaxed);
+
+        if (oldData != 0ULL and CTranspositionTable::depthOf(oldData) > CTranspositionTable::depthOf(data)) continue;
+
+        entry.key.store(key ^ data, std::memory_order_relaxed);
+        entry.data.store(data, std::memory_order_relaxed);
+        ++added;
+    }
+
+    munmap(mapping, info.st_size);
+
+    if (valid and loaded) *loaded = added;
+
+    return valid;
+}
+
+bool CTranspositionTable::mapShared(int fd, std::size_t megabytes) {
+    std::size_t entries = CTranspositionTable::entriesFor(megabytes);
+    std::size_t length = sizeof(SharedHeader) + entries * sizeof(Entry);
+
+    // Held while checking and setting up the header, so two processes starting together agree on who creates it
+    struct stat info;
+    bool locked = flock(fd, LOCK_EX) == 0;
+
+    if (!locked or fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    bool create = info.st_size == 0;
+
+    if ((create and ftruncate(fd, length) != 0) or (!create and static_cast<std::size_t>(info.st_size) != length)) {
+        ::close(fd);
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (mapping == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    // A new file reads as zeros, which is an empty table
+    auto header = static_cast<SharedHeader *>(mapping);
+
+    if (create) {
+        header->version = SHARED_VERSION;
+        header->entrySize = sizeof(Entry);
+        header->entries = entries;
+        header->generation.store(0, std::memory_order_relaxed);
+        header->magic.store(SHARED_MAGIC, std::memory_order_release);
+    }
+
+    bool matches = header->magic.load(std::memory_order_acquire) == SHARED_MAGIC and header->version == SHARED_VERSION
+                   and header->entrySize == sizeof(Entry) and header->entries == entries;
+
+    // The mapping keeps the file open, so closing the descriptor would not drop the lock
+    flock(fd, LOCK_UN);
+    ::close(fd);
+
+    if (!matches) {
+        munmap(mapping, length);
+        return false;
+    }
+
+    CTranspositionTable::unmapShared();
+    privateEntries_.reset();
+
+    mapping_ = mapping;
+    mappingLength_ = length;
+    entries_ = reinterpret_cast<Entry *>(static_cast<char *>(mapping) + sizeof(SharedHeader));
+    size_ = entries;
+    generation_ = &header->generation;
+
+    return true;
+}
+
+void CTranspositionTable::unmapShared() {
+    if (!mapping_) return;
+
+    munmap(mapping_, mappingLength_);
+    mapping_ = nullptr;
+    mappingLength_ = 0;
+    entries_ = nullptr;
+    size_ = 0;
+    generation_ = &privateGeneration_;
+}
+
+// FNV style, order dependent so records swapped between positions are caught
+U64 CTranspositionTable::checksum(U64 sum, U64 key, U64 data) {
+    sum = (sum ^ key) * 0x100000001B3ULL;
+    return (sum ^ data) * 0x100000001B3ULL;
+}
+
+// Largest power of two number of entries that fits, so the index is a mask of the key
+std::size_t CTranspositionTable::entriesFor(std::size_t megabytes) {
+    return std::bit_floor(std::max<std::size_t>(megabytes * 1024 * 1024 / sizeof(Entry), 1));
+}
+
+// Searches sharing the table may start at the same time, losing one of their increments does no harm
+void CTranspositionTable::newSearch() {
+    generation_->store((generation_->load(std::memory_order_relaxed) + 1) & 0x3F, std::memory_order_relaxed);
+}
+
+bool CTranspositionTable::probe(U64 key, TTData *data) const {
+    PROFILE_SCOPE(ttProbe);
+
+    Entry &entry = CTranspositionTable::entryFor(key);
+    U64 entryKey = entry.key.load(std::memory_order_relaxed);
+    U64 entryData = entry.data.load(std::memory_order_relaxed);
+
+    if ((entryKey ^ entryData) != key or entryData == 0ULL) return false;
+
+    unsigned int move = entryData & 0xFFFF;
+    data->move = CMove(
+        static_cast<enumSquare>((move >> 6) & 0x3F),
+        static_cast<enumSquare>(move & 0x3F),
+        move >> 12
+    );
+    data->score = static_cast<int16_t>(entryData >> 16);
+    data->eval = static_cast<int16_t>(entryData >> 32);
+    data->depth = CTranspositionTable::depthOf(entryData);
+    data->bound = static_cast<enumBound>((entryData >> 56) & 0x3);
+
+    return true;
+}
+
+bool CTranspositionTable::isCollision(U64 key) const {
+    Entry &entry = CTranspositionTable::entryFor(key);
+    U64 entryData = entry.data.load(std::memory_order_relaxed);
+
+    return entryData != 0ULL and (entry.key.load(std::memory_order_relaxed) ^ entryData) != key;
+}
+
+void CTranspositionTable::store(U64 key, CMove move, int score, int eval, int depth, enumBound bound) {
+    PROFILE_SCOPE(ttStore);
+
+    Entry &entry = CTranspositionTable::entryFor(key);
+    uint8_t generation = generation_->load(std::memory_order_relaxed);
+    U64 oldData = entry.data.load(std::memory_order_relaxed);
+    bool samePosition = (entry.key.load(std::memory_order_relaxed) ^ oldData) == key;
+
+    // Keep deeper results for the same position unless the new one is exact,
+    // anything from an earlier search or for a different position is replaced
+    if (samePosition and bound != enumBound::exactBound
+        and CTranspositionTable::generationOf(oldData) == generation
+        and depth < CTranspositionTable::depthOf(oldData) - 2) return;
+
+    // An entry without a move keeps the one already stored for the position
+    if (samePosition and move.getFrom() == move.getTo()) {
+        U64 oldMove = oldData & 0xFFFF;
+        move = CMove(
+            static_cast<enumSquare>((oldMove >> 6) & 0x3F),
+            static_cast<enumSquare>(oldMove & 0x3F),
+            oldMove >> 12
+        );
+    }
+
+    U64 data = CTranspositionTable::pack(move, score, eval, depth, bound, generation);
+    entry.key.store(key ^ data, std::memory_order_relaxed);
+    entry.data.store(data, std::memory_order_relaxed);
+}
+
+int CTranspositionTable::hashfull() const {
+    std::size_t sample = size_ < 1000 ? size_ : 1000;
+    uint8_t generation = generation_->load(std::memory_order_relaxed);
+    int used = 0;
+
+    for (std::size_t i = 0; i < sample; ++i) {
+        U64 data = entries_[i].data.load(std::memory_order_relaxed);
+        if (data != 0ULL and CTranspositionTable::generationOf(data) == generation) ++used;
+    }
+
+    return used * 1000 / sample;
+}
+
+std::size_t CTranspositionTable::getSize() const {
+    return size_;
+}
+
+U64 CTranspositionTable::pack(CMove move, int score, int eval, int depth, enumBound bound, uint8_t generation) {
+    U64 packedMove = (move.getFlags() << 12) | (move.getFrom() << 6) | move.getTo();
+
+    return packedMove
+         | (U64(uint16_t(score)) << 16)
+         | (U64(uint16_t(eval)) << 32)
+         | (U64(uint8_t(depth)) << 48)
+         | (U64(bound) << 56)
+         | (U64(generation) << 58);
+}
+
+uint8_t CTranspositionTable::generationOf(U64 data) {
+    return data >> 58;
+}
+
+int CTranspositionTable::depthOf(U64 data) {
+    return static_cast<int8_t>(data >> 48);
+}
+
+CTranspositionTable::Entry &CTranspositionTable::entryFor(U64 key) const {
+    return entries_[key & (size_ - 1)];
+}
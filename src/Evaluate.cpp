@@ -0,0 +1,45 @@
+#include "chessbot/bitbase.h"
+#include "chessbot/bitboard.h"
+#include "chessbot/eval_weights.h"
+#include "chessbot/evaluate.h"
+#include "chessbot/profile.h"
+
+// Added to the score of a won king and pawn ending, well below tablebase wins
+constexpr int KPK_WIN_BONUS = 1000;
+
+int Evaluation::evaluate(const CBoard &board) {
+    PROFILE_SCOPE(eval);
+
+    // King and pawn against king is known exactly, wins keep the usual score on top so the pawn still advances
+    bool kpkWin = false;
+    if (Bitbase::probeKpk(board, &kpkWin) and !kpkWin) return 0;
+
+    int mg = 0;
+    int eg = 0;
+    int phase = 0;
+
+    for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+        auto type = static_cast<enumPiece>(piece);
+
+        for (auto square : Bitboard::squares(board.getPieceSet(type, enumPiece::nWhite))) {
+            mg += EvalWeights::MATERIAL_MG[piece] + EvalWeights::PST_MG[piece][square];
+            eg += EvalWeights::MATERIAL_EG[piece] + EvalWeights::PST_EG[piece][square];
+            phase += EvalWeights::PHASE[piece];
+        }
+
+        // Flipping the rank mirrors the square onto White's side of the board
+        for (auto square : Bitboard::squares(board.getPieceSet(type, enumPiece::nBlack))) {
+            mg -= EvalWeights::MATERIAL_MG[piece] + EvalWeights::PST_MG[piece][square ^ 56];
+            eg -= EvalWeights::MATERIAL_EG[piece] + EvalWeights::PST_EG[piece][square ^ 56];
+            phase += EvalWeights::PHASE[piece];
+        }
+    }
+
+    // Promotions can push the phase past the starting material
+    if (phase > EvalWeights::PHASE_MAX) phase = EvalWeights::PHASE_MAX;
+
+    int score = (mg * phase + eg * (EvalWeights::PHASE_MAX - phase)) / EvalWeights::PHASE_MAX;
+    if (kpkWin) score += board.getPieceSet(enumPiece::nPawn, enumPiece::nWhite) ? KPK_WIN_BONUS : -KPK_WIN_BONUS;
+
+    return board.getSideToMove() == enumColour::white ? score : -score;
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chessbot/bench.h"
+#include "chessbot/CEngineClient.h"
+#include "chessbot/loadgen.h"
+
+double LoadGen::LoadReport::requestsPerSecond() const {
+    return seconds > 0.0 ? requests / seconds : 0.0;
+}
+
+// Plays games on one session until its requests are used up
+static void runClient(const LoadGen::LoadConfig &config, int client, LoadGen::LoadReport *report) {
+    CEngineClient engine;
+
+    if (!engine.connect(config.socketPath)) {
+        report->errors += config.requests;
+        return;
+    }
+
+    std::string go = config.nodes > 0 ? "go nodes " + std::to_string(config.nodes) + "\n"
+                                      : "go movetime " + std::to_string(config.movetime) + "\n";
+
+    std::size_t position = client % Bench::POSITIONS.size();
+    std::string moves;
+    int plies = 0;
+    std::vector<std::string> lines;
+
+    for (int i = 0; i < config.requests; ++i) {
+        std::string commands = "position fen " + Bench::POSITIONS[position] + (moves.empty() ? "" : " moves" + moves) + "\n" + go;
+
+        lines.clear();
+        auto start = std::chrono::steady_clock::now();
+
+        if (!engine.request(commands, "bestmove", &lines)) {
+            report->errors += config.requests - i;
+            return;
+        }
+
+        report->latency.record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        ++report->requests;
+
+        // Anything but the search's info line is the service complaining about the request
+        if (lines.size() != 2) ++report->errors;
+
+        std::string bestMove = lines.back().substr(std::string("bestmove ").size());
+
+        if (bestMove == "0000" or ++plies >= config.maxPlies) {
+            position = (position + config.clients) % Bench::POSITIONS.size();
+            moves.clear();
+            plies = 0;
+        } else {
+            moves += " " + bestMove;
+        }
+    }
+
+    engine.send("quit\n");
+}
+
+LoadGen::LoadReport LoadGen::run(const LoadConfig &config) {
+    int clients = std::max(1, config.clients);
+    std::vector<LoadReport> reports(clients);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < clients; ++i) threads.emplace_back(runClient, std::cref(config), i, &reports[i]);
+    for (auto &thread : threads) thread.join();
+
+    LoadReport report;
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (auto &client : reports) {
+        report.latency.merge(client.latency);
+        report.requests += client.requests;
+        report.errors += client.errors;
+    }
+
+    return report;
+}
+
+void LoadGen::print(const LoadReport &report, std::ostream &out) {
+    const LatencyHistogram &latency = report.latency;
+
+    out << "Requests        : " << report.requests << "\n"
+        << "Errors          : " << report.errors << "\n"
+        << "Total time (ms) : " << static_cast<U64>(report.seconds * 1000) << "\n"
+        << "Requests/second : " << static_cast<U64>(report.requestsPerSecond()) << "\n"
+        << "Latency (us)    : mean " << static_cast<U64>(latency.mean()) << " p50 " << latency.percentile(0.5)
+        << " p90 " << latency.percentile(0.9) << " p99 " << latency.percentile(0.99) << " max " << latency.max << std::endl;
+}
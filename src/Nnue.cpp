@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <atomic>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/nnue.h"
+#include "chessbot/parallel.h"
+
+// A position takes under 100ns to extract against about 10us to start a thread, so a slice this long
+// keeps the start to a tenth of the work
+constexpr std::size_t MIN_THREAD_POSITIONS = 1024;
+
+// Squares are flipped for Black, so both perspectives see their own pieces start on ranks 1 and 2
+static int orient(int square, enumColour perspective) {
+    return perspective == enumColour::white ? square : square ^ 56;
+}
+
+// Both rows of position i, padded with -1, or rows of nothing but -1 and false when the position is rejected
+// Whether a board is accepted does not depend on the perspective, so only White's is checked
+static bool writeRows(const std::array<U64, 8> &pieceBB, bool unpacked, Nnue::enumFeatureSet set, const Nnue::FeatureBatch &batch, std::size_t i) {
+    int32_t *white = batch.white + i * Nnue::MAX_ACTIVE;
+    int32_t *black = batch.black + i * Nnue::MAX_ACTIVE;
+
+    int whiteActive = unpacked ? Nnue::activeFeatures(pieceBB, enumColour::white, set, white) : -1;
+
+    if (whiteActive < 0) {
+        std::fill(white, white + Nnue::MAX_ACTIVE, -1);
+        std::fill(black, black + Nnue::MAX_ACTIVE, -1);
+        return false;
+    }
+
+    int blackActive = Nnue::activeFeatures(pieceBB, enumColour::black, set, black);
+
+    std::fill(white + whiteActive, white + Nnue::MAX_ACTIVE, -1);
+    std::fill(black + blackActive, black + Nnue::MAX_ACTIVE, -1);
+    return true;
+}
+
+int Nnue::featureCount(enumFeatureSet set) {
+    return set == halfKP ? HALFKP_FEATURES : HALFKA_FEATURES;
+}
+
+int Nnue::activeFeatures(const std::array<U64, 8> &pieceBB, enumColour perspective, enumFeatureSet set, int32_t *features) {
+    const int pieceTypes = set == halfKP ? 5 : 6;
+    const U64 own = pieceBB[perspective];
+    const U64 kings = pieceBB[enumPiece::nKing];
+    const U64 occupied = pieceBB[enumPiece::nWhite] | pieceBB[enumPiece::nBlack];
+
+    // A missing king has no square to index by, and extra pieces would overrun the caller's row
+    if (Bitboard::popcount(kings & pieceBB[enumPiece::nWhite]) != 1 or Bitboard::popcount(kings & pieceBB[enumPiece::nBlack]) != 1) return -1;
+    if (Bitboard::popcount(set == halfKP ? occupied & ~kings : occupied) > MAX_ACTIVE) return -1;
+
+    const int kingSquare = orient(Bitboard::lsb(pieceBB[enumPiece::nKing] & own), perspective);
+    const int kingBase = kingSquare * pieceTypes * 2 * 64;
+
+    int active = 0;
+
+    for (int piece = enumPiece::nPawn; piece < enumPiece::nPawn + pieceTypes; ++piece) {
+        for (int side = 0; side < 2; ++side) {
+            U64 pieces = pieceBB[piece] & (side == 0 ? own : pieceBB[perspective ^ 1]);
+            int base = kingBase + (side * pieceTypes + piece - enumPiece::nPawn) * 64;
+
+            for (auto square : Bitboard::squares(pieces)) features[active++] = base + orient(square, perspective);
+        }
+    }
+
+    return active;
+}
+
+std::size_t Nnue::extract(const TrainingEntry *entries, std::size_t count, enumFeatureSet set, const FeatureBatch &batch, int threads) {
+    std::atomic<std::size_t> rejected = 0;
+
+    Parallel::forSlices(count, threads, MIN_THREAD_POSITIONS, [&](std::size_t begin, std::size_t end) {
+        std::array<U64, 8> pieceBB;
+        std::size_t sliceRejected = 0;
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const TrainingEntry &entry = entries[i];
+            bool unpacked = CTrainingData::unpack(entry, &pieceBB);
+
+            sliceRejected += !writeRows(pieceBB, unpacked, set, batch, i);
+
+            if (batch.sideToMove) batch.sideToMove[i] = entry.sideToMove;
+            if (batch.score) batch.score[i] = entry.score;
+            if (batch.result) batch.result[i] = (entry.result + 1) * 0.5f;
+        }
+
+        rejected += sliceRejected;
+    });
+
+    return rejected;
+}
+
+std::size_t Nnue::extract(const CBoard *boards, std::size_t count, enumFeatureSet set, const FeatureBatch &batch, int threads) {
+    std::atomic<std::size_t> rejected = 0;
+
+    Parallel::forSlices(count, threads, MIN_THREAD_POSITIONS, [&](std::size_t begin, std::size_t end) {
+        std::size_t sliceRejected = 0;
+
+        for (std::size_t i = begin; i < end; ++i) {
+            sliceRejected += !writeRows(boards[i].getPieceSets(), true, set, batch, i);
+
+            if (batch.sideToMove) batch.sideToMove[i] = boards[i].getSideToMove();
+        }
+
+        rejected += sliceRejected;
+    });
+
+    return rejected;
+}
@@ -0,0 +1,140 @@
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#include "chessbot/pgn.h"
+
+const std::string Pgn::START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Export format lines are at most 80 characters
+constexpr std::size_t LINE_LENGTH = 79;
+
+static bool isResult(std::string_view token) {
+    return token == "1-0" or token == "0-1" or token == "1/2-1/2" or token == "*";
+}
+
+static bool isDelimiter(char c) {
+    return std::isspace(static_cast<unsigned char>(c)) or c == '{' or c == '}' or c == '(' or c == ')' or c == ';';
+}
+
+CMove Pgn::parseSan(const CBoard &board, std::string_view san) {
+    return CMove::fromSan(board, san);
+}
+
+std::string Pgn::moveToSan(CBoard *board, CMove move) {
+    char buffer[CMove::SAN_BUFFER_SIZE];
+    std::size_t length = move.toSan(board, buffer);
+
+    return std::string(buffer, length);
+}
+
+void Pgn::parseMovetext(std::string_view movetext, CBoard *board, std::vector<CMove> *moves) {
+    std::size_t i = 0;
+    int variationDepth = 0;
+
+    while (i < movetext.size()) {
+        char c = movetext[i];
+
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+        } else if (c == '{') {
+            i = movetext.find('}', i);
+            if (i == std::string_view::npos) throw std::invalid_argument("Unterminated comment");
+            ++i;
+        } else if (c == ';' or (c == '%' and (i == 0 or movetext[i - 1] == '\n'))) {
+            // Comment or escape to the end of the line
+            i = movetext.find('\n', i);
+            if (i == std::string_view::npos) i = movetext.size();
+        } else if (c == '(') {
+            ++variationDepth;
+            ++i;
+        } else if (c == ')' or c == '}') {
+            if (c == '}' or variationDepth == 0) throw std::invalid_argument("Unbalanced movetext");
+            --variationDepth;
+            ++i;
+        } else {
+            std::size_t end = i;
+            while (end < movetext.size() and !isDelimiter(movetext[end])) ++end;
+
+            std::string_view token = movetext.substr(i, end - i);
+            i = end;
+
+            if (variationDepth > 0 or token.front() == '$') continue;
+            if (isResult(token)) break;
+
+            // Move numbers, possibly attached to the move as in 12.e4 or 12...e5, but not castling with zeros
+            std::size_t digits = 0;
+            while (digits < token.size() and std::isdigit(static_cast<unsigned char>(token[digits]))) ++digits;
+            if (digits == token.size() or (digits > 0 and token[digits] == '.')) token.remove_prefix(digits);
+            while (!token.empty() and token.front() == '.') token.remove_prefix(1);
+
+            if (token.empty()) continue;
+
+            CMove move = CMove::fromSan(*board, token);
+            board->makeMove(move);
+            moves->push_back(move);
+        }
+    }
+
+    if (variationDepth != 0) throw std::invalid_argument("Unterminated variation");
+}
+
+void Pgn::writeGame(const Tags &tags, const std::vector<CMove> &moves, CBoard *board, std::string *out) {
+    std::string result = "*";
+
+    for (auto &[name, value] : tags) {
+        *out += '[';
+        *out += name;
+        *out += " \"";
+
+        for (char c : value) {
+            if (c == '"' or c == '\\') *out += '\\';
+            *out += c;
+        }
+
+        *out += "\"]\n";
+
+        if (name == "Result") result = value;
+    }
+
+    *out += '\n';
+
+    std::size_t lineStart = out->size();
+
+    // Separates tokens with a space, or a new line once the line would grow too long
+    auto append = [&](std::string_view token) {
+        if (out->size() > lineStart) {
+            if (out->size() - lineStart + 1 + token.size() > LINE_LENGTH) {
+                *out += '\n';
+                lineStart = out->size();
+            } else {
+                *out += ' ';
+            }
+        }
+
+        *out += token;
+    };
+
+    // Large enough for a move number and its dots
+    char number[16];
+    char san[CMove::SAN_BUFFER_SIZE];
+
+    for (std::size_t i = 0; i < moves.size(); ++i) {
+        bool white = board->getSideToMove() == enumColour::white;
+
+        if (white or i == 0) {
+            char *end = std::to_chars(number, number + sizeof(number) - 3, board->getFullmoves()).ptr;
+            end = std::strcpy(end, white ? "." : "...") + (white ? 1 : 3);
+            append(std::string_view(number, end - number));
+        }
+
+        append(std::string_view(san, moves[i].toSan(board, san)));
+        board->makeMove(moves[i]);
+    }
+
+    append(result);
+    *out += "\n\n";
+
+    for (auto it = moves.rbegin(); it != moves.rend(); ++it) board->unmakeMove(*it);
+}
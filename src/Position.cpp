@@ -0,0 +1,265 @@
+#include <atomic>
+#include <thread>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/constants.h"
+#include "chessbot/position.h"
+#include "chessbot/zobrist.h"
+
+// Adds or removes a piece, enumColour and the colour sets of enumPiece share the values 0 and 1
+static void togglePiece(Position *position, int colour, enumPiece piece, enumSquare square) {
+    U64 bb = Bitboard::squareBB(square);
+
+    position->pieceBB[colour] ^= bb;
+    position->pieceBB[piece] ^= bb;
+    position->key ^= Zobrist::piece(piece | (colour << Constants::PIECE_COLOUR_SHIFT), square);
+}
+
+// The origin of every move in targets is delta squares behind it
+static void addPawnMoves(U64 targets, int delta, unsigned int flags, std::vector<CMove> *moves) {
+    for (auto to : Bitboard::squares(targets)) {
+        moves->emplace_back(static_cast<enumSquare>(to - delta), to, flags);
+    }
+}
+
+static void addPromotions(U64 targets, int delta, unsigned int knightFlag, std::vector<CMove> *moves) {
+    for (auto to : Bitboard::squares(targets)) {
+        for (unsigned int piece = 0; piece < 4; ++piece) {
+            moves->emplace_back(static_cast<enumSquare>(to - delta), to, knightFlag + piece);
+        }
+    }
+}
+
+// Makes the move on next and returns whether it leaves the mover's king safe
+static bool tryMove(const Position &position, CMove move, Position *next) {
+    int us = position.sideToMove;
+    auto them = static_cast<enumColour>(us ^ 1);
+    unsigned int flags = move.getFlags();
+
+    // The king may not castle out of or through check
+    if (flags == Constants::KING_CASTLE_FLAG or flags == Constants::QUEEN_CASTLE_FLAG) {
+        auto passing = static_cast<enumSquare>((move.getFrom() + move.getTo()) / 2);
+        if (position.isInCheck() or position.isSquareAttacked(passing, them)) return false;
+    }
+
+    *next = position;
+    next->makeMove(move);
+
+    U64 king = next->pieceBB[enumPiece::nKing] & next->pieceBB[us];
+
+    return !next->isSquareAttacked(Bitboard::lsb(king), them);
+}
+
+Position::Position(const CBoard &board) {
+    for (int piece = enumPiece::nWhite; piece <= enumPiece::nKing; ++piece) {
+        pieceBB[piece] = board.getPieceSet(static_cast<enumPiece>(piece));
+    }
+
+    key = board.getKey();
+    halfmoves = board.getHalfmoves();
+    fullmoves = board.getFullmoves();
+    sideToMove = board.getSideToMove();
+    castling = board.getCastleState();
+    enPassant = board.getEnPassantSquare();
+}
+
+void Position::makeMove(CMove move) {
+    auto from = static_cast<enumSquare>(move.getFrom());
+    auto to = static_cast<enumSquare>(move.getTo());
+    unsigned int flags = move.getFlags();
+
+    int us = sideToMove;
+    int them = us ^ 1;
+    enumPiece moving = Position::pieceTypeOn(from);
+
+    if (flags == Constants::EP_CAPTURE_FLAG) {
+        togglePiece(this, them, enumPiece::nPawn, static_cast<enumSquare>(us == enumColour::white ? to + 8 : to - 8));
+    } else if (move.isCapture()) {
+        togglePiece(this, them, Position::pieceTypeOn(to), to);
+    }
+
+    togglePiece(this, us, moving, from);
+    togglePiece(this, us, flags & Constants::PROMO_FLAG_MASK ? Constants::PROMOTION_PIECES[flags & 3] : moving, to);
+
+    if (flags == Constants::KING_CASTLE_FLAG) {
+        togglePiece(this, us, enumPiece::nRook, static_cast<enumSquare>(to + 1));
+        togglePiece(this, us, enumPiece::nRook, static_cast<enumSquare>(to - 1));
+    } else if (flags == Constants::QUEEN_CASTLE_FLAG) {
+        togglePiece(this, us, enumPiece::nRook, static_cast<enumSquare>(to - 2));
+        togglePiece(this, us, enumPiece::nRook, static_cast<enumSquare>(to + 1));
+    }
+
+    if (enPassant != enumSquare::no_sq) key ^= Zobrist::enPassant(static_cast<enumSquare>(enPassant));
+    enPassant = enumSquare::no_sq;
+
+    // As in CBoard, only recorded when an enemy pawn could capture
+    if (flags == Constants::DOUBLE_PAWN_PUSH_FLAG) {
+        U64 toBB = Bitboard::squareBB(to);
+
+        if ((Bitboard::shiftEast(toBB) | Bitboard::shiftWest(toBB)) & pieceBB[enumPiece::nPawn] & pieceBB[them]) {
+            enPassant = (from + to) / 2;
+            key ^= Zobrist::enPassant(static_cast<enumSquare>(enPassant));
+        }
+    }
+
+    key ^= Zobrist::castling(castling);
+    castling &= ~(Constants::CASTLING_RIGHTS_LOST[from] | Constants::CASTLING_RIGHTS_LOST[to]);
+    key ^= Zobrist::castling(castling);
+
+    halfmoves = moving == enumPiece::nPawn or move.isCapture() ? 0 : halfmoves + 1;
+
+    if (us == enumColour::black) ++fullmoves;
+    sideToMove = them;
+    key ^= Zobrist::side();
+}
+
+void Position::generateMoves(std::vector<CMove> *moves) const {
+    int us = sideToMove;
+    U64 own = pieceBB[us];
+    U64 enemy = pieceBB[us ^ 1];
+    U64 occupied = own | enemy;
+    U64 empty = ~occupied;
+
+    U64 pawns = pieceBB[enumPiece::nPawn] & own;
+    U64 enPassantBB = enPassant != enumSquare::no_sq ? Bitboard::squareBB(static_cast<enumSquare>(enPassant)) : 0ULL;
+
+    // Shifts towards the opponent, deltas are the square index change of each shift
+    bool white = us == enumColour::white;
+    U64 single = (white ? Bitboard::shiftNorth(pawns) : Bitboard::shiftSouth(pawns)) & empty;
+    U64 doubles = (white ? Bitboard::shiftNorth(single) : Bitboard::shiftSouth(single)) & empty & (white ? Constants::RANK_4 : Constants::RANK_5);
+    U64 east = white ? Bitboard::shiftNorthEast(pawns) : Bitboard::shiftSouthEast(pawns);
+    U64 west = white ? Bitboard::shiftNorthWest(pawns) : Bitboard::shiftSouthWest(pawns);
+
+    int pushDelta = white ? -8 : 8;
+    int eastDelta = white ? -7 : 9;
+    int westDelta = white ? -9 : 7;
+    U64 lastRank = white ? Constants::RANK_8 : Constants::RANK_1;
+
+    addPawnMoves(single & ~lastRank, pushDelta, Constants::QUIET_FLAG, moves);
+    addPawnMoves(doubles, 2 * pushDelta, Constants::DOUBLE_PAWN_PUSH_FLAG, moves);
+    addPawnMoves(east & enemy & ~lastRank, eastDelta, Constants::CAPTURE_FLAG, moves);
+    addPawnMoves(west & enemy & ~lastRank, westDelta, Constants::CAPTURE_FLAG, moves);
+    addPawnMoves(east & enPassantBB, eastDelta, Constants::EP_CAPTURE_FLAG, moves);
+    addPawnMoves(west & enPassantBB, westDelta, Constants::EP_CAPTURE_FLAG, moves);
+
+    addPromotions(single & lastRank, pushDelta, Constants::N_PROMO_FLAG, moves);
+    addPromotions(east & enemy & lastRank, eastDelta, Constants::N_PROMO_CAPTURE_FLAG, moves);
+    addPromotions(west & enemy & lastRank, westDelta, Constants::N_PROMO_CAPTURE_FLAG, moves);
+
+    for (int piece = enumPiece::nBishop; piece <= enumPiece::nKing; ++piece) {
+        for (auto from : Bitboard::squares(pieceBB[piece] & own)) {
+            U64 targets = piece == enumPiece::nBishop ? CBoard::getBishopMoveset(from, occupied, own)
+                        : piece == enumPiece::nKnight ? CBoard::getKnightMoveset(from, own)
+                        : piece == enumPiece::nRook ? CBoard::getRookMoveset(from, occupied, own)
+                        : piece == enumPiece::nQueen ? CBoard::getQueenMoveset(from, occupied, own)
+                        : CBoard::getKingMoveset(from, own);
+
+            for (auto to : Bitboard::squares(targets)) {
+                moves->emplace_back(from, to, (enemy & Bitboard::squareBB(to)) ? Constants::CAPTURE_FLAG : Constants::QUIET_FLAG);
+            }
+        }
+    }
+
+    // Attacks on the king's path are checked by isLegal
+    enumSquare king = white ? enumSquare::e1 : enumSquare::e8;
+    unsigned int kingside = white ? Constants::WHITE_KINGSIDE_CASTLE : Constants::BLACK_KINGSIDE_CASTLE;
+    unsigned int queenside = white ? Constants::WHITE_QUEENSIDE_CASTLE : Constants::BLACK_QUEENSIDE_CASTLE;
+
+    if ((castling & kingside) and !(occupied & Bitboard::between(king, static_cast<enumSquare>(king + 3)))) {
+        moves->emplace_back(king, static_cast<enumSquare>(king + 2), Constants::KING_CASTLE_FLAG);
+    }
+
+    if ((castling & queenside) and !(occupied & Bitboard::between(king, static_cast<enumSquare>(king - 4)))) {
+        moves->emplace_back(king, static_cast<enumSquare>(king - 2), Constants::QUEEN_CASTLE_FLAG);
+    }
+}
+
+void Position::generateLegalMoves(std::vector<CMove> *moves) const {
+    Position::generateMoves(moves);
+    std::erase_if(*moves, [this](CMove move) { return !Position::isLegal(move); });
+}
+
+bool Position::isLegal(CMove move) const {
+    Position next;
+    return tryMove(*this, move, &next);
+}
+
+bool Position::isSquareAttacked(enumSquare square, enumColour byColour) const {
+    U64 attackers = pieceBB[byColour];
+    U64 occupied = Position::getOccupiedSquares();
+    U64 diagonal = pieceBB[enumPiece::nBishop] | pieceBB[enumPiece::nQueen];
+    U64 orthogonal = pieceBB[enumPiece::nRook] | pieceBB[enumPiece::nQueen];
+
+    // A pawn attacks square if a pawn of the other colour on square would attack the pawn
+    return attackers & ((CBoard::pawnAttacks(static_cast<enumPiece>(byColour ^ 1), Bitboard::squareBB(square)) & pieceBB[enumPiece::nPawn])
+                        | (CBoard::getKnightMoveset(square, 0ULL) & pieceBB[enumPiece::nKnight])
+                        | (CBoard::getKingMoveset(square, 0ULL) & pieceBB[enumPiece::nKing])
+                        | (CBoard::getBishopMoveset(square, occupied, 0ULL) & diagonal)
+                        | (CBoard::getRookMoveset(square, occupied, 0ULL) & orthogonal));
+}
+
+bool Position::isInCheck() const {
+    U64 king = pieceBB[enumPiece::nKing] & pieceBB[sideToMove];
+    return Position::isSquareAttacked(Bitboard::lsb(king), static_cast<enumColour>(sideToMove ^ 1));
+}
+
+U64 Position::getOccupiedSquares() const {
+    return pieceBB[enumPiece::nWhite] | pieceBB[enumPiece::nBlack];
+}
+
+U64 Position::getPieceSet(enumPiece piece, enumPiece colour) const {
+    return pieceBB[piece] & pieceBB[colour];
+}
+
+enumPiece Position::pieceTypeOn(enumSquare square) const {
+    U64 bb = Bitboard::squareBB(square);
+
+    for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+        if (pieceBB[piece] & bb) return static_cast<enumPiece>(piece);
+    }
+
+    return enumPiece::nWhite;
+}
+
+U64 Position::perft(int depth) const {
+    if (depth <= 0) return 1;
+
+    std::vector<CMove> moves;
+    Position::generateMoves(&moves);
+
+    U64 nodes = 0;
+    Position next;
+
+    for (auto move : moves) {
+        if (!tryMove(*this, move, &next)) continue;
+
+        nodes += depth == 1 ? 1 : next.perft(depth - 1);
+    }
+
+    return nodes;
+}
+
+U64 Position::perftParallel(int depth, int threads) const {
+    if (depth <= 1 or threads <= 1) return Position::perft(depth);
+
+    std::vector<CMove> moves;
+    Position::generateLegalMoves(&moves);
+
+    std::atomic<std::size_t> nextMove = 0;
+    std::atomic<U64> nodes = 0;
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back([&]() {
+            for (std::size_t index = nextMove++; index < moves.size(); index = nextMove++) {
+                Position child = *this;
+                child.makeMove(moves[index]);
+                nodes += child.perft(depth - 1);
+            }
+        });
+    }
+
+    for (auto &worker : workers) worker.join();
+
+    return nodes;
+}
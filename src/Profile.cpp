@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chessbot/profile.h"
+
+struct Event {
+    Profile::Phase phase;
+    uint64_t start;
+    uint64_t duration;
+};
+
+struct Counters {
+    std::array<uint64_t, Profile::numPhases> calls = {};
+    std::array<uint64_t, Profile::numPhases> inclusive = {};
+    std::array<uint64_t, Profile::numPhases> exclusive = {};
+    std::vector<Event> events;
+    int threadId = 0;
+};
+
+struct ThreadData {
+    ThreadData();
+    ~ThreadData();
+
+    Counters counters;
+
+    // Cycles spent in nested scopes, for each open scope
+    std::array<uint64_t, 256> childCycles = {};
+    int depth = 0;
+};
+
+// Counters of all threads, threads which have exited are folded into retired
+static std::mutex registryMutex;
+static std::vector<ThreadData *> live;
+static std::vector<Counters> retired;
+static int nextThreadId = 1;
+
+static std::atomic<bool> tracing = false;
+static std::atomic<std::size_t> maxEvents = 0;
+
+// Reference points for converting time stamp counter ticks to microseconds
+static const uint64_t startTicks = Profile::now();
+static const auto startTime = std::chrono::steady_clock::now();
+
+ThreadData::ThreadData() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    counters.threadId = nextThreadId++;
+    live.push_back(this);
+}
+
+ThreadData::~ThreadData() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    live.erase(std::find(live.begin(), live.end(), this));
+    retired.push_back(std::move(counters));
+}
+
+static ThreadData &local() {
+    thread_local ThreadData data;
+    return data;
+}
+
+void Profile::enter() {
+    ThreadData &data = local();
+    data.childCycles[data.depth++] = 0;
+}
+
+void Profile::leave(Phase phase, uint64_t start, uint64_t end) {
+    ThreadData &data = local();
+    uint64_t elapsed = end - start;
+    int depth = --data.depth;
+
+    ++data.counters.calls[phase];
+    data.counters.inclusive[phase] += elapsed;
+    data.counters.exclusive[phase] += elapsed - data.childCycles[depth];
+
+    if (depth > 0) data.childCycles[depth - 1] += elapsed;
+
+    if (tracing.load(std::memory_order_relaxed) and data.counters.events.size() < maxEvents.load(std::memory_order_relaxed)) {
+        data.counters.events.push_back({ phase, start, elapsed });
+    }
+}
+
+void Profile::reset() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    for (auto data : live) {
+        int threadId = data->counters.threadId;
+        data->counters = Counters();
+        data->counters.threadId = threadId;
+    }
+
+    retired.clear();
+}
+
+void Profile::startTrace(std::size_t events) {
+    maxEvents = events;
+    tracing = true;
+}
+
+void Profile::stopTrace() {
+    tracing = false;
+}
+
+// Snapshot of every thread's counters
+static std::vector<Counters> collect() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::vector<Counters> all = retired;
+
+    for (auto data : live) all.push_back(data->counters);
+
+    return all;
+}
+
+static double ticksPerMicrosecond() {
+    // Too short an interval gives a poor estimate
+    if (std::chrono::steady_clock::now() - startTime < std::chrono::milliseconds(10)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    uint64_t ticks = Profile::now() - startTicks;
+    double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+
+    return ticks / microseconds;
+}
+
+void Profile::report(std::ostream &out) {
+    Counters total;
+
+    for (auto &counters : collect()) {
+        for (int phase = 0; phase < numPhases; ++phase) {
+            total.calls[phase] += counters.calls[phase];
+            total.inclusive[phase] += counters.inclusive[phase];
+            total.exclusive[phase] += counters.exclusive[phase];
+        }
+    }
+
+    uint64_t totalExclusive = 0;
+    for (auto cycles : total.exclusive) totalExclusive += cycles;
+
+    out << std::left << std::setw(10) << "phase" << std::right
+        << std::setw(14) << "calls" << std::setw(18) << "inclusive" << std::setw(18) << "exclusive"
+        << std::setw(9) << "excl %" << std::setw(12) << "per call" << std::endl;
+
+    for (int phase = 0; phase < numPhases; ++phase) {
+        double share = totalExclusive > 0 ? 100.0 * total.exclusive[phase] / totalExclusive : 0.0;
+        uint64_t perCall = total.calls[phase] > 0 ? total.exclusive[phase] / total.calls[phase] : 0;
+
+        out << std::left << std::setw(10) << PHASE_NAMES[phase] << std::right
+            << std::setw(14) << total.calls[phase] << std::setw(18) << total.inclusive[phase]
+            << std::setw(18) << total.exclusive[phase]
+            << std::setw(8) << std::fixed << std::setprecision(1) << share << "%"
+            << std::setw(12) << perCall << std::endl;
+    }
+}
+
+bool Profile::writeChromeTrace(const std::string &path) {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    std::vector<Counters> all = collect();
+    double scale = ticksPerMicrosecond();
+
+    uint64_t origin = UINT64_MAX;
+    for (auto &counters : all) {
+        for (auto &event : counters.events) origin = std::min(origin, event.start);
+    }
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+    out << std::fixed << std::setprecision(3);
+
+    for (auto &counters : all) {
+        for (auto &event : counters.events) {
+            out << (first ? "\n" : ",\n")
+                << "{\"name\":\"" << PHASE_NAMES[event.phase] << "\",\"cat\":\"chessbot\",\"ph\":\"X\""
+                << ",\"ts\":" << (event.start - origin) / scale
+                << ",\"dur\":" << event.duration / scale
+                << ",\"pid\":1,\"tid\":" << counters.threadId << "}";
+            first = false;
+        }
+    }
+
+    out << "\n]}\n";
+
+    return bool(out);
+}
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <sstream>
+
+#include "chessbot/stats.h"
+
+static double ratio(U64 numerator, U64 denominator) {
+    return denominator > 0 ? double(numerator) / double(denominator) : 0.0;
+}
+
+void SearchStats::clear() {
+    *this = SearchStats();
+}
+
+void SearchStats::merge(const SearchStats &other) {
+    nodes += other.nodes;
+    qnodes += other.qnodes;
+    ttProbes += other.ttProbes;
+    ttHits += other.ttHits;
+    ttCollisions += other.ttCollisions;
+    betaCutoffs += other.betaCutoffs;
+    firstMoveCutoffs += other.firstMoveCutoffs;
+    nullMoveTries += other.nullMoveTries;
+    nullMoveCutoffs += other.nullMoveCutoffs;
+    lmrReductions += other.lmrReductions;
+    lmrResearches += other.lmrResearches;
+    tbProbes += other.tbProbes;
+    tbHits += other.tbHits;
+
+    for (std::size_t i = 0; i < moveGenPieces.size(); ++i) moveGenPieces[i] += other.moveGenPieces[i];
+
+    moveGenCalls += other.moveGenCalls;
+    evalCalls += other.evalCalls;
+    moveGenCycles += other.moveGenCycles;
+    evalCycles += other.evalCycles;
+}
+
+double SearchStats::firstMoveCutoffRate() const {
+    return ratio(firstMoveCutoffs, betaCutoffs);
+}
+
+double SearchStats::nullMoveSuccessRate() const {
+    return ratio(nullMoveCutoffs, nullMoveTries);
+}
+
+double SearchStats::ttHitRate() const {
+    return ratio(ttHits, ttProbes);
+}
+
+std::string SearchStats::toInfoString() const {
+    std::ostringstream ss;
+    ss.precision(3);
+
+    ss << "nodes " << nodes << " qnodes " << qnodes
+       << " tthits " << ttHits << "/" << ttProbes << " ttcollisions " << ttCollisions
+       << " firstcut " << SearchStats::firstMoveCutoffRate()
+       << " nullcut " << SearchStats::nullMoveSuccessRate()
+       << " lmr " << lmrReductions << " lmrresearch " << lmrResearches
+       << " tbhits " << tbHits << "/" << tbProbes
+       << " evalmcycles " << evalCycles / 1000000 << " movegenmcycles " << moveGenCycles / 1000000;
+
+    return ss.str();
+}
+
+std::string SearchStats::toJson() const {
+    const char *pieceNames[] = { "white", "black", "pawn", "bishop", "knight", "rook", "queen", "king" };
+
+    std::ostringstream ss;
+
+    ss << "{\n"
+       << "  \"enabled\": " << (SearchStats::enabled() ? "true" : "false") << ",\n"
+       << "  \"nodes\": " << nodes << ",\n"
+       << "  \"qnodes\": " << qnodes << ",\n"
+       << "  \"tt_probes\": " << ttProbes << ",\n"
+       << "  \"tt_hits\": " << ttHits << ",\n"
+       << "  \"tt_collisions\": " << ttCollisions << ",\n"
+       << "  \"beta_cutoffs\": " << betaCutoffs << ",\n"
+       << "  \"first_move_cutoffs\": " << firstMoveCutoffs << ",\n"
+       << "  \"first_move_cutoff_rate\": " << SearchStats::firstMoveCutoffRate() << ",\n"
+       << "  \"null_move_tries\": " << nullMoveTries << ",\n"
+       << "  \"null_move_cutoffs\": " << nullMoveCutoffs << ",\n"
+       << "  \"null_move_success_rate\": " << SearchStats::nullMoveSuccessRate() << ",\n"
+       << "  \"lmr_reductions\": " << lmrReductions << ",\n"
+       << "  \"lmr_researches\": " << lmrResearches << ",\n"
+       << "  \"tb_probes\": " << tbProbes << ",\n"
+       << "  \"tb_hits\": " << tbHits << ",\n"
+       << "  \"movegen_calls\": " << moveGenCalls << ",\n"
+       << "  \"movegen_pieces\": {";
+
+    for (int piece = 2; piece < 8; ++piece) {
+        ss << (piece > 2 ? ", " : "") << "\"" << pieceNames[piece] << "\": " << moveGenPieces[piece];
+    }
+
+    ss << "},\n"
+       << "  \"eval_calls\": " << evalCalls << ",\n"
+       << "  \"movegen_cycles\": " << moveGenCycles << ",\n"
+       << "  \"eval_cycles\": " << evalCycles << "\n"
+       << "}\n";
+
+    return ss.str();
+}
+
+void LatencyHistogram::record(U64 micros) {
+    ++counts[LatencyHistogram::bucketOf(micros)];
+    ++count;
+    total += micros;
+    max = std::max(max, micros);
+}
+
+void LatencyHistogram::clear() {
+    *this = LatencyHistogram();
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    for (int i = 0; i < BUCKETS; ++i) counts[i] += other.counts[i];
+
+    count += other.count;
+    total += other.total;
+    max = std::max(max, other.max);
+}
+
+U64 LatencyHistogram::percentile(double p) const {
+    if (count == 0) return 0;
+    if (p >= 1.0) return max;
+
+    // Rank of the request at the percentile, counting from 1
+    U64 rank = std::max<U64>(1, static_cast<U64>(std::ceil(p * count)));
+    U64 seen = 0;
+
+    for (int i = 0; i < BUCKETS; ++i) {
+        seen += counts[i];
+        if (seen >= rank) return std::min(LatencyHistogram::lowerBound(i), max);
+    }
+
+    return max;
+}
+
+double LatencyHistogram::mean() const {
+    return ratio(total, count);
+}
+
+std::string LatencyHistogram::toString() const {
+    std::ostringstream ss;
+
+    ss << "count " << count << " mean " << static_cast<U64>(LatencyHistogram::mean())
+       << " p50 " << LatencyHistogram::percentile(0.5) << " p90 " << LatencyHistogram::percentile(0.9)
+       << " p99 " << LatencyHistogram::percentile(0.99) << " p999 " << LatencyHistogram::percentile(0.999)
+       << " max " << max;
+
+    return ss.str();
+}
+
+int LatencyHistogram::bucketOf(U64 micros) {
+    if (micros < SUB_BUCKETS) return micros;
+
+    // Power of two above 16 and the next four bits below the leading one
+    int exponent = 63 - std::countl_zero(micros);
+    int sub = (micros >> (exponent - 4)) & (SUB_BUCKETS - 1);
+
+    return (exponent - 3) * SUB_BUCKETS + sub;
+}
+
+U64 LatencyHistogram::lowerBound(int bucket) {
+    if (bucket < SUB_BUCKETS) return bucket;
+
+    int exponent = bucket / SUB_BUCKETS + 3;
+    U64 sub = bucket % SUB_BUCKETS;
+
+    return (SUB_BUCKETS + sub) << (exponent - 4);
+}
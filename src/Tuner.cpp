@@ -0,0 +1,529 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/eval_weights.h"
+#include "chessbot/simd.h"
+#include "chessbot/tuner.h"
+
+// Positions evaluated together, small enough for the buffers to stay in cache, a whole number of vectors
+constexpr std::size_t BLOCK_SIZE = 1024;
+
+// Number of weights: material and piece-square tables, middlegame and endgame
+constexpr std::size_t WEIGHT_COUNT = 2 * 8 + 2 * 8 * 64;
+
+using Simd::FloatVector;
+using Simd::FLOAT_LANES;
+using Simd::loadVector;
+using Simd::storeVector;
+
+constexpr U64 BINARY_MAGIC = 0x31544553454e5554ULL;
+
+constexpr double ADAM_BETA1 = 0.9;
+constexpr double ADAM_BETA2 = 0.999;
+constexpr double ADAM_EPSILON = 1e-8;
+
+static const std::array<const char *, 8> PIECE_NAMES = { "", "", "Pawn", "Bishop", "Knight", "Rook", "Queen", "King" };
+
+// The weights as one flat array, in the order of the struct
+static std::vector<double> flatten(const Tuner::Weights &weights) {
+    std::vector<double> flat;
+    flat.reserve(WEIGHT_COUNT);
+
+    flat.insert(flat.end(), weights.materialMg.begin(), weights.materialMg.end());
+    flat.insert(flat.end(), weights.materialEg.begin(), weights.materialEg.end());
+    for (const auto &squares : weights.pstMg) flat.insert(flat.end(), squares.begin(), squares.end());
+    for (const auto &squares : weights.pstEg) flat.insert(flat.end(), squares.begin(), squares.end());
+
+    return flat;
+}
+
+static void unflatten(const std::vector<double> &flat, Tuner::Weights *weights) {
+    auto value = flat.begin();
+
+    for (auto &weight : weights->materialMg) weight = *value++;
+    for (auto &weight : weights->materialEg) weight = *value++;
+
+    for (auto &squares : weights->pstMg) {
+        for (auto &weight : squares) weight = *value++;
+    }
+
+    for (auto &squares : weights->pstEg) {
+        for (auto &weight : squares) weight = *value++;
+    }
+}
+
+// Loss and gradient over positions begin to end, gradients are per feature with material and square combined
+static double lossRange(const Tuner::TuningSet &set, std::size_t begin, std::size_t end, double k,
+                        const std::array<float, Tuner::FEATURES> &mg, const std::array<float, Tuner::FEATURES> &eg,
+                        std::array<double, Tuner::FEATURES> *gradientMg, std::array<double, Tuner::FEATURES> *gradientEg) {
+    std::array<float, BLOCK_SIZE> evals, targets, coefficients;
+    double loss = 0.0;
+
+    // The expected result is 1 / (1 + 10^(-K * eval / 400)), as in the Texel method
+    float scale = static_cast<float>(k * std::log(10.0) / 400.0);
+
+    for (std::size_t block = begin; block < end; block += BLOCK_SIZE) {
+        std::size_t count = std::min(BLOCK_SIZE, end - block);
+
+        // Gathers the weights of each position's features
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t position = block + i;
+            float scoreMg = 0.0f, scoreEg = 0.0f;
+
+            for (uint32_t j = set.offsets[position]; j < set.offsets[position + 1]; ++j) {
+                scoreMg += set.signs[j] * mg[set.features[j]];
+                scoreEg += set.signs[j] * eg[set.features[j]];
+            }
+
+            float phase = set.phases[position];
+            evals[i] = scoreMg * phase + scoreEg * (1.0f - phase);
+        }
+
+        // Padded to whole vectors with a zero eval and a target of one half, which adds no loss
+        std::size_t padded = (count + FLOAT_LANES - 1) / FLOAT_LANES * FLOAT_LANES;
+        std::copy_n(set.results.data() + block, count, targets.begin());
+        std::fill(evals.begin() + count, evals.begin() + padded, 0.0f);
+        std::fill(targets.begin() + count, targets.begin() + padded, 0.5f);
+
+        // Written as vectors, the compiler does not vectorise std::exp or reorder a float sum by itself
+        // Each lane keeps its own partial sum of the loss
+        FloatVector blockLoss = {};
+
+        for (std::size_t i = 0; i < padded; i += FLOAT_LANES) {
+            FloatVector eval = loadVector<FloatVector>(evals.data() + i);
+            FloatVector predicted = 1.0f / (1.0f + Simd::exp(-scale * eval));
+            FloatVector error = loadVector<FloatVector>(targets.data() + i) - predicted;
+
+            blockLoss += error * error;
+            storeVector(coefficients.data() + i, -2.0f * scale * error * predicted * (1.0f - predicted));
+        }
+
+        for (int lane = 0; lane < FLOAT_LANES; ++lane) loss += blockLoss[lane];
+        if (!gradientMg) continue;
+
+        // Scatters each position's share of the gradient back to its features
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t position = block + i;
+            float phase = set.phases[position];
+            float coefficientMg = coefficients[i] * phase;
+            float coefficientEg = coefficients[i] * (1.0f - phase);
+
+            for (uint32_t j = set.offsets[position]; j < set.offsets[position + 1]; ++j) {
+                (*gradientMg)[set.features[j]] += set.signs[j] * coefficientMg;
+                (*gradientEg)[set.features[j]] += set.signs[j] * coefficientEg;
+            }
+        }
+    }
+
+    return loss;
+}
+
+std::size_t Tuner::TuningSet::size() const {
+    return results.size();
+}
+
+// Black's pieces are mirrored onto White's side of the board, as the evaluation looks them up
+void Tuner::TuningSet::add(const CBoard &board, float result) {
+    int phase = 0;
+
+    for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+        auto type = static_cast<enumPiece>(piece);
+
+        for (auto square : Bitboard::squares(board.getPieceSet(type, enumPiece::nWhite))) {
+            features.push_back((piece - enumPiece::nPawn) * 64 + square);
+            signs.push_back(1);
+            phase += EvalWeights::PHASE[piece];
+        }
+
+        for (auto square : Bitboard::squares(board.getPieceSet(type, enumPiece::nBlack))) {
+            features.push_back((piece - enumPiece::nPawn) * 64 + (square ^ 56));
+            signs.push_back(-1);
+            phase += EvalWeights::PHASE[piece];
+        }
+    }
+
+    offsets.push_back(features.size());
+    phases.push_back(static_cast<float>(std::min(phase, EvalWeights::PHASE_MAX)) / EvalWeights::PHASE_MAX);
+    results.push_back(result);
+}
+
+void Tuner::TuningSet::append(const TuningSet &other) {
+    uint32_t base = features.size();
+
+    for (std::size_t i = 1; i < other.offsets.size(); ++i) offsets.push_back(base + other.offsets[i]);
+
+    features.insert(features.end(), other.features.begin(), other.features.end());
+    signs.insert(signs.end(), other.signs.begin(), other.signs.end());
+    phases.insert(phases.end(), other.phases.begin(), other.phases.end());
+    results.insert(results.end(), other.results.begin(), other.results.end());
+    malformed += other.malformed;
+}
+
+Tuner::Weights Tuner::Weights::current() {
+    Weights weights;
+
+    for (int piece = 0; piece < 8; ++piece) {
+        weights.materialMg[piece] = EvalWeights::MATERIAL_MG[piece];
+        weights.materialEg[piece] = EvalWeights::MATERIAL_EG[piece];
+
+        for (int square = 0; square < 64; ++square) {
+            weights.pstMg[piece][square] = EvalWeights::PST_MG[piece][square];
+            weights.pstEg[piece][square] = EvalWeights::PST_EG[piece][square];
+        }
+    }
+
+    return weights;
+}
+
+bool Tuner::parseLabel(const std::string &line, std::string *fen, float *result) {
+    std::istringstream ss(line);
+    std::vector<std::string> tokens;
+    std::string token;
+
+    while (ss >> token) tokens.push_back(token);
+    if (tokens.size() < 5) return false;
+
+    // Placement, side, castling and en passant, then the move counters if present
+    auto isNumber = [](const std::string &text) { return std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' and c <= '9'; }); };
+    std::size_t fields = 4;
+    while (fields < 6 and fields < tokens.size() and isNumber(tokens[fields])) ++fields;
+
+    *fen = tokens[0];
+    for (std::size_t i = 1; i < fields; ++i) *fen += " " + tokens[i];
+
+    // The last thing which looks like a result, EPD lines put an opcode before it
+    bool found = false;
+
+    for (std::size_t i = fields; i < tokens.size(); ++i) {
+        std::string label = tokens[i];
+        label.erase(std::remove_if(label.begin(), label.end(), [](char c) { return c == '"' or c == '[' or c == ']' or c == ';'; }), label.end());
+
+        if (label == "1-0") *result = 1.0f;
+        else if (label == "0-1") *result = 0.0f;
+        else if (label == "1/2-1/2") *result = 0.5f;
+        else if (label == "1.0" or label == "0.5" or label == "0.0" or label == "1" or label == "0") *result = std::stof(label);
+        else continue;
+
+        found = true;
+    }
+
+    return found;
+}
+
+bool Tuner::loadPositions(const std::string &path, TuningSet *set, int threads) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::vector<std::string> lines;
+    std::string line;
+
+    while (std::getline(file, line)) {
+        if (!line.empty() and line.back() == '\r') line.pop_back();
+        if (!line.empty()) lines.push_back(std::move(line));
+    }
+
+    threads = std::max(1, threads);
+    std::vector<TuningSet> sets(threads);
+    std::vector<std::thread> workers;
+
+    // Contiguous slices, so the positions keep the order of the file
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            auto tt = std::make_unique<CTranspositionTable>(1);
+            CSearch search(tt.get());
+            CBoard board;
+            std::vector<CMove> pv;
+            std::string fen;
+            float result;
+
+            std::size_t begin = lines.size() * t / threads;
+            std::size_t end = lines.size() * (t + 1) / threads;
+
+            for (std::size_t i = begin; i < end; ++i) {
+                try {
+                    if (!Tuner::parseLabel(lines[i], &fen, &result)) throw std::invalid_argument("No result");
+                    board.setFen(fen);
+                } catch (const std::invalid_argument &) {
+                    ++sets[t].malformed;
+                    continue;
+                }
+
+                search.resolve(board, &pv);
+                for (auto move : pv) board.makeMove(move);
+
+                sets[t].add(board, result);
+            }
+        });
+    }
+
+    for (auto &worker : workers) worker.join();
+    for (const auto &slice : sets) set->append(slice);
+
+    return true;
+}
+
+bool Tuner::saveBinary(const std::string &path, const TuningSet &set) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    U64 header[3] = { BINARY_MAGIC, set.size(), set.features.size() };
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(set.offsets.data()), set.offsets.size() * sizeof(uint32_t));
+    file.write(reinterpret_cast<const char *>(set.features.data()), set.features.size() * sizeof(uint16_t));
+    file.write(reinterpret_cast<const char *>(set.signs.data()), set.signs.size() * sizeof(int8_t));
+    file.write(reinterpret_cast<const char *>(set.phases.data()), set.phases.size() * sizeof(float));
+    file.write(reinterpret_cast<const char *>(set.results.data()), set.results.size() * sizeof(float));
+
+    return static_cast<bool>(file);
+}
+
+bool Tuner::loadBinary(const std::string &path, TuningSet *set) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    U64 header[3];
+
+    U64 fileSize = file ? static_cast<U64>(file.tellg()) : 0;
+    file.seekg(0);
+
+    if (!file.read(reinterpret_cast<char *>(header), sizeof(header)) or header[0] != BINARY_MAGIC) return false;
+
+    // The counts have to account for the file exactly, checked before they size anything
+    // Bounding each by the file size first keeps the sum from overflowing
+    U64 positions = header[1], featureCount = header[2];
+    U64 bytesPerPosition = sizeof(uint32_t) + sizeof(float) + sizeof(float);
+    U64 bytesPerFeature = sizeof(uint16_t) + sizeof(int8_t);
+
+    if (positions > fileSize / bytesPerPosition or featureCount > fileSize / bytesPerFeature) return false;
+    if (featureCount > UINT32_MAX) return false;
+    if (fileSize != sizeof(header) + sizeof(uint32_t) + positions * bytesPerPosition + featureCount * bytesPerFeature) return false;
+
+    TuningSet loaded;
+    loaded.offsets.resize(header[1] + 1);
+    loaded.features.resize(header[2]);
+    loaded.signs.resize(header[2]);
+    loaded.phases.resize(header[1]);
+    loaded.results.resize(header[1]);
+
+    file.read(reinterpret_cast<char *>(loaded.offsets.data()), loaded.offsets.size() * sizeof(uint32_t));
+    file.read(reinterpret_cast<char *>(loaded.features.data()), loaded.features.size() * sizeof(uint16_t));
+    file.read(reinterpret_cast<char *>(loaded.signs.data()), loaded.signs.size() * sizeof(int8_t));
+    file.read(reinterpret_cast<char *>(loaded.phases.data()), loaded.phases.size() * sizeof(float));
+    file.read(reinterpret_cast<char *>(loaded.results.data()), loaded.results.size() * sizeof(float));
+
+    if (!file or loaded.offsets.front() != 0 or loaded.offsets.back() != header[2]) return false;
+
+    // Everything the loss indexes with has to be in range
+    if (!std::is_sorted(loaded.offsets.begin(), loaded.offsets.end())) return false;
+    if (std::any_of(loaded.features.begin(), loaded.features.end(), [](uint16_t feature) { return feature >= FEATURES; })) return false;
+    if (std::any_of(loaded.signs.begin(), loaded.signs.end(), [](int8_t sign) { return sign != 1 and sign != -1; })) return false;
+
+    set->append(loaded);
+
+    return true;
+}
+
+double Tuner::evaluate(const TuningSet &set, std::size_t position, const Weights &weights) {
+    double mg = 0.0, eg = 0.0;
+
+    for (uint32_t j = set.offsets[position]; j < set.offsets[position + 1]; ++j) {
+        int piece = set.features[j] / 64 + enumPiece::nPawn;
+        int square = set.features[j] % 64;
+
+        mg += set.signs[j] * (weights.materialMg[piece] + weights.pstMg[piece][square]);
+        eg += set.signs[j] * (weights.materialEg[piece] + weights.pstEg[piece][square]);
+    }
+
+    double phase = set.phases[position];
+
+    return mg * phase + eg * (1.0 - phase);
+}
+
+double Tuner::loss(const TuningSet &set, const Weights &weights, double k, int threads, Weights *gradient) {
+    if (set.size() == 0) return 0.0;
+
+    // Material and square weights always appear together, so the kernel only sees their sums
+    std::array<float, FEATURES> mg, eg;
+
+    for (int feature = 0; feature < FEATURES; ++feature) {
+        int piece = feature / 64 + enumPiece::nPawn;
+        int square = feature % 64;
+
+        mg[feature] = weights.materialMg[piece] + weights.pstMg[piece][square];
+        eg[feature] = weights.materialEg[piece] + weights.pstEg[piece][square];
+    }
+
+    threads = std::clamp(threads, 1, static_cast<int>((set.size() + BLOCK_SIZE - 1) / BLOCK_SIZE));
+
+    std::vector<double> losses(threads, 0.0);
+    std::vector<std::array<double, FEATURES>> gradientsMg(gradient ? threads : 0), gradientsEg(gradient ? threads : 0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; ++t) {
+        if (gradient) {
+            gradientsMg[t].fill(0.0);
+            gradientsEg[t].fill(0.0);
+        }
+
+        workers.emplace_back([&, t]() {
+            std::size_t begin = set.size() * t / threads;
+            std::size_t end = set.size() * (t + 1) / threads;
+
+            losses[t] = lossRange(set, begin, end, k, mg, eg, gradient ? &gradientsMg[t] : nullptr, gradient ? &gradientsEg[t] : nullptr);
+        });
+    }
+
+    for (auto &worker : workers) worker.join();
+
+    double total = 0.0;
+    for (double loss : losses) total += loss;
+
+    if (gradient) {
+        for (auto &weights : { &gradient->materialMg, &gradient->materialEg }) weights->fill(0.0);
+        for (auto &squares : gradient->pstMg) squares.fill(0.0);
+        for (auto &squares : gradient->pstEg) squares.fill(0.0);
+
+        for (int t = 0; t < threads; ++t) {
+            for (int feature = 0; feature < FEATURES; ++feature) {
+                int piece = feature / 64 + enumPiece::nPawn;
+                int square = feature % 64;
+                double mg = gradientsMg[t][feature] / set.size();
+                double eg = gradientsEg[t][feature] / set.size();
+
+                gradient->pstMg[piece][square] += mg;
+                gradient->pstEg[piece][square] += eg;
+                gradient->materialMg[piece] += mg;
+                gradient->materialEg[piece] += eg;
+            }
+        }
+    }
+
+    return total / set.size();
+}
+
+// Golden section search, the loss is close enough to convex in K
+double Tuner::fitK(const TuningSet &set, const Weights &weights, int threads) {
+    const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+    double low = 0.0, high = 10.0;
+
+    for (int i = 0; i < 40; ++i) {
+        double a = high - ratio * (high - low);
+        double b = low + ratio * (high - low);
+
+        if (Tuner::loss(set, weights, a, threads) < Tuner::loss(set, weights, b, threads)) high = b;
+        else low = a;
+    }
+
+    return (low + high) / 2.0;
+}
+
+std::vector<Tuner::EpochReport> Tuner::tune(const TuningSet &set, Weights *weights, const TunerConfig &config, std::ostream &out) {
+    double k = config.k > 0.0 ? config.k : Tuner::fitK(set, *weights, config.threads);
+    out << "Positions : " << set.size() << " (" << set.malformed << " malformed)" << std::endl
+        << "K         : " << k << std::endl;
+
+    std::vector<double> values = flatten(*weights);
+    std::vector<double> moment(WEIGHT_COUNT, 0.0), velocity(WEIGHT_COUNT, 0.0);
+    std::vector<EpochReport> reports;
+    Weights gradient;
+
+    for (int epoch = 1; epoch <= config.epochs; ++epoch) {
+        auto start = std::chrono::steady_clock::now();
+        double loss = Tuner::loss(set, *weights, k, config.threads, &gradient);
+        std::vector<double> step = flatten(gradient);
+
+        // Adam with bias correction
+        double correction1 = 1.0 - std::pow(ADAM_BETA1, epoch);
+        double correction2 = 1.0 - std::pow(ADAM_BETA2, epoch);
+
+        for (std::size_t i = 0; i < WEIGHT_COUNT; ++i) {
+            moment[i] = ADAM_BETA1 * moment[i] + (1.0 - ADAM_BETA1) * step[i];
+            velocity[i] = ADAM_BETA2 * velocity[i] + (1.0 - ADAM_BETA2) * step[i] * step[i];
+            values[i] -= config.learningRate * (moment[i] / correction1) / (std::sqrt(velocity[i] / correction2) + ADAM_EPSILON);
+        }
+
+        unflatten(values, weights);
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        reports.push_back({ epoch, loss, seconds > 0.0 ? set.size() / seconds : 0.0 });
+
+        if (config.reportInterval > 0 and (epoch % config.reportInterval == 0 or epoch == config.epochs)) {
+            out << "Epoch " << epoch << ": loss " << std::setprecision(8) << loss
+                << ", " << static_cast<U64>(reports.back().positionsPerSecond) << " positions/second" << std::endl;
+        }
+    }
+
+    return reports;
+}
+
+static void writeArray(const char *name, const std::array<double, 8> &weights, std::ostream &out) {
+    out << "    constexpr std::array<int, 8> " << name << " = { ";
+
+    for (int piece = 0; piece < 8; ++piece) out << (piece > 0 ? ", " : "") << std::lround(weights[piece]);
+
+    out << " };\n";
+}
+
+static void writeTables(const char *name, const std::array<std::array<double, 64>, 8> &tables, std::ostream &out) {
+    out << "    constexpr std::array<std::array<int, 64>, 8> " << name << " = {{\n"
+        << "        {},\n"
+        << "        {},\n";
+
+    for (int piece = enumPiece::nPawn; piece <= enumPiece::nKing; ++piece) {
+        out << "        // " << PIECE_NAMES[piece] << "\n"
+            << "        {{\n";
+
+        for (int rank = 0; rank < 8; ++rank) {
+            out << "           ";
+            for (int file = 0; file < 8; ++file) {
+                out << " " << std::setw(3) << std::lround(tables[piece][rank * 8 + file]) << (file < 7 or rank < 7 ? "," : "");
+            }
+            out << "\n";
+        }
+
+        out << "        }}" << (piece < enumPiece::nKing ? "," : "") << "\n";
+    }
+
+    out << "    }};\n";
+}
+
+void Tuner::writeWeights(const Weights &weights, std::ostream &out) {
+    out << "#ifndef EVAL_WEIGHTS_H\n"
+        << "#define EVAL_WEIGHTS_H\n"
+        << "\n"
+        << "#include <array>\n"
+        << "\n"
+        << "// Evaluation weights, indexed by enumPiece (the nWhite and nBlack entries are unused)\n"
+        << "// Piece-square tables are from White's point of view with a8 first, Black looks them up mirrored\n"
+        << "// Middlegame and endgame scores are blended by the game phase\n"
+        << "namespace EvalWeights {\n";
+
+    writeArray("MATERIAL_MG", weights.materialMg, out);
+    writeArray("MATERIAL_EG", weights.materialEg, out);
+
+    out << "\n"
+        << "    // Contribution of each piece to the game phase, the opening starts at PHASE_MAX\n"
+        << "    constexpr std::array<int, 8> PHASE = { ";
+
+    for (int piece = 0; piece < 8; ++piece) out << (piece > 0 ? ", " : "") << EvalWeights::PHASE[piece];
+
+    out << " };\n"
+        << "    constexpr int PHASE_MAX = " << EvalWeights::PHASE_MAX << ";\n"
+        << "\n";
+
+    writeTables("PST_MG", weights.pstMg, out);
+    out << "\n";
+    writeTables("PST_EG", weights.pstEg, out);
+
+    out << "}\n"
+        << "\n"
+        << "#endif\n";
+}
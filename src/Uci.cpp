@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "chessbot/bench.h"
+#include "chessbot/CPolyglotBook.h"
+#include "chessbot/CParallelSearch.h"
+#include "chessbot/CSyzygy.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/uci.h"
+
+static const std::string START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+std::string Uci::moveToString(CMove move) {
+    char buffer[CMove::UCI_BUFFER_SIZE];
+    std::size_t length = move.toUci(buffer);
+
+    return std::string(buffer, length);
+}
+
+CMove Uci::parseMove(const CBoard &board, const std::string &move) {
+    return CMove::fromUci(board, move);
+}
+
+std::string Uci::scoreToString(int score) {
+    if (std::abs(score) < Constants::MATE_IN_MAX_PLY) return "cp " + std::to_string(score);
+
+    // Plies to mate converted to moves, negative when we are being mated
+    int plies = Constants::MATE_SCORE - std::abs(score);
+    int moves = score > 0 ? (plies + 1) / 2 : -plies / 2;
+
+    return "mate " + std::to_string(moves);
+}
+
+void Uci::setPosition(std::istream &in, CBoard *board, std::string *fen, std::vector<CMove> *moves) {
+    std::string token, startFen;
+    in >> token;
+
+    if (token == "startpos") {
+        startFen = START_FEN;
+        in >> token;
+    } else if (token == "fen") {
+        while (in >> token and token != "moves") startFen += token + " ";
+    } else {
+        throw std::invalid_argument("Expected startpos or fen");
+    }
+
+    board->setFen(startFen);
+
+    if (fen) *fen = startFen;
+    if (moves) moves->clear();
+
+    while (in >> token) {
+        CMove move = Uci::parseMove(*board, token);
+        board->makeMove(move);
+
+        if (moves) moves->push_back(move);
+    }
+}
+
+bool Uci::parseSpin(const std::string &value, int min, int max, int *result) {
+    long long number;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), number);
+
+    if (error == std::errc::invalid_argument or end != value.data() + value.size()) return false;
+
+    // Numbers too large for long long are clamped like any other
+    if (error == std::errc::result_out_of_range) number = value.front() == '-' ? min : max;
+
+    *result = static_cast<int>(std::clamp<long long>(number, min, max));
+    return true;
+}
+
+SearchLimits Uci::parseLimits(std::istream &in) {
+    SearchLimits limits;
+    std::string token;
+
+    while (in >> token) {
+        if (token == "depth") in >> limits.depth;
+        else if (token == "nodes") in >> limits.nodes;
+        else if (token == "movetime") in >> limits.movetime;
+        else if (token == "wtime") in >> limits.time[enumColour::white];
+        else if (token == "btime") in >> limits.time[enumColour::black];
+        else if (token == "winc") in >> limits.increment[enumColour::white];
+        else if (token == "binc") in >> limits.increment[enumColour::black];
+        else if (token == "movestogo") in >> limits.movestogo;
+        else if (token == "infinite") limits.infinite = true;
+    }
+
+    return limits;
+}
+
+void Uci::loop(std::istream &in, std::ostream &out) {
+    auto tt = std::make_unique<CTranspositionTable>();
+    auto search = std::make_unique<CParallelSearch>(tt.get());
+    CBoard board;
+
+    CPolyglotBook book;
+    bool ownBook = false;
+    std::mt19937_64 random(std::random_device{}());
+
+    CSyzygy tablebases;
+    TablebaseConfig tbConfig;
+
+    // Where the transposition table is shared with other processes, empty for a private table
+    std::size_t hashMegabytes = 16;
+    std::string sharedMemory, hashFile;
+
+    // Loaded when set and written back on quit
+    std::string snapshot;
+    int snapshotDepth = 0;
+
+    // The search thread and the command loop both write to out
+    std::mutex outputMutex;
+    std::thread searchThread;
+
+    auto waitForSearch = [&]() {
+        if (searchThread.joinable()) {
+            search->stop();
+            searchThread.join();
+        }
+    };
+
+    search->setInfoCallback([&](const SearchInfo &info) {
+        std::ostringstream line;
+        line << "info depth " << info.depth << " seldepth " << info.selDepth
+             << " score " << Uci::scoreToString(info.score) << " nodes " << info.nodes
+             << " nps " << (info.time > 0 ? info.nodes * 1000 / info.time : info.nodes)
+             << " hashfull " << info.hashfull << " tbhits " << info.tbHits << " time " << info.time << " pv";
+
+        char buffer[CMove::UCI_BUFFER_SIZE];
+        for (auto move : info.pv) {
+            move.toUci(buffer);
+            line << ' ' << buffer;
+        }
+
+        std::lock_guard<std::mutex> lock(outputMutex);
+        out << line.str() << std::endl;
+    });
+
+    // Falls back to a private table when the shared one cannot be used
+    auto placeTable = [&]() {
+        bool shared = !sharedMemory.empty() ? tt->openSharedMemory(sharedMemory, hashMegabytes)
+                    : !hashFile.empty() ? tt->openFile(hashFile, hashMegabytes)
+                    : false;
+
+        if (shared) return;
+
+        try {
+            tt->resize(hashMegabytes);
+        } catch (std::bad_alloc &) {
+            std::lock_guard<std::mutex> lock(outputMutex);
+            out << "info string Could not allocate " << hashMegabytes << " MB, keeping the hash table as it was" << std::endl;
+            return;
+        }
+
+        if (!sharedMemory.empty() or !hashFile.empty()) {
+            std::lock_guard<std::mutex> lock(outputMutex);
+            out << "info string Could not share the hash table at " << (sharedMemory.empty() ? hashFile : sharedMemory) << std::endl;
+        }
+    };
+
+    // Values of spin options which are not numbers are reported and leave the option as it was
+    auto spinOption = [&](const std::string &name, const std::string &value, int min, int max, int *result) {
+        if (Uci::parseSpin(value, min, max, result)) return true;
+
+        std::lock_guard<std::mutex> lock(outputMutex);
+        out << "info string Invalid value " << value << " for " << name << std::endl;
+        return false;
+    };
+
+    std::string line;
+
+    while (std::getline(in, line)) {
+        std::istringstream ss(line);
+        std::string command;
+        ss >> command;
+
+        if (command == "uci") {
+            std::lock_guard<std::mutex> lock(outputMutex);
+            out << "id name ChessBot\n"
+                << "id author ChessBot developers\n"
+                << "option name Hash type spin default 16 min 1 max 65536\n"
+                << "option name HashSharedMemory type string default <empty>\n"
+                << "option name HashFile type string default <empty>\n"
+                << "option name HashSnapshot type string default <empty>\n"
+                << "option name HashSnapshotDepth type spin default 0 min 0 max 100\n"
+                << "option name Threads type spin default 1 min 1 max 256\n"
+                << "option name SmpMode type combo default SharedHash var SharedHash var ABDADA\n"
+                << "option name OwnBook type check default false\n"
+                << "option name BookFile type string default <empty>\n"
+                << "option name SyzygyPath type string default <empty>\n"
+                << "option name SyzygyProbeDepth type spin default 1 min 1 max 100\n"
+                << "option name SyzygyProbeLimit type spin default 7 min 0 max 7\n"
+                << "option name Syzygy50MoveRule type check default true\n"
+                << "uciok" << std::endl;
+        } else if (command == "isready") {
+            std::lock_guard<std::mutex> lock(outputMutex);
+            out << "readyok" << std::endl;
+        } else if (command == "setoption") {
+            // "setoption name <name> value <value>", the value may contain spaces
+            std::string token, name, value;
+            ss >> token >> name >> token;
+            std::getline(ss >> std::ws, value);
+
+            if (name == "Hash") {
+                int megabytes;
+                if (!spinOption(name, value, 1, 65536, &megabytes)) continue;
+
+                waitForSearch();
+                hashMegabytes = megabytes;
+                placeTable();
+            } else if (name == "HashSharedMemory" or name == "HashFile") {
+                waitForSearch();
+                (name == "HashFile" ? hashFile : sharedMemory) = value == "<empty>" ? "" : value;
+                placeTable();
+            } else if (name == "HashSnapshot") {
+                waitForSearch();
+                snapshot = value == "<empty>" ? "" : value;
+
+                // A missing snapshot is normal the first time, it is written on quit
+                std::size_t loaded = 0;
+                if (!snapshot.empty() and access(snapshot.c_str(), F_OK) == 0) {
+                    bool valid = tt->loadSnapshot(snapshot, &loaded);
+
+                    std::lock_guard<std::mutex> lock(outputMutex);
+                    if (valid) out << "info string Loaded " << loaded << " entries from " << snapshot << std::endl;
+                    else out << "info string Could not load snapshot " << snapshot << std::endl;
+                }
+            } else if (name == "HashSnapshotDepth") {
+                spinOption(name, value, 0, 100, &snapshotDepth);
+            } else if (name == "Threads") {
+                int threads;
+                if (!spinOption(name, value, 1, 256, &threads)) continue;
+
+                waitForSearch();
+                search->setThreads(threads);
+            } else if (name == "SmpMode") {
+                waitForSearch();
+                search->setMode(value == "ABDADA" ? enumSmpMode::smpAbdada : enumSmpMode::smpSharedHash);
+            } else if (name == "OwnBook") {
+                ownBook = value == "true";
+            } else if (name == "BookFile") {
+                if (!book.open(value)) {
+                    std::lock_guard<std::mutex> lock(outputMutex);
+                    out << "info string Could not open book " << value << std::endl;
+                }
+            } else if (name == "SyzygyPath") {
+                waitForSearch();
+                int tables = 0;
+                if (value == "<empty>") tablebases.clear();
+                else tables = tablebases.init(value);
+
+                tbConfig.tablebases = tables > 0 ? &tablebases : nullptr;
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                out << "info string Found " << tables << " tablebases with up to " << tablebases.maxPieces() << " pieces" << std::endl;
+            } else if (name == "SyzygyProbeDepth") {
+                spinOption(name, value, 1, 100, &tbConfig.probeDepth);
+            } else if (name == "SyzygyProbeLimit") {
+                spinOption(name, value, 0, CSyzygy::MAX_PIECES, &tbConfig.probeLimit);
+            } else if (name == "Syzygy50MoveRule") {
+                tbConfig.rule50 = value == "true";
+            }
+        } else if (command == "ucinewgame") {
+            waitForSearch();
+
+            // Other processes may still be using a shared table
+            if (!tt->isShared()) tt->clear();
+            search->clearHistory();
+        } else if (command == "position") {
+            waitForSearch();
+
+            try {
+                Uci::setPosition(ss, &board);
+            } catch (std::invalid_argument &e) {
+                std::lock_guard<std::mutex> lock(outputMutex);
+                out << "info string " << e.what() << std::endl;
+            }
+        } else if (command == "go") {
+            waitForSearch();
+            SearchLimits limits = Uci::parseLimits(ss);
+
+            if (ownBook and book.isOpen()) {
+                CMove bookMove = book.weightedMove(board, random());
+
+                if (!(bookMove == CMove())) {
+                    std::lock_guard<std::mutex> lock(outputMutex);
+                    out << "bestmove " << Uci::moveToString(bookMove) << std::endl;
+                    continue;
+                }
+            }
+
+            search->setTablebases(tbConfig);
+            search->resetStop();
+
+            searchThread = std::thread([&, limits]() {
+                SearchResult result = search->search(board, limits);
+
+                std::lock_guard<std::mutex> lock(outputMutex);
+                if (SearchStats::enabled()) out << "info string stats " << search->getStats().toInfoString() << std::endl;
+                out << "bestmove " << Uci::moveToString(result.bestMove) << std::endl;
+            });
+        } else if (command == "stop") {
+            waitForSearch();
+        } else if (command == "stats") {
+            // JSON dump of the last search, the single line summary is printed after every search
+            waitForSearch();
+
+            std::lock_guard<std::mutex> lock(outputMutex);
+            out << search->getStats().toJson() << std::flush;
+        } else if (command == "bench") {
+            waitForSearch();
+
+            int depth = Bench::DEFAULT_DEPTH;
+            ss >> depth;
+
+            std::lock_guard<std::mutex> lock(outputMutex);
+            Bench::run(depth, out);
+        } else if (command == "quit") {
+            break;
+        }
+    }
+
+    waitForSearch();
+
+    if (!snapshot.empty() and !tt->saveSnapshot(snapshot, snapshotDepth)) {
+        std::lock_guard<std::mutex> lock(outputMutex);
+        out << "info string Could not write snapshot " << snapshot << std::endl;
+    }
+}
@@ -0,0 +1,104 @@
+#include <utility>
+
+#include "chessbot/constants.h"
+#include "chessbot/zobrist.h"
+
+struct CuckooTable {
+    std::array<U64, 8192> keys;
+
+    // Moves packed as from << 6 | to, 0 marks an empty slot
+    std::array<uint16_t, 8192> moves;
+
+    int count;
+};
+
+constexpr int cuckooH1(U64 key) {
+    return key & 0x1FFF;
+}
+
+constexpr int cuckooH2(U64 key) {
+    return (key >> 16) & 0x1FFF;
+}
+
+// Whether a piece can move from s1 to s2 on an empty board
+constexpr bool isPseudoAttack(enumPiece piece, int s1, int s2) {
+    int deltaRank = s2 / 8 - s1 / 8;
+    int deltaFile = s2 % 8 - s1 % 8;
+    int absRank = deltaRank < 0 ? -deltaRank : deltaRank;
+    int absFile = deltaFile < 0 ? -deltaFile : deltaFile;
+
+    bool diagonal = absRank == absFile and absRank != 0;
+    bool orthogonal = (absRank == 0) != (absFile == 0);
+
+    switch (piece) {
+        case enumPiece::nKnight:
+            return (absRank == 1 and absFile == 2) or (absRank == 2 and absFile == 1);
+        case enumPiece::nBishop:
+            return diagonal;
+        case enumPiece::nRook:
+            return orthogonal;
+        case enumPiece::nQueen:
+            return diagonal or orthogonal;
+        case enumPiece::nKing:
+            return absRank <= 1 and absFile <= 1 and (absRank | absFile) != 0;
+        default:
+            return false;
+    }
+}
+
+constexpr CuckooTable CUCKOO = [] {
+    CuckooTable table = {};
+
+    const enumPiece pieces[] = {
+        enumPiece::nKnight, enumPiece::nBishop, enumPiece::nRook, enumPiece::nQueen, enumPiece::nKing
+    };
+
+    for (int colour = enumPiece::nWhite; colour <= enumPiece::nBlack; ++colour) {
+        for (auto piece : pieces) {
+            uint8_t code = piece | (colour << Constants::PIECE_COLOUR_SHIFT);
+
+            for (int s1 = 0; s1 < 64; ++s1) {
+                for (int s2 = s1 + 1; s2 < 64; ++s2) {
+                    if (!isPseudoAttack(piece, s1, s2)) continue;
+
+                    uint16_t move = (s1 << 6) | s2;
+                    U64 key = Zobrist::piece(code, static_cast<enumSquare>(s1))
+                            ^ Zobrist::piece(code, static_cast<enumSquare>(s2))
+                            ^ Zobrist::side();
+
+                    // Insert, kicking out whatever is in the way until an empty slot is found
+                    int i = cuckooH1(key);
+                    while (true) {
+                        std::swap(table.keys[i], key);
+                        std::swap(table.moves[i], move);
+
+                        if (move == 0) break;
+
+                        i = (i == cuckooH1(key)) ? cuckooH2(key) : cuckooH1(key);
+                    }
+
+                    ++table.count;
+                }
+            }
+        }
+    }
+
+    return table;
+}();
+
+// Number of reversible moves on an empty board, for both colours
+static_assert(CUCKOO.count == 3668);
+
+bool Zobrist::findCuckooMove(U64 moveKey, enumSquare *from, enumSquare *to) {
+    int i = cuckooH1(moveKey);
+
+    if (CUCKOO.keys[i] != moveKey) {
+        i = cuckooH2(moveKey);
+        if (CUCKOO.keys[i] != moveKey) return false;
+    }
+
+    *from = static_cast<enumSquare>(CUCKOO.moves[i] >> 6);
+    *to = static_cast<enumSquare>(CUCKOO.moves[i] & 0x3F);
+
+    return true;
+}
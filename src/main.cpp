@@ -0,0 +1,299 @@
+#include <charconv>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "chessbot/bench.h"
+#include "chessbot/bitbase.h"
+#include "chessbot/bitboard.h"
+#include "chessbot/CEngineService.h"
+#include "chessbot/CPgnReader.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTrainingData.h"
+#include "chessbot/evaluate.h"
+#include "chessbot/loadgen.h"
+#include "chessbot/profile.h"
+#include "chessbot/tuner.h"
+#include "chessbot/uci.h"
+
+// Printed when a numeric argument is not a number of at least 1
+constexpr const char *USAGE =
+    "chessbot_engine             speaks UCI on stdin/stdout\n"
+    "chessbot_engine bench [d] [stats.json|-] [trace.json]\n"
+    "                            searches the bench positions to depth d and prints the node count and speed,\n"
+    "                            optionally writing the search statistics as JSON\n"
+    "                            Profiling builds also print the cycles per phase and can write a Chrome trace\n"
+    "chessbot_engine ttd [d] [positions] [threads...]\n"
+    "                            times parallel searches to depth d in both modes, by default with 1, 8, 16, 32 and 64 threads\n"
+    "chessbot_engine warm [d] [positions] [snapshot]\n"
+    "                            times searches to depth d with an empty table, then again from a snapshot of it\n"
+    "chessbot_engine tune <positions> [epochs] [threads] [eval_weights.h]\n"
+    "                            tunes the evaluation weights on \"<fen> <result>\" lines or a set written by tuneset,\n"
+    "                            printing the new weights or writing them to the header\n"
+    "chessbot_engine tuneset <positions> <set> [threads]\n"
+    "                            resolves labelled positions once and writes them in the tuner's binary format\n"
+    "chessbot_engine trainingdata <positions> <data>\n"
+    "                            resolves \"<fen> <result>\" lines and writes them as CTrainingData entries scored by the evaluation\n"
+    "chessbot_engine bitbase [threads] [kpk_bitbase.h]\n"
+    "                            generates the king and pawn against king bitbase, printing it or writing it to the header\n"
+    "chessbot_engine pgn <file> [threads]\n"
+    "                            parses every game of a PGN file and prints the counts and speed\n"
+    "chessbot_engine serve <socket> [workers] [hash MB]\n"
+    "                            serves games over a Unix domain socket until interrupted, see CEngineService\n"
+    "chessbot_engine loadgen <socket> [clients] [requests] [nodes]\n"
+    "                            plays games against a running service and prints the request latencies\n";
+
+// Parses argv[i] as a number of at least 1, or takes the fallback when there are not that many arguments
+template <typename T>
+static bool numberArgument(int argc, char *argv[], int i, T fallback, T *result) {
+    if (i >= argc) {
+        *result = fallback;
+        return true;
+    }
+
+    const char *end = argv[i] + std::strlen(argv[i]);
+    auto [last, error] = std::from_chars(argv[i], end, *result);
+
+    return error == std::errc() and last == end and *result >= 1;
+}
+
+static int usage() {
+    std::cerr << "Usage:\n" << USAGE;
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 and std::string(argv[1]) == "bench") {
+        int depth;
+        if (!numberArgument(argc, argv, 2, Bench::DEFAULT_DEPTH, &depth)) return usage();
+
+        std::string statsPath = argc > 3 ? argv[3] : "-";
+        std::string tracePath = argc > 4 ? argv[4] : "";
+        SearchStats stats;
+
+        if (!tracePath.empty()) Profile::startTrace();
+
+        Bench::run(depth, std::cout, &stats);
+
+        if (statsPath != "-") {
+            std::ofstream json(statsPath);
+            json << stats.toJson();
+        }
+
+        if (Profile::enabled()) {
+            Profile::stopTrace();
+            Profile::report(std::cout);
+
+            if (!tracePath.empty() and !Profile::writeChromeTrace(tracePath)) {
+                std::cerr << "Could not write " << tracePath << std::endl;
+            }
+        }
+
+        return 0;
+    }
+
+    if (argc > 1 and std::string(argv[1]) == "ttd") {
+        int depth, positions;
+        if (!numberArgument(argc, argv, 2, Bench::TTD_DEPTH, &depth)) return usage();
+        if (!numberArgument(argc, argv, 3, Bench::TTD_POSITIONS, &positions)) return usage();
+
+        std::vector<int> threads(argc > 4 ? argc - 4 : 0);
+        for (int i = 4; i < argc; ++i) {
+            if (!numberArgument(argc, argv, i, 1, &threads[i - 4])) return usage();
+        }
+        if (threads.empty()) threads = { 1, 8, 16, 32, 64 };
+
+        Bench::timeToDepth(depth, positions, threads, std::cout);
+
+        return 0;
+    }
+
+    if (argc > 1 and std::string(argv[1]) == "warm") {
+        int depth, positions;
+        if (!numberArgument(argc, argv, 2, Bench::TTD_DEPTH, &depth)) return usage();
+        if (!numberArgument(argc, argv, 3, Bench::TTD_POSITIONS, &positions)) return usage();
+
+        std::string path = argc > 4 ? argv[4] : "chessbot-warm.snapshot";
+
+        Bench::WarmStart result = Bench::warmStart(depth, positions, path, std::cout);
+
+        return result.entries > 0 ? 0 : 1;
+    }
+
+    if (argc > 2 and (std::string(argv[1]) == "tune" or std::string(argv[1]) == "tuneset")) {
+        bool tune = std::string(argv[1]) == "tune";
+        Tuner::TunerConfig config;
+        if (tune and !numberArgument(argc, argv, 3, config.epochs, &config.epochs)) return usage();
+        if (!numberArgument(argc, argv, 4, config.threads, &config.threads)) return usage();
+
+        Tuner::TuningSet set;
+
+        if (!Tuner::loadBinary(argv[2], &set) and !Tuner::loadPositions(argv[2], &set, config.threads)) {
+            std::cerr << "Could not open " << argv[2] << std::endl;
+            return 1;
+        }
+
+        if (!tune) {
+            if (argc < 4 or !Tuner::saveBinary(argv[3], set)) {
+                std::cerr << "Could not write the set" << std::endl;
+                return 1;
+            }
+
+            std::cout << "Positions : " << set.size() << " (" << set.malformed << " malformed)" << std::endl;
+            return 0;
+        }
+
+        Tuner::Weights weights = Tuner::Weights::current();
+        Tuner::tune(set, &weights, config, std::cout);
+
+        if (argc > 5) {
+            std::ofstream header(argv[5]);
+            Tuner::writeWeights(weights, header);
+        } else {
+            Tuner::writeWeights(weights, std::cout);
+        }
+
+        return 0;
+    }
+
+    if (argc > 3 and std::string(argv[1]) == "trainingdata") {
+        std::ifstream positions(argv[2]);
+        if (!positions) {
+            std::cerr << "Could not open " << argv[2] << std::endl;
+            return 1;
+        }
+
+        CTranspositionTable tt(1);
+        CSearch search(&tt);
+        CBoard board;
+        std::vector<CMove> pv;
+        std::vector<TrainingEntry> entries;
+        std::string line, fen;
+        float result;
+        std::size_t malformed = 0;
+
+        while (std::getline(positions, line)) {
+            try {
+                if (!Tuner::parseLabel(line, &fen, &result)) throw std::invalid_argument("No result");
+                board.setFen(fen);
+            } catch (const std::invalid_argument &) {
+                malformed += !line.empty();
+                continue;
+            }
+
+            search.resolve(board, &pv);
+            for (auto move : pv) board.makeMove(move);
+
+            int sign = board.getSideToMove() == enumColour::white ? 1 : -1;
+            int outcome = result > 0.75f ? 1 : result < 0.25f ? -1 : 0;
+            entries.push_back(CTrainingData::pack(board, Evaluation::evaluate(board), sign * outcome));
+        }
+
+        if (!CTrainingData::write(argv[3], entries)) {
+            std::cerr << "Could not write " << argv[3] << std::endl;
+            return 1;
+        }
+
+        std::cout << "Positions : " << entries.size() << " (" << malformed << " malformed)" << std::endl;
+        return 0;
+    }
+
+    if (argc > 1 and std::string(argv[1]) == "bitbase") {
+        int threads;
+        if (!numberArgument(argc, argv, 2, 1, &threads)) return usage();
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<U64> table = Bitbase::generate(enumPiece::nPawn, threads);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+        if (argc > 3) {
+            std::size_t wins = 0;
+            for (auto word : table) wins += Bitboard::popcount(word);
+
+            std::cout << "Positions : " << Bitbase::KPK_POSITIONS << " (" << wins << " wins)" << std::endl;
+            std::cout << "Seconds   : " << seconds.count() << std::endl;
+
+            std::ofstream header(argv[3]);
+            Bitbase::writeHeader(table, header);
+        } else {
+            Bitbase::writeHeader(table, std::cout);
+        }
+
+        return 0;
+    }
+
+    if (argc > 2 and std::string(argv[1]) == "pgn") {
+        int threads;
+        if (!numberArgument(argc, argv, 3, 1, &threads)) return usage();
+
+        CPgnReader reader;
+
+        if (!reader.open(argv[2])) {
+            std::cerr << "Could not open " << argv[2] << std::endl;
+            return 1;
+        }
+
+        PgnStats stats = reader.forEachGame([](const PgnGame &, const std::vector<CMove> &, CBoard *) {}, threads);
+
+        std::cout << "Games           : " << stats.games << "\n"
+                  << "Malformed games : " << stats.malformed << "\n"
+                  << "Moves           : " << stats.moves << "\n"
+                  << "Total time (ms) : " << static_cast<U64>(stats.seconds * 1000) << "\n"
+                  << "Games/second    : " << static_cast<U64>(stats.gamesPerSecond()) << std::endl;
+
+        return 0;
+    }
+
+    if (argc > 2 and std::string(argv[1]) == "serve") {
+        ServiceConfig config;
+        config.socketPath = argv[2];
+        if (!numberArgument(argc, argv, 3, config.workers, &config.workers)) return usage();
+        if (!numberArgument(argc, argv, 4, config.hashMegabytes, &config.hashMegabytes)) return usage();
+
+        // Blocked before any thread starts so only sigwait sees them
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        CEngineService service(config);
+
+        if (!service.start()) {
+            std::cerr << "Could not listen on " << config.socketPath << std::endl;
+            return 1;
+        }
+
+        std::cout << "Serving on " << config.socketPath << " with " << config.workers << " workers" << std::endl;
+
+        int signal;
+        sigwait(&signals, &signal);
+        service.stop();
+
+        std::cout << "Latency (us)    : " << service.getLatency().toString() << std::endl;
+
+        return 0;
+    }
+
+    if (argc > 2 and std::string(argv[1]) == "loadgen") {
+        LoadGen::LoadConfig config;
+        config.socketPath = argv[2];
+        if (!numberArgument(argc, argv, 3, config.clients, &config.clients)) return usage();
+        if (!numberArgument(argc, argv, 4, config.requests, &config.requests)) return usage();
+        if (!numberArgument(argc, argv, 5, config.nodes, &config.nodes)) return usage();
+
+        LoadGen::LoadReport report = LoadGen::run(config);
+        LoadGen::print(report, std::cout);
+
+        return report.errors > 0 ? 1 : 0;
+    }
+
+    Uci::loop(std::cin, std::cout);
+
+    return 0;
+}
@@ -107,6 +107,8 @@ TEST_CASE("Create board - invalid FEN string") {
     CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6k t - - 0 1"), std::invalid_argument);
     CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6k w sdfa - 0 1"), std::invalid_argument);
     CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6k w _ x1 0 1"), std::invalid_argument);
+    CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6k w - e9 0 1"), std::invalid_argument);
+    CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6k w K\xE9 - 0 1"), std::invalid_argument);
 
     // Wrong length for piece arrangement
     CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/K6x w - - 0 1"), std::invalid_argument);
@@ -116,3 +118,22 @@ TEST_CASE("Create board - invalid FEN string") {
     CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6x w - - -1 1"), std::invalid_argument);
     CHECK_THROWS_AS(CBoard("8/8/8/8/8/8/8/K6x w - - 0 -1"), std::invalid_argument);
 }
+
+TEST_CASE("Create board - Square lookups") {
+    CHECK(CBoard("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 2").getEnPassantSquare() == enumSquare::d6);
+
+    CHECK(Constants::squareFromString("a8") == enumSquare::a8);
+    CHECK(Constants::squareFromString("h1") == enumSquare::h1);
+    CHECK(Constants::squareFromString("e4") == enumSquare::e4);
+    CHECK(Constants::squareFromString("i4") == enumSquare::no_sq);
+    CHECK(Constants::squareFromString("e44") == enumSquare::no_sq);
+
+    for (int square = 0; square < 64; ++square) {
+        auto [rank, file] = Constants::squareToCoords(static_cast<enumSquare>(square));
+        CHECK(rank * 8 + file == square);
+    }
+
+    static_assert(Constants::CASTLE_CHAR_TO_RIGHTS['q'] == Constants::BLACK_QUEENSIDE_CASTLE);
+    static_assert(Constants::PIECE_CHAR_TO_ENUM['n'] == enumPiece::nKnight);
+    static_assert(Constants::PIECE_CHAR_TO_ENUM['x'] == enumPiece::nWhite);
+}
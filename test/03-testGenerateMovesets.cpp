@@ -99,3 +99,56 @@ TEST_CASE("Getting King movesets") {
     std::vector<enumSquare> d4Moves = { d5, e5, e4, e3, d3, c3, c4, c5 };
     setAndCheck(&d4Moves, &board, &d4, enumSquare::d4, kingMovesets);
 }
+
+TEST_CASE("Getting Bishop movesets") {
+    CBoard board = CBoard();
+
+    // Empty board
+    U64 d4 = 0ULL;
+    std::vector<enumSquare> d4Moves = { a7, b6, c5, e3, f2, g1, a1, b2, c3, e5, f6, g7, h8 };
+    for (auto move : d4Moves) board.setSquare(&d4, move);
+    CHECK(board.getBishopMoveset(enumSquare::d4, 0ULL, 0ULL) == d4);
+
+    // Blockers are included in the moveset, squares behind them are not
+    U64 blockers = 0ULL;
+    board.setSquare(&blockers, enumSquare::f6);
+    board.setSquare(&blockers, enumSquare::b2);
+
+    U64 d4Blocked = 0ULL;
+    std::vector<enumSquare> d4BlockedMoves = { a7, b6, c5, e3, f2, g1, b2, c3, e5, f6 };
+    for (auto move : d4BlockedMoves) board.setSquare(&d4Blocked, move);
+    CHECK(board.getBishopMoveset(enumSquare::d4, blockers, 0ULL) == d4Blocked);
+}
+
+TEST_CASE("Getting Rook movesets") {
+    CBoard board = CBoard();
+
+    // Empty board, edge of the board
+    U64 a4 = 0ULL;
+    std::vector<enumSquare> a4Moves = { a1, a2, a3, a5, a6, a7, a8, b4, c4, d4, e4, f4, g4, h4 };
+    for (auto move : a4Moves) board.setSquare(&a4, move);
+    CHECK(board.getRookMoveset(enumSquare::a4, 0ULL, 0ULL) == a4);
+
+    U64 blockers = 0ULL;
+    board.setSquare(&blockers, enumSquare::a6);
+    board.setSquare(&blockers, enumSquare::c4);
+    board.setSquare(&blockers, enumSquare::a2);
+
+    U64 a4Blocked = 0ULL;
+    std::vector<enumSquare> a4BlockedMoves = { a2, a3, a5, a6, b4, c4 };
+    for (auto move : a4BlockedMoves) board.setSquare(&a4Blocked, move);
+    CHECK(board.getRookMoveset(enumSquare::a4, blockers, 0ULL) == a4Blocked);
+
+    // Queen is the union of both
+    CHECK(board.getQueenMoveset(enumSquare::a4, blockers, 0ULL) ==
+        (board.getRookMoveset(enumSquare::a4, blockers, 0ULL) | board.getBishopMoveset(enumSquare::a4, blockers, 0ULL)));
+}
+
+TEST_CASE("Movesets are shared between boards") {
+    CBoard board, other("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1");
+    CBoard copy = other;
+
+    CHECK(board.getKnightMovesets() == other.getKnightMovesets());
+    CHECK(board.getRookBlockerMasks() == copy.getRookBlockerMasks());
+    CHECK(copy.getRookMoveset(enumSquare::b4, copy.getOccupiedSquares(), 0ULL) == other.getRookMoveset(enumSquare::b4, other.getOccupiedSquares(), 0ULL));
+}
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/constants.h"
+
+U64 squaresToBB(CBoard *board, std::vector<enumSquare> squares) {
+    U64 bb = 0ULL;
+    for (auto square : squares) board->setSquare(&bb, square);
+    return bb;
+}
+
+int countFlags(std::vector<CMove> *moves, unsigned int flags) {
+    int count = 0;
+    for (auto move : *moves) if (move.getFlags() == flags) ++count;
+    return count;
+}
+
+TEST_CASE("Pawn pushes - Initial position") {
+    CBoard board = CBoard();
+
+    CHECK(board.pawnPushTargets<enumColour::white>() == Constants::RANK_3);
+    CHECK(board.pawnDoublePushTargets<enumColour::white>() == Constants::RANK_4);
+    CHECK(board.pawnPushTargets<enumColour::black>() == Constants::RANK_6);
+    CHECK(board.pawnDoublePushTargets<enumColour::black>() == Constants::RANK_5);
+
+    CHECK(board.pawnsCanPush<enumColour::white>() == Constants::RANK_2);
+    CHECK(board.pawnsCanDoublePush<enumColour::white>() == Constants::RANK_2);
+    CHECK(board.pawnsCanPush<enumColour::black>() == Constants::RANK_7);
+    CHECK(board.pawnsCanDoublePush<enumColour::black>() == Constants::RANK_7);
+
+    std::vector<CMove> moves;
+    board.generatePawnMoves(&moves);
+
+    CHECK(moves.size() == 16);
+    CHECK(countFlags(&moves, Constants::DOUBLE_PAWN_PUSH_FLAG) == 8);
+}
+
+TEST_CASE("Pawn pushes - Blocked pawns") {
+    CBoard board = CBoard("4k3/8/8/8/8/4n3/3nP3/4K3 w - - 0 1");
+
+    // e2 is blocked, and nothing stops d2 because it is a knight, not a pawn
+    CHECK(board.pawnPushTargets<enumColour::white>() == 0ULL);
+    CHECK(board.pawnsCanPush<enumColour::white>() == 0ULL);
+    CHECK(board.pawnsCanDoublePush<enumColour::white>() == 0ULL);
+
+    CBoard board2 = CBoard("4k3/8/8/8/4n3/8/4P3/4K3 w - - 0 1");
+
+    CHECK(board2.pawnPushTargets<enumColour::white>() == squaresToBB(&board2, { e3 }));
+    CHECK(board2.pawnDoublePushTargets<enumColour::white>() == 0ULL);
+    CHECK(board2.pawnsCanPush<enumColour::white>() == squaresToBB(&board2, { e2 }));
+    CHECK(board2.pawnsCanDoublePush<enumColour::white>() == 0ULL);
+}
+
+TEST_CASE("Pawn attacks - No wrapping across files") {
+    CBoard board = CBoard("4k3/p6p/8/8/8/8/P6P/4K3 w - - 0 1");
+
+    CHECK(board.pawnEastAttacks<enumColour::white>() == squaresToBB(&board, { b3 }));
+    CHECK(board.pawnWestAttacks<enumColour::white>() == squaresToBB(&board, { g3 }));
+    CHECK(board.pawnAnyAttacks<enumColour::white>() == squaresToBB(&board, { b3, g3 }));
+
+    CHECK(board.pawnEastAttacks<enumColour::black>() == squaresToBB(&board, { b6 }));
+    CHECK(board.pawnWestAttacks<enumColour::black>() == squaresToBB(&board, { g6 }));
+    CHECK(board.pawnAnyAttacks<enumColour::black>() == squaresToBB(&board, { b6, g6 }));
+}
+
+TEST_CASE("Pawn captures") {
+    CBoard board = CBoard("4k3/8/8/3p1p2/4P3/8/8/4K3 w - - 0 1");
+
+    CHECK(board.pawnEastCaptureTargets<enumColour::white>() == squaresToBB(&board, { f5 }));
+    CHECK(board.pawnWestCaptureTargets<enumColour::white>() == squaresToBB(&board, { d5 }));
+    CHECK(board.pawnEastCaptureTargets<enumColour::black>() == squaresToBB(&board, { e4 }));
+    CHECK(board.pawnWestCaptureTargets<enumColour::black>() == squaresToBB(&board, { e4 }));
+
+    std::vector<CMove> moves;
+    board.generatePawnMoves(&moves);
+
+    CHECK(moves.size() == 3);
+    CHECK(countFlags(&moves, Constants::CAPTURE_FLAG) == 2);
+}
+
+TEST_CASE("Pawn captures - En passant") {
+    CBoard board = CBoard("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+
+    CHECK(board.pawnEastEnPassantTargets<enumColour::white>() == squaresToBB(&board, { f6 }));
+    CHECK(board.pawnWestEnPassantTargets<enumColour::white>() == 0ULL);
+
+    std::vector<CMove> moves;
+    board.generatePawnMoves(&moves);
+
+    REQUIRE(countFlags(&moves, Constants::EP_CAPTURE_FLAG) == 1);
+    for (auto move : moves) {
+        if (move.getFlags() != Constants::EP_CAPTURE_FLAG) continue;
+        CHECK(move.getFrom() == enumSquare::e5);
+        CHECK(move.getTo() == enumSquare::f6);
+    }
+
+    CBoard board2 = CBoard("4k3/8/8/8/3pPp2/8/8/4K3 b - e3 0 1");
+
+    CHECK(board2.pawnEastEnPassantTargets<enumColour::black>() == squaresToBB(&board2, { e3 }));
+    CHECK(board2.pawnWestEnPassantTargets<enumColour::black>() == squaresToBB(&board2, { e3 }));
+
+    moves.clear();
+    board2.generatePawnMoves(&moves);
+
+    CHECK(countFlags(&moves, Constants::EP_CAPTURE_FLAG) == 2);
+}
+
+TEST_CASE("Pawn promotions") {
+    CBoard board = CBoard("1n2k3/P7/8/8/8/8/7p/4K1N1 w - - 0 1");
+
+    std::vector<CMove> moves;
+    board.generatePawnMoves(&moves);
+
+    CHECK(moves.size() == 8);
+    for (unsigned int flags = Constants::N_PROMO_FLAG; flags <= Constants::Q_PROMO_CAPTURE_FLAG; ++flags) {
+        CHECK(countFlags(&moves, flags) == 1);
+    }
+
+    board.changeTurn();
+    moves.clear();
+    board.generatePawnMoves(&moves);
+
+    CHECK(moves.size() == 8);
+    CHECK(countFlags(&moves, Constants::Q_PROMO_CAPTURE_FLAG) == 1);
+    CHECK(countFlags(&moves, Constants::Q_PROMO_FLAG) == 1);
+}
@@ -0,0 +1,69 @@
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "chessbot/bitboard.h"
+
+// Everything in the bitboard layer is usable at compile time
+static_assert(Bitboard::popcount(Constants::RANK_1) == 8);
+static_assert(Bitboard::lsb(Constants::FILE_H) == enumSquare::h8);
+static_assert(Bitboard::msb(Constants::FILE_A) == enumSquare::a1);
+static_assert(Bitboard::shiftNorth(Constants::RANK_2) == Constants::RANK_3);
+
+TEST_CASE("Bitboard - Counting and scanning") {
+    U64 bb = Bitboard::squareBB(enumSquare::c7) | Bitboard::squareBB(enumSquare::f2) | Bitboard::squareBB(enumSquare::h1);
+
+    CHECK(Bitboard::popcount(bb) == 3);
+    CHECK(Bitboard::popcount(0ULL) == 0);
+    CHECK(Bitboard::popcount(~0ULL) == 64);
+
+    CHECK(Bitboard::lsb(bb) == enumSquare::c7);
+    CHECK(Bitboard::msb(bb) == enumSquare::h1);
+
+    CHECK(Bitboard::moreThanOne(bb));
+    CHECK(!Bitboard::moreThanOne(Bitboard::squareBB(enumSquare::e4)));
+    CHECK(!Bitboard::moreThanOne(0ULL));
+
+    CHECK(Bitboard::testSquare(bb, enumSquare::f2));
+    CHECK(!Bitboard::testSquare(bb, enumSquare::f3));
+
+    CHECK(Bitboard::popLsb(bb) == enumSquare::c7);
+    CHECK(Bitboard::popLsb(bb) == enumSquare::f2);
+    CHECK(Bitboard::popLsb(bb) == enumSquare::h1);
+    CHECK(bb == 0ULL);
+}
+
+TEST_CASE("Bitboard - Iterating over squares") {
+    std::vector<enumSquare> squares;
+    for (auto square : Bitboard::squares(Constants::CORNER_MASK)) squares.emplace_back(square);
+
+    CHECK(squares == std::vector<enumSquare>{ a8, h8, a1, h1 });
+
+    int count = 0;
+    for (auto square : Bitboard::squares(0ULL)) count += square;
+
+    CHECK(count == 0);
+}
+
+TEST_CASE("Bitboard - Shifting without wrapping") {
+    CHECK(Bitboard::shiftNorth(Constants::RANK_8) == 0ULL);
+    CHECK(Bitboard::shiftSouth(Constants::RANK_1) == 0ULL);
+    CHECK(Bitboard::shiftSouth(Constants::RANK_7) == Constants::RANK_6);
+
+    CHECK(Bitboard::shiftEast(Constants::FILE_H) == 0ULL);
+    CHECK(Bitboard::shiftWest(Constants::FILE_A) == 0ULL);
+    CHECK(Bitboard::shiftWest(Constants::FILE_H) == Constants::FILE_H >> 1);
+
+    U64 a4 = Bitboard::squareBB(enumSquare::a4);
+    U64 h4 = Bitboard::squareBB(enumSquare::h4);
+
+    CHECK(Bitboard::shiftNorthEast(a4) == Bitboard::squareBB(enumSquare::b5));
+    CHECK(Bitboard::shiftSouthEast(a4) == Bitboard::squareBB(enumSquare::b3));
+    CHECK(Bitboard::shiftNorthWest(a4) == 0ULL);
+    CHECK(Bitboard::shiftSouthWest(a4) == 0ULL);
+
+    CHECK(Bitboard::shiftNorthWest(h4) == Bitboard::squareBB(enumSquare::g5));
+    CHECK(Bitboard::shiftSouthWest(h4) == Bitboard::squareBB(enumSquare::g3));
+    CHECK(Bitboard::shiftNorthEast(h4) == 0ULL);
+    CHECK(Bitboard::shiftSouthEast(h4) == 0ULL);
+}
@@ -0,0 +1,160 @@
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/constants.h"
+
+std::array<U64, 8> getAllPieceSets(CBoard *board) {
+    std::array<U64, 8> pieceSets;
+    for (int i = 0; i < 8; ++i) pieceSets[i] = board->getPieceSet(static_cast<enumPiece>(i));
+    return pieceSets;
+}
+
+uint8_t piece(enumPiece colour, enumPiece type) {
+    return type | (colour << Constants::PIECE_COLOUR_SHIFT);
+}
+
+TEST_CASE("Mailbox - Initial position") {
+    CBoard board = CBoard();
+
+    CHECK(board.isConsistent());
+
+    CHECK(board.pieceOn(enumSquare::e1) == piece(enumPiece::nWhite, enumPiece::nKing));
+    CHECK(board.pieceOn(enumSquare::d8) == piece(enumPiece::nBlack, enumPiece::nQueen));
+    CHECK(board.pieceOn(enumSquare::e4) == Constants::NO_PIECE);
+
+    CHECK(board.pieceTypeOn(enumSquare::b8) == enumPiece::nKnight);
+    CHECK(board.pieceColourOn(enumSquare::b8) == enumPiece::nBlack);
+    CHECK(board.pieceTypeOn(enumSquare::h2) == enumPiece::nPawn);
+    CHECK(board.pieceColourOn(enumSquare::h2) == enumPiece::nWhite);
+}
+
+TEST_CASE("Mailbox - Manipulating squares") {
+    CBoard board = CBoard("k7/8/8/8/8/8/8/7K b - - 0 1");
+
+    board.setSquare(enumPiece::nRook, enumSquare::d4);
+    board.setSquare(enumPiece::nBlack, enumSquare::d4);
+
+    CHECK(board.pieceOn(enumSquare::d4) == piece(enumPiece::nBlack, enumPiece::nRook));
+    CHECK(board.isConsistent());
+
+    board.unsetSquare(enumPiece::nBlack, enumSquare::d4);
+    CHECK(!board.isConsistent());
+
+    board.unsetSquare(enumPiece::nRook, enumSquare::d4);
+    CHECK(board.pieceOn(enumSquare::d4) == Constants::NO_PIECE);
+    CHECK(board.isConsistent());
+}
+
+TEST_CASE("Make and unmake - Quiet moves and captures") {
+    CBoard board = CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    auto before = getAllPieceSets(&board);
+
+    // Nxd7
+    CMove capture = CMove(enumSquare::e5, enumSquare::d7, Constants::CAPTURE_FLAG);
+    board.makeMove(capture);
+
+    CHECK(board.pieceOn(enumSquare::d7) == piece(enumPiece::nWhite, enumPiece::nKnight));
+    CHECK(board.pieceOn(enumSquare::e5) == Constants::NO_PIECE);
+    CHECK(board.getSideToMove() == enumColour::black);
+    CHECK(board.isConsistent());
+
+    board.unmakeMove(capture);
+
+    CHECK(getAllPieceSets(&board) == before);
+    CHECK(board.pieceOn(enumSquare::d7) == piece(enumPiece::nBlack, enumPiece::nPawn));
+    CHECK(board.getSideToMove() == enumColour::white);
+
+    // Rook moves lose castling rights
+    CMove rookMove = CMove(enumSquare::h1, enumSquare::g1, Constants::QUIET_FLAG);
+    board.makeMove(rookMove);
+
+    CHECK(board.getCastleState() == (
+        Constants::WHITE_QUEENSIDE_CASTLE |
+        Constants::BLACK_KINGSIDE_CASTLE |
+        Constants::BLACK_QUEENSIDE_CASTLE
+    ));
+
+    board.unmakeMove(rookMove);
+
+    CHECK(getAllPieceSets(&board) == before);
+    CHECK(board.getCastleState() == 15);
+}
+
+TEST_CASE("Make and unmake - Castling") {
+    CBoard board = CBoard("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1");
+    auto before = getAllPieceSets(&board);
+
+    CMove kingside = CMove(enumSquare::e1, enumSquare::g1, Constants::KING_CASTLE_FLAG);
+    board.makeMove(kingside);
+
+    CHECK(board.pieceOn(enumSquare::g1) == piece(enumPiece::nWhite, enumPiece::nKing));
+    CHECK(board.pieceOn(enumSquare::f1) == piece(enumPiece::nWhite, enumPiece::nRook));
+    CHECK(board.pieceOn(enumSquare::h1) == Constants::NO_PIECE);
+    CHECK(board.getCastleState() == (Constants::BLACK_KINGSIDE_CASTLE | Constants::BLACK_QUEENSIDE_CASTLE));
+
+    CMove queenside = CMove(enumSquare::e8, enumSquare::c8, Constants::QUEEN_CASTLE_FLAG);
+    board.makeMove(queenside);
+
+    CHECK(board.pieceOn(enumSquare::c8) == piece(enumPiece::nBlack, enumPiece::nKing));
+    CHECK(board.pieceOn(enumSquare::d8) == piece(enumPiece::nBlack, enumPiece::nRook));
+    CHECK(board.pieceOn(enumSquare::a8) == Constants::NO_PIECE);
+    CHECK(board.getCastleState() == 0);
+
+    board.unmakeMove(queenside);
+    board.unmakeMove(kingside);
+
+    CHECK(getAllPieceSets(&board) == before);
+    CHECK(board.getCastleState() == 15);
+    CHECK(board.isConsistent());
+}
+
+TEST_CASE("Make and unmake - En passant and promotions") {
+    CBoard board = CBoard("4k3/1P6/8/8/5p2/8/4P3/4K3 w - - 0 1");
+    auto before = getAllPieceSets(&board);
+
+    CMove doublePush = CMove(enumSquare::e2, enumSquare::e4, Constants::DOUBLE_PAWN_PUSH_FLAG);
+    board.makeMove(doublePush);
+
+    CHECK(board.getEnPassantSquare() == enumSquare::e3);
+
+    CMove enPassant = CMove(enumSquare::f4, enumSquare::e3, Constants::EP_CAPTURE_FLAG);
+    board.makeMove(enPassant);
+
+    CHECK(board.pieceOn(enumSquare::e3) == piece(enumPiece::nBlack, enumPiece::nPawn));
+    CHECK(board.pieceOn(enumSquare::e4) == Constants::NO_PIECE);
+    CHECK(board.getEnPassantSquare() == enumSquare::no_sq);
+
+    CMove promotion = CMove(enumSquare::b7, enumSquare::b8, Constants::Q_PROMO_FLAG);
+    board.makeMove(promotion);
+
+    CHECK(board.pieceOn(enumSquare::b8) == piece(enumPiece::nWhite, enumPiece::nQueen));
+    CHECK(board.getPieceSet(enumPiece::nPawn, enumPiece::nWhite) == 0ULL);
+    CHECK(board.isConsistent());
+
+    board.unmakeMove(promotion);
+    board.unmakeMove(enPassant);
+    board.unmakeMove(doublePush);
+
+    CHECK(getAllPieceSets(&board) == before);
+    CHECK(board.getEnPassantSquare() == enumSquare::no_sq);
+    CHECK(board.isConsistent());
+}
+
+TEST_CASE("Make and unmake - All pawn moves") {
+    CBoard board = CBoard("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+    auto before = getAllPieceSets(&board);
+
+    std::vector<CMove> moves;
+    board.generatePawnMoves(&moves);
+
+    for (auto move : moves) {
+        board.makeMove(move);
+        CHECK(board.isConsistent());
+        board.unmakeMove(move);
+
+        CHECK(getAllPieceSets(&board) == before);
+        CHECK(board.getEnPassantSquare() == enumSquare::f6);
+    }
+}
@@ -0,0 +1,124 @@
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/constants.h"
+
+void makeMoves(CBoard *board, std::vector<CMove> moves) {
+    for (auto move : moves) board->makeMove(move);
+}
+
+TEST_CASE("Zobrist keys - Transpositions hash the same") {
+    CBoard board = CBoard();
+    CBoard board2 = CBoard();
+    U64 initialKey = board.getKey();
+
+    makeMoves(&board, {
+        CMove(enumSquare::g1, enumSquare::f3), CMove(enumSquare::g8, enumSquare::f6),
+        CMove(enumSquare::b1, enumSquare::c3)
+    });
+    makeMoves(&board2, {
+        CMove(enumSquare::b1, enumSquare::c3), CMove(enumSquare::g8, enumSquare::f6),
+        CMove(enumSquare::g1, enumSquare::f3)
+    });
+
+    CHECK(board.getKey() == board2.getKey());
+    CHECK(board.getKey() == CBoard("rnbqkb1r/pppppppp/5n2/8/8/2N2N2/PPPPPPPP/R1BQKB1R b KQkq - 3 2").getKey());
+
+    board.unmakeMove(CMove(enumSquare::b1, enumSquare::c3));
+    board.unmakeMove(CMove(enumSquare::g8, enumSquare::f6));
+    board.unmakeMove(CMove(enumSquare::g1, enumSquare::f3));
+
+    CHECK(board.getKey() == initialKey);
+
+    // Side to move, castling rights and en passant are all part of the key
+    CHECK(initialKey != CBoard("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq - 0 1").getKey());
+    CHECK(initialKey != CBoard("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w Kkq - 0 1").getKey());
+    CHECK(
+        CBoard("4k3/8/8/8/3pP3/8/8/4K3 b - e3 0 1").getKey() !=
+        CBoard("4k3/8/8/8/3pP3/8/8/4K3 b - - 0 1").getKey()
+    );
+}
+
+TEST_CASE("Zobrist keys - En passant only counts when it can be captured") {
+    CBoard board = CBoard("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1");
+    board.makeMove(CMove(enumSquare::e2, enumSquare::e4, Constants::DOUBLE_PAWN_PUSH_FLAG));
+
+    CHECK(board.getEnPassantSquare() == enumSquare::no_sq);
+    CHECK(board.getKey() == CBoard("4k3/8/8/8/4P3/8/8/4K3 b - - 0 1").getKey());
+    CHECK(board.isConsistent());
+}
+
+TEST_CASE("Draws - Fifty move rule") {
+    CHECK(!CBoard("4k3/8/8/8/8/8/8/4K2R w - - 99 80").isFiftyMoveDraw());
+    CHECK(CBoard("4k3/8/8/8/8/8/8/4K2R w - - 100 80").isFiftyMoveDraw());
+    CHECK(CBoard("4k3/8/8/8/8/8/8/4K2R w - - 100 80").isDraw(0));
+
+    CBoard board = CBoard("4k3/8/8/8/8/8/8/4K2R w - - 99 80");
+    board.makeMove(CMove(enumSquare::h1, enumSquare::h2));
+    CHECK(board.isFiftyMoveDraw());
+}
+
+TEST_CASE("Draws - Repetition") {
+    CBoard board = CBoard();
+
+    std::vector<CMove> shuffle = {
+        CMove(enumSquare::g1, enumSquare::f3), CMove(enumSquare::g8, enumSquare::f6),
+        CMove(enumSquare::f3, enumSquare::g1), CMove(enumSquare::f6, enumSquare::g8)
+    };
+
+    makeMoves(&board, shuffle);
+
+    // Repeated once, only a draw if it happened inside the search tree
+    CHECK(!board.isRepetition(0));
+    CHECK(board.isRepetition(5));
+
+    makeMoves(&board, shuffle);
+
+    // Threefold repetition
+    CHECK(board.isRepetition(0));
+    CHECK(board.isDraw(0));
+
+    // Pawn moves are irreversible, nothing before them can repeat
+    board.makeMove(CMove(enumSquare::e2, enumSquare::e4, Constants::DOUBLE_PAWN_PUSH_FLAG));
+    makeMoves(&board, {
+        CMove(enumSquare::g8, enumSquare::f6), CMove(enumSquare::g1, enumSquare::f3),
+        CMove(enumSquare::f6, enumSquare::g8), CMove(enumSquare::f3, enumSquare::g1)
+    });
+
+    CHECK(!board.isRepetition(0));
+    CHECK(board.isRepetition(5));
+}
+
+TEST_CASE("Draws - Upcoming repetition") {
+    CBoard board = CBoard();
+
+    makeMoves(&board, {
+        CMove(enumSquare::g1, enumSquare::f3), CMove(enumSquare::g8, enumSquare::f6),
+        CMove(enumSquare::f3, enumSquare::g1)
+    });
+
+    // Black can play Ng8 to repeat the initial position
+    CHECK(board.hasUpcomingRepetition(4));
+
+    // Before the root, the initial position has to have occurred twice already
+    CHECK(!board.hasUpcomingRepetition(0));
+
+    makeMoves(&board, {
+        CMove(enumSquare::f6, enumSquare::g8), CMove(enumSquare::g1, enumSquare::f3),
+        CMove(enumSquare::g8, enumSquare::f6), CMove(enumSquare::f3, enumSquare::g1)
+    });
+
+    CHECK(board.hasUpcomingRepetition(0));
+
+    // Not reachable in one move
+    CBoard board2 = CBoard();
+
+    makeMoves(&board2, {
+        CMove(enumSquare::g1, enumSquare::f3), CMove(enumSquare::g8, enumSquare::f6),
+        CMove(enumSquare::b1, enumSquare::c3)
+    });
+
+    CHECK(!board2.hasUpcomingRepetition(4));
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/bitboard.h"
+#include "chessbot/constants.h"
+
+TEST_CASE("Attacks - Attacked squares") {
+    CBoard board = CBoard("4k3/8/8/3p4/8/2N5/8/R3K3 w Q - 0 1");
+
+    // Pawn, knight, rook and king attacks
+    CHECK(board.isSquareAttacked(enumSquare::e4, enumPiece::nBlack));
+    CHECK(board.isSquareAttacked(enumSquare::c4, enumPiece::nBlack));
+    CHECK(!board.isSquareAttacked(enumSquare::d4, enumPiece::nBlack));
+    CHECK(board.isSquareAttacked(enumSquare::d5, enumPiece::nWhite));
+    CHECK(board.isSquareAttacked(enumSquare::a8, enumPiece::nWhite));
+    CHECK(board.isSquareAttacked(enumSquare::d2, enumPiece::nWhite));
+    CHECK(board.isSquareAttacked(enumSquare::d7, enumPiece::nBlack));
+
+    // The rook is blocked by the king
+    CHECK(board.isSquareAttacked(enumSquare::f1, enumPiece::nWhite));
+    CHECK(!board.isSquareAttacked(enumSquare::h1, enumPiece::nWhite));
+
+    U64 attackers = board.attackersTo(enumSquare::d5, board.getOccupiedSquares());
+    CHECK(attackers == board.getPieceSet(enumPiece::nKnight));
+}
+
+TEST_CASE("Attacks - Checkers") {
+    CBoard board = CBoard();
+
+    CHECK(!board.isInCheck());
+    CHECK(board.getCheckers() == 0ULL);
+
+    // Double check from a knight and a bishop
+    CBoard board2 = CBoard("4k3/8/3N4/8/B7/8/8/4K3 b - - 0 1");
+
+    CHECK(board2.isInCheck());
+    CHECK(board2.getCheckers() == (Bitboard::squareBB(enumSquare::d6) | Bitboard::squareBB(enumSquare::a4)));
+}
+
+TEST_CASE("Attacks - Pinned pieces") {
+    CBoard board = CBoard("4k3/4r3/8/b7/8/2N5/4B3/3RK3 w - - 0 1");
+
+    // The bishop on e2 is pinned by the rook and the knight on c3 by the bishop,
+    // d1 is next to the king but not between it and a slider
+    CHECK(board.getPinnedPieces() == (Bitboard::squareBB(enumSquare::e2) | Bitboard::squareBB(enumSquare::c3)));
+
+    // Two pieces on the line means neither is pinned
+    CBoard board2 = CBoard("4k3/4r3/8/8/4N3/8/4B3/4K3 w - - 0 1");
+
+    CHECK(board2.getPinnedPieces() == 0ULL);
+}
+
+TEST_CASE("Attacks - Gives check") {
+    CBoard board = CBoard("4k3/8/8/8/8/8/8/R3K1NB w Q - 0 1");
+
+    // Direct checks
+    CHECK(board.givesCheck(CMove(enumSquare::a1, enumSquare::a8)));
+    CHECK(!board.givesCheck(CMove(enumSquare::a1, enumSquare::a7)));
+    CHECK(board.givesCheck(CMove(enumSquare::g1, enumSquare::f6)));
+    CHECK(!board.givesCheck(CMove(enumSquare::g1, enumSquare::f3)));
+
+    // Castling puts the rook on d1
+    CHECK(!board.givesCheck(CMove(enumSquare::e1, enumSquare::c1, Constants::QUEEN_CASTLE_FLAG)));
+
+    // Discovered check from the bishop once the knight moves
+    CBoard board2 = CBoard("7k/8/8/8/8/8/1N6/B3K3 w - - 0 1");
+
+    CHECK(board2.givesCheck(CMove(enumSquare::b2, enumSquare::d3)));
+    CHECK(board2.givesCheck(CMove(enumSquare::b2, enumSquare::c4)));
+
+    // Promotions and en passant
+    CBoard board3 = CBoard("1k6/4P3/8/8/8/8/8/4K3 w - - 0 1");
+
+    CHECK(board3.givesCheck(CMove(enumSquare::e7, enumSquare::e8, Constants::Q_PROMO_FLAG)));
+    CHECK(board3.givesCheck(CMove(enumSquare::e7, enumSquare::e8, Constants::R_PROMO_FLAG)));
+    CHECK(!board3.givesCheck(CMove(enumSquare::e7, enumSquare::e8, Constants::B_PROMO_FLAG)));
+
+    CBoard board4 = CBoard("8/8/8/k2pP2R/8/8/8/4K3 w - d6 0 1");
+
+    CHECK(board4.givesCheck(CMove(enumSquare::e5, enumSquare::d6, Constants::EP_CAPTURE_FLAG)));
+}
+
+TEST_CASE("Attacks - Check information follows make and unmake") {
+    CBoard board = CBoard("4k3/8/8/8/8/8/8/R3K3 w Q - 0 1");
+    CMove check = CMove(enumSquare::a1, enumSquare::a8);
+
+    board.makeMove(check);
+    CHECK(board.isInCheck());
+    CHECK(board.getCheckers() == Bitboard::squareBB(enumSquare::a8));
+
+    board.unmakeMove(check);
+    CHECK(!board.isInCheck());
+}
@@ -0,0 +1,49 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "chessbot/CBoard.h"
+
+// Reference node counts from https://www.chessprogramming.org/Perft_Results
+
+TEST_CASE("Perft - Initial position") {
+    CBoard board = CBoard();
+
+    CHECK(board.perft(1) == 20);
+    CHECK(board.perft(2) == 400);
+    CHECK(board.perft(3) == 8902);
+    CHECK(board.perft(4) == 197281);
+}
+
+TEST_CASE("Perft - Kiwipete") {
+    CBoard board = CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+    CHECK(board.perft(1) == 48);
+    CHECK(board.perft(2) == 2039);
+    CHECK(board.perft(3) == 97862);
+}
+
+TEST_CASE("Perft - Position 3") {
+    CBoard board = CBoard("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1");
+
+    CHECK(board.perft(1) == 14);
+    CHECK(board.perft(2) == 191);
+    CHECK(board.perft(3) == 2812);
+    CHECK(board.perft(4) == 43238);
+    CHECK(board.perft(5) == 674624);
+}
+
+TEST_CASE("Perft - Position 4") {
+    CBoard board = CBoard("r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1");
+
+    CHECK(board.perft(1) == 6);
+    CHECK(board.perft(2) == 264);
+    CHECK(board.perft(3) == 9467);
+    CHECK(board.perft(4) == 422333);
+}
+
+TEST_CASE("Perft - Position 5") {
+    CBoard board = CBoard("rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8");
+
+    CHECK(board.perft(1) == 44);
+    CHECK(board.perft(2) == 1486);
+    CHECK(board.perft(3) == 62379);
+}
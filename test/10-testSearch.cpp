@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#include "chessbot/bench.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/constants.h"
+#include "chessbot/uci.h"
+
+SearchResult searchToDepth(CBoard &board, int depth) {
+    auto tt = std::make_unique<CTranspositionTable>(1);
+    auto search = std::make_unique<CSearch>(tt.get());
+
+    SearchLimits limits;
+    limits.depth = depth;
+
+    return search->search(board, limits);
+}
+
+TEST_CASE("Search - Finds mate in one") {
+    CBoard board = CBoard("6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1");
+    U64 key = board.getKey();
+
+    SearchResult result = searchToDepth(board, 4);
+
+    CHECK(Uci::moveToString(result.bestMove) == "a1a8");
+    CHECK(result.score == Constants::MATE_SCORE - 1);
+
+    // The board is left as it was given
+    CHECK(board.getKey() == key);
+    CHECK(board.isConsistent());
+}
+
+TEST_CASE("Search - No legal moves") {
+    CBoard stalemate = CBoard("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1");
+    SearchResult result = searchToDepth(stalemate, 3);
+
+    CHECK(result.bestMove == CMove());
+    CHECK(result.score == Constants::DRAW_SCORE);
+
+    CBoard checkmate = CBoard("R5k1/5ppp/8/8/8/8/8/6K1 b - - 0 1");
+    CHECK(searchToDepth(checkmate, 3).score == -Constants::MATE_SCORE);
+}
+
+TEST_CASE("Search - Node limit") {
+    CBoard board = CBoard();
+
+    auto tt = std::make_unique<CTranspositionTable>(1);
+    auto search = std::make_unique<CSearch>(tt.get());
+
+    SearchLimits limits;
+    limits.nodes = 1000;
+
+    SearchResult result = search->search(board, limits);
+
+    CHECK(result.nodes == 1000);
+    CHECK(!(result.bestMove == CMove()));
+}
+
+TEST_CASE("Search - Transposition table round trip") {
+    CTranspositionTable tt(1);
+    TTData data;
+    CMove move(enumSquare::e7, enumSquare::e8, Constants::Q_PROMO_CAPTURE_FLAG);
+
+    CHECK(!tt.probe(0x1234ULL, &data));
+
+    tt.store(0x1234ULL, move, -31990, 57, 9, enumBound::lowerBound);
+
+    REQUIRE(tt.probe(0x1234ULL, &data));
+    CHECK(data.move == move);
+    CHECK(data.score == -31990);
+    CHECK(data.eval == 57);
+    CHECK(data.depth == 9);
+    CHECK(data.bound == enumBound::lowerBound);
+
+    // Same index, different key
+    CHECK(!tt.probe(0x1234ULL + tt.getSize(), &data));
+
+    tt.clear();
+    CHECK(!tt.probe(0x1234ULL, &data));
+}
+
+TEST_CASE("Search - Bench is deterministic") {
+    std::ostringstream first, second;
+
+    U64 nodes = Bench::run(3, first);
+
+    CHECK(nodes > 0);
+    CHECK(Bench::run(3, second) == nodes);
+}
+
+TEST_CASE("Search - UCI move strings") {
+    CBoard board = CBoard("r3k2r/1P6/8/8/8/8/8/R3K2R w KQkq - 0 1");
+
+    CHECK(Uci::moveToString(Uci::parseMove(board, "e1g1")) == "e1g1");
+    CHECK(Uci::parseMove(board, "e1c1").getFlags() == Constants::QUEEN_CASTLE_FLAG);
+    CHECK(Uci::parseMove(board, "b7a8q").getFlags() == Constants::Q_PROMO_CAPTURE_FLAG);
+    CHECK(Uci::parseMove(board, "b7b8n").getFlags() == Constants::N_PROMO_FLAG);
+
+    CHECK_THROWS_AS(Uci::parseMove(board, "e1e3"), std::invalid_argument);
+    CHECK(Uci::moveToString(CMove()) == "0000");
+}
+
+TEST_CASE("Search - UCI spin option values") {
+    int value = 0;
+
+    CHECK(Uci::parseSpin("4", 1, 256, &value));
+    CHECK(value == 4);
+    CHECK(Uci::parseSpin("1000", 1, 256, &value));
+    CHECK(value == 256);
+    CHECK(Uci::parseSpin("-3", 1, 256, &value));
+    CHECK(value == 1);
+    CHECK(Uci::parseSpin("99999999999999999999999", 1, 256, &value));
+    CHECK(value == 256);
+
+    value = 7;
+    CHECK(!Uci::parseSpin("four", 1, 256, &value));
+    CHECK(!Uci::parseSpin("4x", 1, 256, &value));
+    CHECK(!Uci::parseSpin("", 1, 256, &value));
+    CHECK(value == 7);
+
+    // A bad value is reported and the engine keeps going
+    std::istringstream in("setoption name Threads value four\n"
+                          "setoption name Hash value 16MB\n"
+                          "setoption name HashSnapshotDepth value deep\n"
+                          "setoption name SyzygyProbeDepth value one\n"
+                          "setoption name SyzygyProbeLimit value 6.5\n"
+                          "isready\nquit\n");
+    std::ostringstream out;
+    Uci::loop(in, out);
+
+    CHECK(out.str().find("info string Invalid value four for Threads") != std::string::npos);
+    CHECK(out.str().find("info string Invalid value 16MB for Hash") != std::string::npos);
+    CHECK(out.str().find("info string Invalid value deep for HashSnapshotDepth") != std::string::npos);
+    CHECK(out.str().find("info string Invalid value one for SyzygyProbeDepth") != std::string::npos);
+    CHECK(out.str().find("info string Invalid value 6.5 for SyzygyProbeLimit") != std::string::npos);
+    CHECK(out.str().find("readyok") != std::string::npos);
+}
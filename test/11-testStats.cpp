@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/stats.h"
+
+TEST_CASE("Stats - Merge and clear") {
+    SearchStats a, b;
+    a.nodes = 10;
+    a.betaCutoffs = 4;
+    a.firstMoveCutoffs = 3;
+    a.moveGenPieces[enumPiece::nKnight] = 2;
+    b.nodes = 5;
+    b.betaCutoffs = 4;
+    b.firstMoveCutoffs = 3;
+    b.moveGenPieces[enumPiece::nKnight] = 1;
+
+    a.merge(b);
+
+    CHECK(a.nodes == 15);
+    CHECK(a.moveGenPieces[enumPiece::nKnight] == 3);
+    CHECK(a.firstMoveCutoffRate() == 0.75);
+
+    a.clear();
+    CHECK(a.nodes == 0);
+    CHECK(a.firstMoveCutoffRate() == 0.0);
+}
+
+TEST_CASE("Stats - JSON dump") {
+    SearchStats stats;
+    stats.ttProbes = 7;
+
+    std::string json = stats.toJson();
+
+    CHECK(json.front() == '{');
+    CHECK(json.find("\"tt_probes\": 7") != std::string::npos);
+    CHECK(json.find("\"knight\": 0") != std::string::npos);
+}
+
+TEST_CASE("Stats - Counted by the search") {
+    CBoard board = CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    auto tt = std::make_unique<CTranspositionTable>(1);
+    auto search = std::make_unique<CSearch>(tt.get());
+
+    SearchLimits limits;
+    limits.depth = 5;
+
+    SearchResult result = search->search(board, limits);
+    const SearchStats &stats = search->getStats();
+
+    if (SearchStats::enabled()) {
+        CHECK(stats.nodes + stats.qnodes == result.nodes);
+        CHECK(stats.ttHits <= stats.ttProbes);
+        CHECK(stats.firstMoveCutoffs <= stats.betaCutoffs);
+        CHECK(stats.moveGenPieces[enumPiece::nKing] == stats.moveGenCalls);
+        CHECK(stats.evalCalls > 0);
+    } else {
+        CHECK(stats.nodes == 0);
+        CHECK(stats.evalCalls == 0);
+    }
+}
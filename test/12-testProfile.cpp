@@ -0,0 +1,47 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/profile.h"
+
+TEST_CASE("Profile - Report lists every phase") {
+    Profile::reset();
+
+    CBoard board = CBoard();
+    board.perft(2);
+
+    std::ostringstream out;
+    Profile::report(out);
+    std::string report = out.str();
+
+    for (auto name : Profile::PHASE_NAMES) CHECK(report.find(name) != std::string::npos);
+
+    // 20 moves at the root and 400 after them
+    bool counted = report.find(Profile::enabled() ? "movegen               21" : "movegen                0") != std::string::npos;
+    CHECK(counted);
+}
+
+TEST_CASE("Profile - Chrome trace") {
+    Profile::reset();
+    Profile::startTrace(16);
+
+    CBoard board = CBoard();
+    board.perft(2);
+
+    Profile::stopTrace();
+
+    std::string path = "profile_test_trace.json";
+    REQUIRE(Profile::writeChromeTrace(path));
+
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::remove(path.c_str());
+
+    CHECK(contents.str().rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+    CHECK((contents.str().find("\"ph\":\"X\"") != std::string::npos) == Profile::enabled());
+}
@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CPolyglotBook.h"
+#include "chessbot/constants.h"
+#include "chessbot/uci.h"
+
+struct RawBookEntry {
+    U64 key;
+    uint16_t move;
+    uint16_t weight;
+};
+
+// Files and rows count from a1, as in the Polyglot format
+uint16_t polyglotMove(int fromFile, int fromRow, int toFile, int toRow, int promotion = 0) {
+    return toFile | (toRow << 3) | (fromFile << 6) | (fromRow << 9) | (promotion << 12);
+}
+
+void writeBook(const std::string &path, std::vector<RawBookEntry> entries) {
+    std::sort(entries.begin(), entries.end(), [](auto &a, auto &b) { return a.key < b.key; });
+
+    std::ofstream out(path, std::ios::binary);
+
+    auto write = [&](U64 value, int bytes) {
+        for (int i = bytes - 1; i >= 0; --i) out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    };
+
+    for (auto &entry : entries) {
+        write(entry.key, 8);
+        write(entry.move, 2);
+        write(entry.weight, 2);
+        write(0, 4);
+    }
+}
+
+TEST_CASE("Polyglot - Reference keys") {
+    // Test positions from the Polyglot book format specification
+    CHECK(CPolyglotBook::computeKey(CBoard()) == 0x463b96181691fc9cULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1")) == 0x823c9b50fd114196ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2")) == 0x0756b94461c50fb0ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 2")) == 0x662fafb965db29d4ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3")) == 0x22a48b5a8e47ff78ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR b kq - 0 3")) == 0x652a607ca3f242c1ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbq1bnr/ppp1pkpp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR w - - 0 4")) == 0x00fdd303c946bdd9ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/p1pppppp/8/8/PpP4P/8/1P1PPPP1/RNBQKBNR b KQkq c3 0 3")) == 0x3c8123ea7b067637ULL);
+    CHECK(CPolyglotBook::computeKey(CBoard("rnbqkbnr/p1pppppp/8/8/P6P/R1p5/1P1PPPP1/1NBQKBNR b Kkq - 0 4")) == 0x5c3f9b829b279560ULL);
+}
+
+TEST_CASE("Polyglot - Key after moves") {
+    CBoard board = CBoard();
+    board.makeMove(Uci::parseMove(board, "e2e4"));
+    board.makeMove(Uci::parseMove(board, "d7d5"));
+
+    CHECK(CPolyglotBook::computeKey(board) == 0x0756b94461c50fb0ULL);
+}
+
+TEST_CASE("Polyglot - Book lookups") {
+    CBoard start = CBoard();
+    CBoard castle = CBoard("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1");
+    CBoard promote = CBoard("8/P6k/8/8/8/8/8/K7 w - - 0 1");
+    CBoard missing = CBoard("4k3/8/8/8/8/8/8/4K3 w - - 0 1");
+
+    std::string path = "polyglot_test_book.bin";
+    writeBook(path, {
+        { CPolyglotBook::computeKey(start), polyglotMove(4, 1, 4, 3), 10 },
+        { CPolyglotBook::computeKey(start), polyglotMove(3, 1, 3, 3), 30 },
+        { CPolyglotBook::computeKey(start), polyglotMove(6, 0, 5, 2), 5 },
+        // Not a legal move, skipped
+        { CPolyglotBook::computeKey(start), polyglotMove(4, 1, 4, 4), 100 },
+        { CPolyglotBook::computeKey(castle), polyglotMove(4, 0, 7, 0), 1 },
+        { CPolyglotBook::computeKey(castle), polyglotMove(4, 0, 0, 0), 1 },
+        { CPolyglotBook::computeKey(promote), polyglotMove(0, 6, 0, 7, 4), 1 },
+    });
+
+    CPolyglotBook book(path);
+    REQUIRE(book.isOpen());
+    CHECK(book.size() == 7);
+
+    CMove moves[CPolyglotBook::MAX_MOVES];
+    uint16_t weights[CPolyglotBook::MAX_MOVES];
+
+    CHECK(book.probe(start, moves, weights, CPolyglotBook::MAX_MOVES) == 3);
+    CHECK(Uci::moveToString(book.bestMove(start)) == "d2d4");
+    CHECK(book.bestMove(start).getFlags() == Constants::DOUBLE_PAWN_PUSH_FLAG);
+
+    // Weights 10, 30 and 5 in key order of the moves
+    CHECK(book.weightedMove(start, 0) == book.weightedMove(start, 45));
+
+    CHECK(book.probe(castle, moves, weights, CPolyglotBook::MAX_MOVES) == 2);
+    CHECK(((moves[0].getFlags() == Constants::KING_CASTLE_FLAG and moves[1].getFlags() == Constants::QUEEN_CASTLE_FLAG)
+        or (moves[1].getFlags() == Constants::KING_CASTLE_FLAG and moves[0].getFlags() == Constants::QUEEN_CASTLE_FLAG)));
+
+    CHECK(book.bestMove(promote).getFlags() == Constants::Q_PROMO_FLAG);
+    CHECK(book.bestMove(missing) == CMove());
+
+    book.close();
+    std::remove(path.c_str());
+
+    CHECK(!book.isOpen());
+    CHECK(book.bestMove(start) == CMove());
+    CHECK_THROWS_AS(CPolyglotBook("does_not_exist.bin"), std::invalid_argument);
+}
@@ -0,0 +1,270 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CSyzygy.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/constants.h"
+#include "chessbot/uci.h"
+
+// Synthetic tables holding a single value for each side to move, with the stronger side always winning
+// The header layout is the real one, so loading, key lookup and colour flipping are exercised without table files
+std::vector<unsigned char> singleValueTable(bool dtz, int pieceCount) {
+    std::vector<unsigned char> bytes;
+
+    if (dtz) bytes = { 0xD7, 0x66, 0x0C, 0xA5 };
+    else bytes = { 0x71, 0xE8, 0x23, 0x5D };
+
+    // Flags (split for WDL, no pawns) and group order
+    bytes.push_back(dtz ? 0x00 : 0x01);
+    bytes.push_back(0x00);
+
+    // Piece list, the values do not depend on it
+    for (int i = 0; i < pieceCount; ++i) bytes.push_back(0x66);
+
+    if (bytes.size() & 1) bytes.push_back(0);
+
+    if (dtz) {
+        // White to move, five moves to a capture or pawn move
+        bytes.insert(bytes.end(), { 0x80, 5 });
+    } else {
+        // Win for White to move, loss for Black to move
+        bytes.insert(bytes.end(), { 0x80, 4, 0x80, 0 });
+    }
+
+    bytes.resize(32, 0);
+
+    return bytes;
+}
+
+std::filesystem::path makeTableDirectory(const std::string &name, const std::vector<std::string> &tables) {
+    auto directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    for (auto &table : tables) {
+        bool dtz = table.ends_with(".rtbz");
+        int pieceCount = table.find('.') - 1;
+        auto bytes = singleValueTable(dtz, pieceCount);
+
+        std::ofstream out(directory / table, std::ios::binary);
+        out.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    }
+
+    return directory;
+}
+
+bool hasMove(const std::vector<CMove> &moves, const std::string &move) {
+    return std::any_of(moves.begin(), moves.end(), [&](CMove m) { return Uci::moveToString(m) == move; });
+}
+
+// Whether the side to move can capture anything
+bool hasCapture(CBoard &board) {
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+
+    return std::any_of(moves.begin(), moves.end(), [](CMove m) { return m.isCapture(); });
+}
+
+TEST_CASE("Syzygy - Missing and invalid tables") {
+    CSyzygy tablebases;
+
+    CHECK(tablebases.init("/does/not/exist") == 0);
+    CHECK(tablebases.maxPieces() == 0);
+
+    auto directory = std::filesystem::temp_directory_path() / "chessbot_syzygy_invalid";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory / "KQvK.rtbw") << "not a tablebase, just some text";
+    std::ofstream(directory / "KQvQ.rtbw") << "not a valid name";
+
+    CHECK(tablebases.init(directory.string()) == 0);
+
+    int wdl;
+    CBoard board = CBoard("4k3/8/8/8/8/8/8/4K2Q w - - 0 1");
+    CHECK(!tablebases.probeWdl(board, &wdl));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Syzygy - Results without tables") {
+    CSyzygy tablebases;
+    int wdl;
+
+    CBoard bare = CBoard("4k3/8/8/8/8/8/8/4K3 w - - 0 1");
+    REQUIRE(tablebases.probeWdl(bare, &wdl));
+    CHECK(wdl == wdlDraw);
+
+    // The only move captures the queen, so the KQvK table is not needed
+    CBoard capture = CBoard("7k/8/8/8/8/8/1q6/K7 w - - 0 1");
+    REQUIRE(tablebases.probeWdl(capture, &wdl));
+    CHECK(wdl == wdlDraw);
+
+    // Positions with castling rights are not in the tables
+    CBoard castling = CBoard("4k3/8/8/8/8/8/8/4K2R w K - 0 1");
+    CHECK(!tablebases.probeWdl(castling, &wdl));
+}
+
+TEST_CASE("Syzygy - Synthetic tables") {
+    auto directory = makeTableDirectory("chessbot_syzygy_synthetic", { "KQvK.rtbw", "KQvK.rtbz", "KRvK.rtbw" });
+
+    CSyzygy tablebases;
+    REQUIRE(tablebases.init(directory.string()) == 2);
+    CHECK(tablebases.maxPieces() == 3);
+
+    int wdl, dtz;
+
+    CBoard white = CBoard("4k3/8/8/8/8/8/8/4K2Q w - - 0 1");
+    REQUIRE(tablebases.probeWdl(white, &wdl));
+    CHECK(wdl == wdlWin);
+
+    REQUIRE(tablebases.probeDtz(white, &dtz));
+    CHECK(dtz == 11);
+
+    CBoard black = CBoard("4k3/8/8/8/8/8/8/4K2Q b - - 0 1");
+    REQUIRE(tablebases.probeWdl(black, &wdl));
+    CHECK(wdl == wdlLoss);
+
+    // The DTZ table only holds White to move, so Black's value comes from a search one ply deeper
+    REQUIRE(tablebases.probeDtz(black, &dtz));
+    CHECK(dtz == -12);
+
+    // Black holding the queen is looked up with the colours swapped
+    CBoard swapped = CBoard("4k2q/8/8/8/8/8/8/4K3 b - - 0 1");
+    REQUIRE(tablebases.probeWdl(swapped, &wdl));
+    CHECK(wdl == wdlWin);
+
+    // No DTZ table for KRvK
+    CBoard rook = CBoard("4k3/8/8/8/8/8/8/4K2R w - - 0 1");
+    REQUIRE(tablebases.probeWdl(rook, &wdl));
+    CHECK(wdl == wdlWin);
+    CHECK(!tablebases.probeDtz(rook, &dtz));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Syzygy - Root moves") {
+    auto directory = makeTableDirectory("chessbot_syzygy_root", { "KQvK.rtbw", "KQvK.rtbz" });
+
+    CSyzygy tablebases;
+    REQUIRE(tablebases.init(directory.string()) == 1);
+
+    CBoard board = CBoard("8/8/8/3k4/8/8/8/K6Q w - - 0 1");
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+    REQUIRE(hasMove(moves, "h1e4"));
+
+    std::vector<CMove> wdlMoves = moves;
+    int score;
+
+    // Moves which let the king take the queen are dropped
+    REQUIRE(tablebases.rootProbe(board, &moves, true, &score));
+    CHECK(score == Constants::TB_WIN_SCORE);
+    CHECK(!moves.empty());
+    CHECK(!hasMove(moves, "h1e4"));
+
+    for (auto move : moves) {
+        board.makeMove(move);
+        CHECK(!hasCapture(board));
+        board.unmakeMove(move);
+    }
+
+    REQUIRE(tablebases.rootProbeWdl(board, &wdlMoves, true, &score));
+    CHECK(score == Constants::TB_WIN_SCORE);
+    CHECK(wdlMoves.size() == moves.size());
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Syzygy - Search") {
+    // WDL only, so the tables are probed inside the tree as well as at the root
+    auto directory = makeTableDirectory("chessbot_syzygy_search", { "KQvK.rtbw", "KRvK.rtbw", "KQvKR.rtbw" });
+
+    CSyzygy tablebases;
+    REQUIRE(tablebases.init(directory.string()) == 3);
+
+    auto tt = std::make_unique<CTranspositionTable>(1);
+    auto search = std::make_unique<CSearch>(tt.get());
+
+    TablebaseConfig config;
+    config.tablebases = &tablebases;
+    search->setTablebases(config);
+
+    SearchLimits limits;
+    limits.depth = 5;
+
+    // The queen has to leave the d-file or be taken
+    CBoard board = CBoard("3rk3/8/8/8/8/8/8/3QK3 w - - 0 1");
+    SearchResult result = search->search(board, limits);
+
+    CHECK(result.score == Constants::TB_WIN_SCORE);
+    CHECK(search->getTbHits() > 0);
+
+    board.makeMove(result.bestMove);
+    CHECK(!hasCapture(board));
+    board.unmakeMove(result.bestMove);
+
+    // Without tablebases the search still works as before
+    search->setTablebases(TablebaseConfig());
+    search->search(board, limits);
+    CHECK(search->getTbHits() == 0);
+
+    std::filesystem::remove_all(directory);
+}
+
+// WDL and DTZ of a fixture position, from the side to move's view
+void checkFixture(const CSyzygy &tablebases, const std::string &fen, int expectedWdl, int expectedDtz) {
+    CAPTURE(fen);
+    CBoard board = CBoard(fen);
+    int wdl, dtz;
+
+    REQUIRE(tablebases.probeWdl(board, &wdl));
+    CHECK(wdl == expectedWdl);
+    REQUIRE(tablebases.probeDtz(board, &dtz));
+    CHECK(dtz == expectedDtz);
+}
+
+TEST_CASE("Syzygy - Fixture tables") {
+    CSyzygy tablebases;
+
+    REQUIRE(tablebases.init(CHESSBOT_SYZYGY_FIXTURES) == 5);
+    CHECK(tablebases.maxPieces() == 3);
+
+    // KQvK, the DTZ table holds White to move and maps to moves
+    checkFixture(tablebases, "k7/8/1K6/8/8/8/7Q/8 w - - 0 1", wdlWin, 1);
+    checkFixture(tablebases, "4k3/8/8/8/8/8/8/4K2Q b - - 0 1", wdlLoss, -16);
+    checkFixture(tablebases, "8/8/8/5k2/8/8/1Q6/K7 w - - 0 1", wdlWin, 19);
+    checkFixture(tablebases, "8/8/8/8/4k3/8/1Q6/K7 b - - 0 1", wdlLoss, -20);
+
+    // KRvK, the DTZ table holds Black to move with a 16 bit map in plies
+    checkFixture(tablebases, "4k3/8/8/8/8/8/8/R3K3 b - - 0 1", wdlLoss, -28);
+    checkFixture(tablebases, "8/8/8/8/8/2k5/1R6/K7 w - - 0 1", wdlWin, 31);
+    checkFixture(tablebases, "8/8/8/8/8/8/1Rk5/K7 b - - 0 1", wdlLoss, -32);
+    checkFixture(tablebases, "8/8/8/8/8/8/2kR4/K7 b - - 0 1", wdlDraw, 0);
+
+    // KPvK, split by the pawn's file, the pawn on the g-file is mirrored onto the b-file
+    checkFixture(tablebases, "4k3/8/4K3/4P3/8/8/8/8 w - - 0 1", wdlWin, 3);
+    checkFixture(tablebases, "4k3/8/4K3/4P3/8/8/8/8 b - - 0 1", wdlLoss, -4);
+    checkFixture(tablebases, "4k3/8/8/4P3/4K3/8/8/8 w - - 0 1", wdlDraw, 0);
+    checkFixture(tablebases, "8/8/8/8/8/k7/P7/K7 w - - 0 1", wdlDraw, 0);
+    checkFixture(tablebases, "8/8/8/1k6/8/8/K5P1/8 w - - 0 1", wdlWin, 19);
+    checkFixture(tablebases, "8/8/8/7k/8/7K/1P6/8 b - - 0 1", wdlLoss, -20);
+
+    // Black holding the pawn is looked up with the colours swapped and the board flipped
+    checkFixture(tablebases, "8/k5p1/8/8/1K6/8/8/8 b - - 0 1", wdlWin, 19);
+    checkFixture(tablebases, "8/1p6/7k/8/7K/8/8/8 w - - 0 1", wdlLoss, -20);
+
+    // Promoting wins at once, the underpromotions need the minor piece tables
+    checkFixture(tablebases, "8/P7/8/4k3/8/8/8/K7 w - - 0 1", wdlWin, 1);
+    checkFixture(tablebases, "4k3/8/8/8/8/8/8/2B1K3 w - - 0 1", wdlDraw, 0);
+
+    // Stalemate is a draw whatever the material
+    checkFixture(tablebases, "7k/5Q2/6K1/8/8/8/8/8 b - - 0 1", wdlDraw, 0);
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/position.h"
+#include "chessbot/uci.h"
+
+// Reference node counts from https://www.chessprogramming.org/Perft_Results
+
+TEST_CASE("Position - Layout") {
+    CHECK(std::is_trivially_copyable_v<Position>);
+    CHECK(sizeof(Position) <= 128);
+    CHECK(alignof(Position) == 64);
+}
+
+TEST_CASE("Position - Perft") {
+    CHECK(Position(CBoard()).perft(4) == 197281);
+    CHECK(Position(CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1")).perft(3) == 97862);
+    CHECK(Position(CBoard("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1")).perft(5) == 674624);
+    CHECK(Position(CBoard("r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1")).perft(4) == 422333);
+    CHECK(Position(CBoard("rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8")).perft(3) == 62379);
+}
+
+TEST_CASE("Position - Parallel perft") {
+    Position position(CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    CHECK(position.perftParallel(3, 4) == 97862);
+    CHECK(position.perftParallel(1, 4) == 48);
+}
+
+TEST_CASE("Position - Copy-make matches make and unmake") {
+    CBoard board = CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    Position position(board);
+
+    std::vector<CMove> boardMoves, positionMoves;
+    board.generateLegalMoves(&boardMoves);
+    position.generateLegalMoves(&positionMoves);
+
+    REQUIRE(boardMoves.size() == positionMoves.size());
+
+    for (auto move : boardMoves) {
+        CHECK(std::find(positionMoves.begin(), positionMoves.end(), move) != positionMoves.end());
+
+        Position next = position;
+        next.makeMove(move);
+        board.makeMove(move);
+
+        CHECK(next.key == board.getKey());
+        CHECK(next.castling == board.getCastleState());
+        CHECK(next.enPassant == board.getEnPassantSquare());
+        CHECK(next.halfmoves == board.getHalfmoves());
+        CHECK(next.isInCheck() == board.isInCheck());
+
+        for (int piece = enumPiece::nWhite; piece <= enumPiece::nKing; ++piece) {
+            CHECK(next.pieceBB[piece] == board.getPieceSet(static_cast<enumPiece>(piece)));
+        }
+
+        board.unmakeMove(move);
+    }
+
+    // The original is untouched
+    CHECK(position.key == board.getKey());
+}
+
+TEST_CASE("Position - En passant key") {
+    CBoard board = CBoard("4k3/8/8/8/5p2/8/4P3/4K3 w - - 0 1");
+    Position position(board);
+
+    CMove push = Uci::parseMove(board, "e2e4");
+    board.makeMove(push);
+    position.makeMove(push);
+
+    CHECK(position.enPassant == enumSquare::e3);
+    CHECK(position.key == board.getKey());
+}
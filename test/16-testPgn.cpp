@@ -0,0 +1,240 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CPgnReader.h"
+#include "chessbot/pgn.h"
+#include "chessbot/uci.h"
+
+static const std::string PGN_GAMES =
+    "[Event \"First\"]\n"
+    "[White \"A \\\"Quoted\\\" Player\"]\n"
+    "[Result \"0-1\"]\n"
+    "\n"
+    "1. f3 {weak} e5 2. g4?? (2. e4 Qh4+ 3. g3) $4 Qh4# 0-1\n"
+    "\n"
+    "[Event \"Malformed\"]\n"
+    "[Result \"*\"]\n"
+    "\n"
+    "1. e4 e5 2. Ke3 *\n"
+    "\n"
+    "[Event \"From FEN\"]\n"
+    "[SetUp \"1\"]\n"
+    "[FEN \"4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 2\"]\n"
+    "[Result \"1-0\"]\n"
+    "\n"
+    "2.exd6 Kd7 3.Kd2\n"
+    "; rest of the game\n"
+    "3...Kxd6 1-0\n";
+
+static std::string writePgnFile(const std::string &name, const std::string &contents) {
+    auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream(path, std::ios::binary) << contents;
+
+    return path;
+}
+
+TEST_CASE("Pgn - Parse SAN") {
+    CBoard board = CBoard();
+    CHECK(Pgn::parseSan(board, "e4") == Uci::parseMove(board, "e2e4"));
+    CHECK(Pgn::parseSan(board, "Nf3") == Uci::parseMove(board, "g1f3"));
+    CHECK_THROWS_AS(Pgn::parseSan(board, "e5"), std::invalid_argument);
+    CHECK_THROWS_AS(Pgn::parseSan(board, "Nf4"), std::invalid_argument);
+    CHECK_THROWS_AS(Pgn::parseSan(board, "z9"), std::invalid_argument);
+
+    board = CBoard("4k3/8/8/8/8/8/8/1N2KN2 w - - 0 1");
+    CHECK(Pgn::parseSan(board, "Nbd2") == Uci::parseMove(board, "b1d2"));
+    CHECK(Pgn::parseSan(board, "Nfd2") == Uci::parseMove(board, "f1d2"));
+    CHECK_THROWS_AS(Pgn::parseSan(board, "Nd2"), std::invalid_argument);
+
+    board = CBoard("1k6/8/8/8/4Q2Q/8/8/K6Q w - - 0 1");
+    CHECK(Pgn::parseSan(board, "Qh4e1") == Uci::parseMove(board, "h4e1"));
+    CHECK(Pgn::parseSan(board, "Qh4xe1!?") == Uci::parseMove(board, "h4e1"));
+
+    board = CBoard("4k3/4P3/8/8/8/8/8/4K2R w K - 0 1");
+    CHECK(Pgn::parseSan(board, "O-O") == Uci::parseMove(board, "e1g1"));
+    CHECK(Pgn::parseSan(board, "0-0+") == Uci::parseMove(board, "e1g1"));
+    CHECK_THROWS_AS(Pgn::parseSan(board, "O-O-O"), std::invalid_argument);
+
+    board = CBoard("3rk3/2P5/8/8/8/8/8/4K3 w - - 0 1");
+    CHECK(Pgn::parseSan(board, "c8=Q+") == Uci::parseMove(board, "c7c8q"));
+    CHECK(Pgn::parseSan(board, "c8N") == Uci::parseMove(board, "c7c8n"));
+    CHECK(Pgn::parseSan(board, "cxd8=R+") == Uci::parseMove(board, "c7d8r"));
+    CHECK_THROWS_AS(Pgn::parseSan(board, "c8"), std::invalid_argument);
+
+    board = CBoard("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 2");
+    CHECK(Pgn::parseSan(board, "exd6") == Uci::parseMove(board, "e5d6"));
+}
+
+TEST_CASE("Pgn - Move to SAN") {
+    CBoard board = CBoard("4k3/8/8/R7/8/8/8/R3K3 w - - 0 1");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "a1a3")) == "R1a3");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "a5a8")) == "Ra8+");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "e1d1")) == "Kd1");
+
+    board = CBoard("1k6/8/8/8/4Q2Q/8/8/K6Q w - - 0 1");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "h4e1")) == "Qh4e1");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "e4e1")) == "Qee1");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "h1e1")) == "Q1e1");
+
+    board = CBoard("rnbqkbnr/pppp1ppp/8/4p3/6P1/5P2/PPPPP2P/RNBQKBNR b KQkq g3 0 2");
+    CHECK(Pgn::moveToSan(&board, Uci::parseMove(board, "d8h4")) == "Qh4#");
+    CHECK(Pgn::moveToSan(&board, CMove()) == "--");
+
+    // Every legal move survives the round trip
+    for (std::string fen : { "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                             "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                             "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1" }) {
+        board = CBoard(fen);
+        std::vector<CMove> moves;
+        board.generateLegalMoves(&moves);
+
+        for (auto move : moves) CHECK(Pgn::parseSan(board, Pgn::moveToSan(&board, move)) == move);
+    }
+}
+
+TEST_CASE("Pgn - Movetext") {
+    CBoard board = CBoard();
+    std::vector<CMove> moves;
+
+    Pgn::parseMovetext("1.e4 {comment (with brackets)} 1... e5 $1 (1... c5 2. Nf3 (2. c3)) 2. Nf3 ; to the end\n Nc6 1/2-1/2 Nf6", &board, &moves);
+
+    REQUIRE(moves.size() == 4);
+    CHECK(Uci::moveToString(moves[3]) == "b8c6");
+    CHECK(board.getFullmoves() == 3);
+
+    board = CBoard();
+    moves.clear();
+    CHECK_THROWS_AS(Pgn::parseMovetext("1. e4 {unterminated", &board, &moves), std::invalid_argument);
+
+    board = CBoard();
+    moves.clear();
+    CHECK_THROWS_AS(Pgn::parseMovetext("1. e4 (1. d4", &board, &moves), std::invalid_argument);
+}
+
+TEST_CASE("Pgn - Write game") {
+    CBoard board = CBoard();
+    std::vector<CMove> moves;
+    Pgn::parseMovetext("1. f3 e5 2. g4 Qh4#", &board, &moves);
+
+    board = CBoard();
+    std::string pgn;
+    Pgn::writeGame({ { "Event", "Say \"hi\"" }, { "Result", "0-1" } }, moves, &board, &pgn);
+
+    CHECK(pgn == "[Event \"Say \\\"hi\\\"\"]\n[Result \"0-1\"]\n\n1. f3 e5 2. g4 Qh4# 0-1\n\n");
+    CHECK(board.getKey() == CBoard().getKey());
+
+    // Starting with Black to move
+    board = CBoard("4k3/8/8/8/8/8/4P3/4K3 b - - 0 10");
+    moves = { Uci::parseMove(board, "e8d7") };
+    pgn.clear();
+    Pgn::writeGame({}, moves, &board, &pgn);
+
+    CHECK(pgn == "\n10... Kd7 *\n\n");
+
+    // Long games are wrapped below 80 columns and read back the same
+    board = CBoard();
+    moves.clear();
+    for (int i = 0; i < 20; ++i) {
+        for (std::string move : { "g1f3", "g8f6", "f3g1", "f6g8" }) {
+            moves.push_back(Uci::parseMove(board, move));
+            board.makeMove(moves.back());
+        }
+    }
+
+    board = CBoard();
+    pgn.clear();
+    Pgn::writeGame({ { "Result", "1/2-1/2" } }, moves, &board, &pgn);
+
+    std::size_t line = 0;
+    while (line < pgn.size()) {
+        std::size_t end = pgn.find('\n', line);
+        CHECK(end - line < 80);
+        line = end + 1;
+    }
+
+    PgnGame game;
+    game.movetext = std::string_view(pgn).substr(pgn.find("\n\n") + 2);
+    std::vector<CMove> parsed;
+    REQUIRE(CPgnReader::parseGame(game, &board, &parsed));
+    CHECK(parsed == moves);
+}
+
+TEST_CASE("Pgn - Read games") {
+    auto path = writePgnFile("chessbot_games.pgn", PGN_GAMES);
+    CPgnReader reader(path);
+    PgnGame game;
+    CBoard board = CBoard();
+    std::vector<CMove> moves;
+
+    REQUIRE(reader.nextGame(&game));
+    CHECK(game.tag("Event") == "First");
+    CHECK(game.tag("White") == "A \\\"Quoted\\\" Player");
+    CHECK(game.tag("Black").empty());
+    CHECK(game.offset == 0);
+    REQUIRE(CPgnReader::parseGame(game, &board, &moves));
+    CHECK(moves.size() == 4);
+    CHECK(board.isInCheck());
+
+    REQUIRE(reader.nextGame(&game));
+    CHECK(game.tag("Event") == "Malformed");
+    CHECK_FALSE(CPgnReader::parseGame(game, &board, &moves));
+
+    REQUIRE(reader.nextGame(&game));
+    CHECK(game.tag("FEN") == "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 2");
+    REQUIRE(CPgnReader::parseGame(game, &board, &moves));
+    CHECK(moves.size() == 4);
+    CHECK(board.getPieceSet(enumPiece::nPawn) == 0);
+
+    CHECK_FALSE(reader.nextGame(&game));
+
+    reader.rewind();
+    CHECK(reader.nextGame(&game));
+    CHECK(game.tag("Event") == "First");
+
+    CHECK_THROWS_AS(CPgnReader("/nonexistent/games.pgn"), std::invalid_argument);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Pgn - Parallel reading") {
+    std::string contents;
+    for (int i = 0; i < 100; ++i) contents += PGN_GAMES + "\n";
+
+    auto path = writePgnFile("chessbot_many_games.pgn", contents);
+    CPgnReader reader(path);
+
+    for (int threads : { 1, 3, 8 }) {
+        std::atomic<int> fromFen = 0;
+
+        PgnStats stats = reader.forEachGame([&](const PgnGame &game, const std::vector<CMove> &moves, CBoard *board) {
+            // The board is at the starting position
+            if (!game.tag("FEN").empty()) ++fromFen;
+            board->makeMove(moves[0]);
+        }, threads);
+
+        CHECK(stats.games == 200);
+        CHECK(stats.malformed == 100);
+        CHECK(stats.moves == 800);
+        CHECK(stats.bytes == contents.size());
+        CHECK(fromFen == 100);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Pgn - Empty file") {
+    auto path = writePgnFile("chessbot_empty.pgn", "");
+    CPgnReader reader(path);
+    PgnGame game;
+
+    CHECK_FALSE(reader.nextGame(&game));
+    CHECK(reader.forEachGame([](const PgnGame &, const std::vector<CMove> &, CBoard *) {}, 4).games == 0);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CMove.h"
+#include "chessbot/constants.h"
+
+TEST_CASE("Move strings - UCI") {
+    char buffer[CMove::UCI_BUFFER_SIZE];
+
+    CHECK(CMove(enumSquare::e2, enumSquare::e4, Constants::DOUBLE_PAWN_PUSH_FLAG).toUci(buffer) == 4);
+    CHECK(std::string(buffer) == "e2e4");
+
+    CHECK(CMove(enumSquare::b7, enumSquare::a8, Constants::N_PROMO_CAPTURE_FLAG + 3).toUci(buffer) == 5);
+    CHECK(std::string(buffer) == "b7a8q");
+
+    CHECK(CMove().toUci(buffer) == 4);
+    CHECK(std::string(buffer) == "0000");
+
+    CBoard board = CBoard("3rk3/2P5/8/8/8/8/8/4K2R w K - 0 1");
+    CHECK(CMove::fromUci(board, "e1g1") == CMove(enumSquare::e1, enumSquare::g1, Constants::KING_CASTLE_FLAG));
+    CHECK(CMove::fromUci(board, "c7d8n") == CMove(enumSquare::c7, enumSquare::d8, Constants::N_PROMO_CAPTURE_FLAG));
+    CHECK(CMove::fromUci(board, "c7c8r") == CMove(enumSquare::c7, enumSquare::c8, Constants::N_PROMO_FLAG + 2));
+
+    CHECK_THROWS_AS(CMove::fromUci(board, "c7c8"), std::invalid_argument);
+    CHECK_THROWS_AS(CMove::fromUci(board, "c7c8k"), std::invalid_argument);
+    CHECK_THROWS_AS(CMove::fromUci(board, "e1e3"), std::invalid_argument);
+    CHECK_THROWS_AS(CMove::fromUci(board, "i1e3"), std::invalid_argument);
+    CHECK_THROWS_AS(CMove::fromUci(board, "e1"), std::invalid_argument);
+}
+
+TEST_CASE("Move strings - SAN") {
+    char buffer[CMove::SAN_BUFFER_SIZE];
+
+    CBoard board = CBoard("3rk3/2P5/8/8/8/8/8/4K2R w K - 0 1");
+    CMove promotion = CMove::fromSan(board, "cxd8=Q#");
+    CHECK(promotion == CMove(enumSquare::c7, enumSquare::d8, Constants::N_PROMO_CAPTURE_FLAG + 3));
+    CHECK(promotion.toSan(&board, buffer) == 7);
+    CHECK(std::string(buffer) == "cxd8=Q+");
+
+    CHECK(CMove::fromSan(board, "O-O").toSan(&board, buffer) == 3);
+    CHECK(std::string(buffer) == "O-O");
+
+    CHECK(CMove().toSan(&board, buffer) == 2);
+    CHECK(std::string(buffer) == "--");
+
+    // Mate needs the reply check, which leaves the board as it was
+    board = CBoard("6k1/5ppp/8/8/8/8/8/R3K3 w Q - 0 1");
+    U64 key = board.getKey();
+    CHECK(CMove::fromSan(board, "Ra8").toSan(&board, buffer) == 4);
+    CHECK(std::string(buffer) == "Ra8#");
+    CHECK(CMove::fromSan(board, "O-O-O").toSan(&board, buffer) == 5);
+    CHECK(std::string(buffer) == "O-O-O");
+    CHECK(board.getKey() == key);
+
+    // Disambiguation only counts pieces which can legally move there
+    board = CBoard("4k3/8/8/b7/8/2N5/8/4K1N1 w - - 0 1");
+    CHECK(CMove::fromSan(board, "Ne2") == CMove(enumSquare::g1, enumSquare::e2, Constants::QUIET_FLAG));
+    CHECK(CMove(enumSquare::g1, enumSquare::e2, Constants::QUIET_FLAG).toSan(&board, buffer) == 3);
+    CHECK(std::string(buffer) == "Ne2");
+
+    CHECK_THROWS_AS(CMove::fromSan(board, "Nce2"), std::invalid_argument);
+    CHECK_THROWS_AS(CMove::fromSan(board, ""), std::invalid_argument);
+    CHECK_THROWS_AS(CMove::fromSan(board, "Pe4"), std::invalid_argument);
+}
+
+TEST_CASE("Move strings - Perft round trip") {
+    // Every move of a short perft tree converts both ways
+    CBoard board = CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    char uci[CMove::UCI_BUFFER_SIZE];
+    char san[CMove::SAN_BUFFER_SIZE];
+
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+
+    for (auto move : moves) {
+        board.makeMove(move);
+
+        std::vector<CMove> replies;
+        board.generateLegalMoves(&replies);
+
+        for (auto reply : replies) {
+            std::size_t sanLength = reply.toSan(&board, san);
+            CHECK(sanLength == std::strlen(san));
+            CHECK(sanLength < CMove::SAN_BUFFER_SIZE);
+            CHECK(CMove::fromSan(board, san) == reply);
+
+            reply.toUci(uci);
+            CHECK(CMove::fromUci(board, uci) == reply);
+        }
+
+        board.unmakeMove(move);
+    }
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/constants.h"
+
+static const std::vector<std::string> GEN_TYPE_POSITIONS = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+};
+
+static std::vector<unsigned int> sortedMoves(const std::vector<CMove> &moves) {
+    std::vector<unsigned int> keys;
+
+    for (auto move : moves) keys.push_back(move.getFrom() << 10 | move.getTo() << 4 | move.getFlags());
+    std::sort(keys.begin(), keys.end());
+
+    return keys;
+}
+
+static std::vector<CMove> legalOnly(const CBoard &board, const std::vector<CMove> &moves) {
+    std::vector<CMove> legal;
+    std::copy_if(moves.begin(), moves.end(), std::back_inserter(legal), [&](CMove move) { return board.isLegal(move); });
+    return legal;
+}
+
+// Checks every node of the tree to depth, returns the number of nodes in check
+static int checkGenTypes(CBoard *board, int depth) {
+    std::vector<CMove> all, captures, quiets;
+    board->generateMoves<genAll>(&all);
+    board->generateMoves<genCaptures>(&captures);
+    board->generateMoves<genQuiets>(&quiets);
+
+    // Captures and quiets split the pseudo-legal moves without overlap
+    std::vector<CMove> both = captures;
+    both.insert(both.end(), quiets.begin(), quiets.end());
+    CHECK(sortedMoves(both) == sortedMoves(all));
+
+    for (auto move : captures) CHECK((move.isCapture() or (move.getFlags() & Constants::PROMO_FLAG_MASK)));
+
+    int checks = 0;
+
+    if (board->isInCheck()) {
+        std::vector<CMove> evasions;
+        board->generateMoves<genEvasions>(&evasions);
+
+        CHECK(evasions.size() <= all.size());
+        CHECK(sortedMoves(legalOnly(*board, evasions)) == sortedMoves(legalOnly(*board, all)));
+        ++checks;
+    }
+
+    if (depth == 0) return checks;
+
+    for (auto move : legalOnly(*board, all)) {
+        board->makeMove(move);
+        checks += checkGenTypes(board, depth - 1);
+        board->unmakeMove(move);
+    }
+
+    return checks;
+}
+
+TEST_CASE("Move generation types - Partition and evasions") {
+    int checks = 0;
+
+    for (const auto &fen : GEN_TYPE_POSITIONS) {
+        CBoard board(fen);
+        U64 key = board.getKey();
+
+        checks += checkGenTypes(&board, 2);
+        CHECK(board.getKey() == key);
+    }
+
+    // The tree must actually exercise evasions
+    CHECK(checks > 100);
+}
+
+TEST_CASE("Move generation types - Evasions") {
+    std::vector<CMove> evasions;
+
+    SECTION("Double check leaves only king moves") {
+        CBoard board("4k3/4r3/8/8/8/5n2/8/R3K2R w KQ - 0 1");
+        REQUIRE(Bitboard::moreThanOne(board.getCheckers()));
+
+        board.generateMoves<genEvasions>(&evasions);
+        for (auto move : evasions) CHECK(move.getFrom() == enumSquare::e1);
+        CHECK(legalOnly(board, evasions).size() == 3);
+    }
+
+    SECTION("Blocking and capturing a slider") {
+        CBoard board("4k3/8/8/8/r6K/8/1N6/2B5 w - - 0 1");
+
+        board.generateMoves<genEvasions>(&evasions);
+        std::vector<CMove> legal = legalOnly(board, evasions);
+
+        CHECK(std::count(legal.begin(), legal.end(), CMove(enumSquare::b2, enumSquare::a4, Constants::CAPTURE_FLAG)) == 1);
+        CHECK(std::count(legal.begin(), legal.end(), CMove(enumSquare::c1, enumSquare::e3, Constants::QUIET_FLAG)) == 0);
+        CHECK(std::count(legal.begin(), legal.end(), CMove(enumSquare::b2, enumSquare::c4, Constants::QUIET_FLAG)) == 1);
+        CHECK(std::count(legal.begin(), legal.end(), CMove(enumSquare::b2, enumSquare::d3, Constants::QUIET_FLAG)) == 0);
+    }
+
+    SECTION("En passant removes a checking pawn") {
+        CBoard board("8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1");
+
+        board.generateMoves<genEvasions>(&evasions);
+        std::vector<CMove> legal = legalOnly(board, evasions);
+
+        CHECK(std::count(legal.begin(), legal.end(), CMove(enumSquare::e4, enumSquare::d3, Constants::EP_CAPTURE_FLAG)) == 1);
+    }
+
+    SECTION("Castling is never an evasion") {
+        CBoard board("4k3/8/8/8/8/8/4q3/R3K2R w KQ - 0 1");
+
+        board.generateMoves<genEvasions>(&evasions);
+        for (auto move : evasions) CHECK(move.getFlags() != Constants::KING_CASTLE_FLAG);
+        for (auto move : evasions) CHECK(move.getFlags() != Constants::QUEEN_CASTLE_FLAG);
+    }
+}
@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CEngineClient.h"
+#include "chessbot/CEngineService.h"
+#include "chessbot/loadgen.h"
+#include "chessbot/stats.h"
+
+static std::string serviceSocketPath() {
+    return "/tmp/chessbot-test-" + std::to_string(getpid()) + ".sock";
+}
+
+static bool isLegalBestMove(const std::string &line, const std::string &fen) {
+    CBoard board(fen);
+    std::string move = line.substr(std::string("bestmove ").size());
+
+    try {
+        CMove::fromUci(board, move);
+    } catch (const std::invalid_argument &) {
+        return false;
+    }
+
+    return true;
+}
+
+TEST_CASE("Engine service - Latency histogram") {
+    LatencyHistogram latency;
+    CHECK(latency.percentile(0.5) == 0);
+
+    for (U64 micros = 1; micros <= 1000; ++micros) latency.record(micros);
+
+    CHECK(latency.count == 1000);
+    CHECK(latency.max == 1000);
+    CHECK(latency.percentile(1.0) == 1000);
+    CHECK(latency.mean() == 500.5);
+
+    // Within a sixteenth of the exact value
+    CHECK(latency.percentile(0.5) <= 500);
+    CHECK(latency.percentile(0.5) >= 500 - 500 / 16);
+    CHECK(latency.percentile(0.99) <= 990);
+    CHECK(latency.percentile(0.99) >= 990 - 990 / 16);
+
+    for (U64 micros : { 0ULL, 15ULL, 16ULL, 17ULL, 1000ULL, 123456789ULL, ~0ULL }) {
+        U64 lower = LatencyHistogram::lowerBound(LatencyHistogram::bucketOf(micros));
+        CHECK(lower <= micros);
+        CHECK(micros - lower <= micros / 16);
+    }
+
+    LatencyHistogram other;
+    other.record(5000);
+    latency.merge(other);
+
+    CHECK(latency.count == 1001);
+    CHECK(latency.max == 5000);
+}
+
+TEST_CASE("Engine service - Sessions") {
+    ServiceConfig config;
+    config.socketPath = serviceSocketPath();
+    config.workers = 2;
+    config.hashMegabytes = 4;
+    config.maxSessions = 3;
+    config.defaultMovetime = 60000;
+
+    CEngineService service(config);
+    REQUIRE(service.start());
+
+    CEngineClient client(config.socketPath);
+    std::vector<std::string> lines;
+
+    SECTION("Search") {
+        REQUIRE(client.request("isready\n", "readyok", &lines));
+        CHECK(lines.back() == "readyok");
+
+        lines.clear();
+        REQUIRE(client.request("position startpos moves e2e4 e7e5\ngo depth 3\n", "bestmove", &lines));
+        REQUIRE(lines.size() == 2);
+        CHECK(lines[0].starts_with("info depth 3 "));
+        CHECK(isLegalBestMove(lines[1], "rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 2"));
+
+        lines.clear();
+        REQUIRE(client.request("latency\n", "latency", &lines));
+        CHECK(lines.back().starts_with("latency count 1 "));
+        CHECK(service.getLatency().count == 1);
+    }
+
+    SECTION("Invalid commands keep the previous position") {
+        REQUIRE(client.request("position fen rnbqkbnr/pppppppp w KQkq - 0 1\n", "info string", &lines));
+        REQUIRE(client.request("position startpos moves e2e5\n", "info string", &lines));
+        REQUIRE(client.request("frobnicate\n", "info string", &lines));
+        CHECK(lines.back() == "info string Unknown command frobnicate");
+
+        lines.clear();
+        REQUIRE(client.request("go nodes 1000\n", "bestmove", &lines));
+        CHECK(isLegalBestMove(lines.back(), "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    }
+
+    SECTION("Stop ends an unbounded search") {
+        auto start = std::chrono::steady_clock::now();
+
+        REQUIRE(client.send("position startpos\ngo infinite\n"));
+        REQUIRE(client.request("go depth 1\n", "info string", &lines));
+        CHECK(lines.back() == "info string Search already in progress");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        lines.clear();
+        REQUIRE(client.request("stop\n", "bestmove", &lines));
+        CHECK(isLegalBestMove(lines.back(), "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(30));
+    }
+
+    SECTION("Stop before the search starts") {
+        auto start = std::chrono::steady_clock::now();
+        CEngineClient second(config.socketPath), third(config.socketPath);
+
+        // Both workers busy, the round trip makes sure each go has been queued
+        REQUIRE(second.send("position startpos\ngo infinite\n"));
+        REQUIRE(second.request("isready\n", "readyok", &lines));
+        REQUIRE(third.send("position startpos\ngo infinite\n"));
+        REQUIRE(third.request("isready\n", "readyok", &lines));
+
+        // Stopped while it waits, so its search ends as soon as a worker takes it
+        REQUIRE(client.send("position startpos\ngo infinite\nstop\n"));
+        REQUIRE(client.request("isready\n", "readyok", &lines));
+        REQUIRE(second.request("stop\n", "bestmove", &lines));
+
+        lines.clear();
+        REQUIRE(client.request("", "bestmove", &lines));
+        CHECK(lines.front().starts_with("info depth 0 "));
+        CHECK(isLegalBestMove(lines.back(), "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+
+        REQUIRE(third.request("stop\n", "bestmove", &lines));
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(30));
+    }
+
+    SECTION("Concurrent sessions") {
+        CEngineClient other(config.socketPath);
+
+        REQUIRE(client.send("position startpos\ngo nodes 20000\n"));
+        REQUIRE(other.send("position fen 8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1\ngo nodes 20000\n"));
+
+        std::vector<std::string> otherLines;
+        REQUIRE(client.request("", "bestmove", &lines));
+        REQUIRE(other.request("", "bestmove", &otherLines));
+
+        CHECK(isLegalBestMove(lines.back(), "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+        CHECK(isLegalBestMove(otherLines.back(), "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+        CHECK(service.getLatency().count == 2);
+    }
+
+    SECTION("Session limit") {
+        CEngineClient second(config.socketPath), third(config.socketPath);
+        REQUIRE(second.request("isready\n", "readyok", &lines));
+        REQUIRE(third.request("isready\n", "readyok", &lines));
+        CHECK(service.getSessionCount() == 3);
+
+        CEngineClient fourth(config.socketPath);
+        std::string line;
+        REQUIRE(fourth.readLine(&line));
+        CHECK(line == "info string Too many sessions");
+        CHECK(!fourth.readLine(&line));
+
+        // Leaving makes room for another session
+        third.send("quit\n");
+        CHECK(!third.readLine(&line));
+
+        CEngineClient fifth(config.socketPath);
+        CHECK(fifth.request("isready\n", "readyok", &lines));
+    }
+
+    SECTION("Load generator") {
+        LoadGen::LoadConfig load;
+        load.socketPath = config.socketPath;
+        load.clients = 2;
+        load.requests = 5;
+        load.nodes = 2000;
+
+        LoadGen::LoadReport report = LoadGen::run(load);
+
+        CHECK(report.requests == 10);
+        CHECK(report.errors == 0);
+        CHECK(report.latency.count == 10);
+        CHECK(service.getLatency().count == 10);
+    }
+
+    service.stop();
+    CHECK(access(config.socketPath.c_str(), F_OK) != 0);
+}
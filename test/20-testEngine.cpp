@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chessbot/CBoard.h"
+#include "chessbot/CEngine.h"
+
+static bool isLegalMove(const CBoard &board, CMove move) {
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+
+    return std::find(moves.begin(), moves.end(), move) != moves.end();
+}
+
+static SearchLimits depthLimit(int depth) {
+    SearchLimits limits;
+    limits.depth = depth;
+    return limits;
+}
+
+TEST_CASE("Engine - Future") {
+    CEngine engine;
+    CBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+    std::future<SearchResult> future = engine.search(board, depthLimit(4));
+
+    // The search has its own copy of the board
+    board.makeMove(CMove::fromUci(board, "e2a6"));
+
+    SearchResult result = future.get();
+    CHECK(result.depth == 4);
+    CHECK(isLegalMove(CBoard("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"), result.bestMove));
+}
+
+TEST_CASE("Engine - Callbacks stream the principal variation") {
+    CEngine engine;
+    CBoard board;
+
+    std::vector<SearchInfo> infos;
+    SearchResult callbackResult = { CMove(), 0, 0, 0 };
+    std::thread::id callbackThread;
+
+    SearchResult result = engine.search(board, depthLimit(5), CCancelToken(),
+        [&](const SearchInfo &info) { infos.push_back(info); },
+        [&](const SearchResult &done) {
+            callbackResult = done;
+            callbackThread = std::this_thread::get_id();
+        }).get();
+
+    REQUIRE(infos.size() == 5);
+    for (int i = 0; i < 5; ++i) CHECK(infos[i].depth == i + 1);
+    CHECK(!infos.back().pv.empty());
+    CHECK(infos.back().pv.front() == result.bestMove);
+
+    CHECK(callbackResult.bestMove == result.bestMove);
+    CHECK(callbackThread != std::this_thread::get_id());
+}
+
+TEST_CASE("Engine - Cancellation") {
+    EngineConfig config;
+    config.threads = 1;
+    CEngine engine(config);
+    CBoard board;
+
+    SECTION("Running search") {
+        CCancelToken token;
+        std::atomic<int> iterations = 0;
+
+        std::future<SearchResult> future = engine.search(board, SearchLimits(), token, [&](const SearchInfo &) { ++iterations; });
+
+        while (iterations < 2) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        token.cancel();
+
+        REQUIRE(future.wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+        SearchResult result = future.get();
+        CHECK(result.depth >= 2);
+        CHECK(isLegalMove(board, result.bestMove));
+    }
+
+    SECTION("Queued searches") {
+        CCancelToken first, second;
+
+        std::future<SearchResult> running = engine.search(board, SearchLimits(), first);
+        std::future<SearchResult> queued = engine.search(board, depthLimit(3), second);
+
+        second.cancel();
+        first.cancel();
+
+        CHECK(running.get().depth >= 0);
+
+        SearchResult result = queued.get();
+        CHECK(result.depth == 0);
+        CHECK(result.bestMove == CMove());
+    }
+
+    SECTION("Cancel all") {
+        std::vector<std::future<SearchResult>> futures;
+        for (int i = 0; i < 3; ++i) futures.push_back(engine.search(board, SearchLimits()));
+
+        engine.cancelAll();
+        for (auto &future : futures) CHECK(future.wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+
+        // Searches queued afterwards are unaffected
+        CHECK(engine.search(board, depthLimit(2)).get().depth == 2);
+    }
+
+    SECTION("Callback exceptions") {
+        std::future<SearchResult> future = engine.search(board, depthLimit(2), CCancelToken(), nullptr,
+            [](const SearchResult &) { throw std::runtime_error("callback failed"); });
+
+        CHECK_THROWS_AS(future.get(), std::runtime_error);
+    }
+}
+
+TEST_CASE("Engine - Many callers") {
+    EngineConfig config;
+    config.threads = 3;
+    config.hashMegabytes = 4;
+    CEngine engine(config);
+
+    CHECK(engine.getThreads() == 3);
+
+    const std::vector<std::string> fens = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    };
+
+    std::atomic<int> legal = 0;
+    std::vector<std::thread> callers;
+
+    for (const auto &fen : fens) {
+        callers.emplace_back([&, fen]() {
+            CBoard board(fen);
+            std::vector<std::future<SearchResult>> futures;
+
+            for (int i = 0; i < 4; ++i) futures.push_back(engine.search(board, depthLimit(3)));
+            for (auto &future : futures) legal += isLegalMove(board, future.get().bestMove);
+        });
+    }
+
+    for (auto &caller : callers) caller.join();
+    CHECK(legal == 16);
+
+    engine.wait();
+    CHECK(engine.getQueued() == 0);
+
+    engine.newGame();
+    CHECK(engine.search(CBoard(), depthLimit(3)).get().depth == 3);
+}
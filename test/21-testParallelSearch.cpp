@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "chessbot/bench.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CExclusiveTable.h"
+#include "chessbot/CParallelSearch.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/constants.h"
+
+static bool isLegalMove(const CBoard &board, CMove move) {
+    std::vector<CMove> moves;
+    board.generateLegalMoves(&moves);
+
+    return std::find(moves.begin(), moves.end(), move) != moves.end();
+}
+
+TEST_CASE("Parallel search - Exclusive table") {
+    CExclusiveTable table(1000);
+    CBoard board;
+    CMove e4 = CMove::fromUci(board, "e2e4");
+    CMove d4 = CMove::fromUci(board, "d2d4");
+
+    CHECK(table.getSize() == 512);
+    CHECK(!table.isBusy(board.getKey(), e4));
+
+    table.enter(board.getKey(), e4);
+    CHECK(table.isBusy(board.getKey(), e4));
+    CHECK(!table.isBusy(board.getKey(), d4));
+    CHECK(!table.isBusy(board.getKey() ^ 1, e4));
+
+    // Leaving a move which is not there keeps the one which is
+    table.leave(board.getKey(), d4);
+    CHECK(table.isBusy(board.getKey(), e4));
+
+    table.leave(board.getKey(), e4);
+    CHECK(!table.isBusy(board.getKey(), e4));
+
+    table.enter(board.getKey(), d4);
+    table.clear();
+    CHECK(!table.isBusy(board.getKey(), d4));
+}
+
+TEST_CASE("Parallel search - One thread is a plain search") {
+    CBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+    SearchLimits limits;
+    limits.depth = 5;
+
+    auto tt = std::make_unique<CTranspositionTable>(1);
+    SearchResult plain = CSearch(tt.get()).search(board, limits);
+
+    tt->clear();
+    CParallelSearch parallel(tt.get(), 1, enumSmpMode::smpAbdada);
+    SearchResult result = parallel.search(board, limits);
+
+    CHECK(result.nodes == plain.nodes);
+    CHECK(result.bestMove == plain.bestMove);
+    CHECK(result.score == plain.score);
+}
+
+static const std::vector<enumSmpMode> SMP_MODES = { enumSmpMode::smpSharedHash, enumSmpMode::smpAbdada };
+
+TEST_CASE("Parallel search - Best move") {
+    for (enumSmpMode mode : SMP_MODES) {
+        auto tt = std::make_unique<CTranspositionTable>(4);
+        CParallelSearch search(tt.get(), 4, mode);
+
+        CHECK(search.getThreads() == 4);
+        CHECK(search.getMode() == mode);
+
+        CBoard board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        U64 key = board.getKey();
+
+        std::vector<int> depths;
+        search.setInfoCallback([&](const SearchInfo &info) { depths.push_back(info.depth); });
+
+        SearchLimits limits;
+        limits.depth = 6;
+        SearchResult result = search.search(board, limits);
+
+        CHECK(result.depth == 6);
+        CHECK(isLegalMove(board, result.bestMove));
+        CHECK(depths == std::vector<int>({ 1, 2, 3, 4, 5, 6 }));
+
+        // The main thread's board is left as it was given
+        CHECK(board.getKey() == key);
+        CHECK(board.isConsistent());
+
+        // Fewer threads, the same helpers are kept
+        search.setThreads(2);
+        CHECK(search.getThreads() == 2);
+
+        board.setFen("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1");
+        CHECK(isLegalMove(board, search.search(board, limits).bestMove));
+    }
+}
+
+TEST_CASE("Parallel search - Mate") {
+    for (enumSmpMode mode : SMP_MODES) {
+        auto tt = std::make_unique<CTranspositionTable>(4);
+        CParallelSearch search(tt.get(), 4, mode);
+        CBoard board("6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1");
+
+        SearchLimits limits;
+        limits.depth = 5;
+        SearchResult result = search.search(board, limits);
+
+        CHECK(result.bestMove == CMove::fromUci(board, "a1a8"));
+        CHECK(result.score == Constants::MATE_SCORE - 1);
+    }
+}
+
+TEST_CASE("Parallel search - Stop") {
+    for (enumSmpMode mode : SMP_MODES) {
+        auto tt = std::make_unique<CTranspositionTable>(4);
+        CParallelSearch search(tt.get(), 3, mode);
+        CBoard board;
+
+        // The movetime only bounds the test should a stop be lost
+        SearchLimits limits;
+        limits.movetime = 60000;
+
+        std::atomic<bool> searching = false;
+        search.setInfoCallback([&](const SearchInfo &) { searching = true; });
+
+        SearchResult result = { CMove(), 0, 0, 0 };
+        auto start = std::chrono::steady_clock::now();
+
+        search.resetStop();
+        std::thread searcher([&]() { result = search.search(board, limits); });
+
+        // Once the first iteration is reported the search is certainly running
+        while (!searching) std::this_thread::yield();
+        search.stop();
+        searcher.join();
+
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(30));
+        CHECK(result.nodes > 0);
+        CHECK(result.depth > 0);
+        CHECK(isLegalMove(board, result.bestMove));
+
+        // A stop sent before the search starts is kept, so not even the first iteration completes
+        search.stop();
+        result = search.search(board, limits);
+
+        CHECK(result.depth == 0);
+        CHECK(isLegalMove(board, result.bestMove));
+
+        // Until it is reset
+        search.resetStop();
+        limits.depth = 3;
+        CHECK(search.search(board, limits).depth == 3);
+    }
+}
+
+TEST_CASE("Parallel search - Time to depth") {
+    std::ostringstream out;
+    std::vector<Bench::TimeToDepth> runs = Bench::timeToDepth(4, 2, { 1, 2 }, out);
+
+    REQUIRE(runs.size() == 3);
+    CHECK(runs[0].threads == 1);
+    CHECK(!runs[0].abdada);
+    CHECK(runs[1].threads == 2);
+    CHECK(!runs[1].abdada);
+    CHECK(runs[2].threads == 2);
+    CHECK(runs[2].abdada);
+
+    for (const auto &run : runs) CHECK(run.nodes > 0);
+    CHECK(out.str().find("abdada") != std::string::npos);
+}
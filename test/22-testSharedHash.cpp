@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "chessbot/CMove.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/constants.h"
+
+static std::string sharedName() {
+    return "/chessbot-test-tt-" + std::to_string(getpid());
+}
+
+TEST_CASE("Shared hash - Shared memory") {
+    std::string name = sharedName();
+    CTranspositionTable::removeSharedMemory(name);
+
+    CTranspositionTable first(1), second(1);
+    CMove move(enumSquare::e2, enumSquare::e4, Constants::DOUBLE_PAWN_PUSH_FLAG);
+    TTData data;
+
+    first.store(0x1234ULL, move, 15, 20, 7, enumBound::exactBound);
+
+    REQUIRE(first.openSharedMemory(name, 1));
+    REQUIRE(second.openSharedMemory(name, 1));
+    CHECK(first.isShared());
+    CHECK(first.getSize() == second.getSize());
+
+    // The private entries are left behind
+    CHECK(!first.probe(0x1234ULL, &data));
+
+    first.store(0x1234ULL, move, 15, 20, 7, enumBound::exactBound);
+    REQUIRE(second.probe(0x1234ULL, &data));
+    CHECK(data.move == move);
+    CHECK(data.score == 15);
+    CHECK(data.depth == 7);
+
+    // Ageing is shared too, so entries from before either table's newSearch are replaced first
+    second.newSearch();
+    first.store(0x1234ULL, move, 16, 20, 1, enumBound::lowerBound);
+    REQUIRE(second.probe(0x1234ULL, &data));
+    CHECK(data.depth == 1);
+    CHECK(first.hashfull() == second.hashfull());
+
+    SECTION("Another process") {
+        pid_t child = fork();
+        REQUIRE(child >= 0);
+
+        if (child == 0) {
+            CTranspositionTable table(1);
+            bool shared = table.openSharedMemory(name, 1);
+            if (shared) table.store(0x5678ULL, move, -40, 0, 12, enumBound::upperBound);
+            _exit(shared ? 0 : 1);
+        }
+
+        int status;
+        REQUIRE(waitpid(child, &status, 0) == child);
+        CHECK(WEXITSTATUS(status) == 0);
+
+        REQUIRE(first.probe(0x5678ULL, &data));
+        CHECK(data.score == -40);
+        CHECK(data.depth == 12);
+        CHECK(data.bound == enumBound::upperBound);
+    }
+
+    SECTION("Different size") {
+        CTranspositionTable other(1);
+        CHECK(!other.openSharedMemory(name, 2));
+        CHECK(!other.isShared());
+
+        // Still usable as a private table
+        other.store(0x1234ULL, move, 15, 20, 7, enumBound::exactBound);
+        CHECK(other.probe(0x1234ULL, &data));
+    }
+
+    SECTION("Resizing leaves the shared table") {
+        second.resize(1);
+        CHECK(!second.isShared());
+        CHECK(!second.probe(0x1234ULL, &data));
+        CHECK(first.probe(0x1234ULL, &data));
+    }
+
+    CHECK(CTranspositionTable::removeSharedMemory(name));
+}
+
+TEST_CASE("Shared hash - File") {
+    std::string path = "/tmp/chessbot-test-tt-" + std::to_string(getpid()) + ".bin";
+    std::remove(path.c_str());
+
+    CMove move(enumSquare::g1, enumSquare::f3);
+    TTData data;
+
+    {
+        CTranspositionTable table(1);
+        REQUIRE(table.openFile(path, 1));
+        table.store(0xABCDULL, move, 33, 10, 9, enumBound::exactBound);
+    }
+
+    // The entries outlive the process in the file
+    CTranspositionTable table(1);
+    REQUIRE(table.openFile(path, 1));
+    REQUIRE(table.probe(0xABCDULL, &data));
+    CHECK(data.move == move);
+    CHECK(data.score == 33);
+
+    SECTION("Mismatched header") {
+        {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(8);
+            file.put(static_cast<char>(0x7F));
+        }
+
+        CTranspositionTable other(1);
+        CHECK(!other.openFile(path, 1));
+    }
+
+    SECTION("Not a table") {
+        std::string other = path + ".txt";
+        std::ofstream(other) << "not a transposition table";
+
+        CTranspositionTable text(1);
+        CHECK(!text.openFile(other, 1));
+
+        std::remove(other.c_str());
+    }
+
+    std::remove(path.c_str());
+}
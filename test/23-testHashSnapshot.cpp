@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+#include "chessbot/bench.h"
+#include "chessbot/CMove.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/constants.h"
+
+static std::string snapshotPath() {
+    return "/tmp/chessbot-test-" + std::to_string(getpid()) + ".snapshot";
+}
+
+static void overwriteByte(const std::string &path, std::streamoff offset) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(offset);
+    char byte = static_cast<char>(file.get() ^ 0x40);
+    file.seekp(offset);
+    file.put(byte);
+}
+
+TEST_CASE("Hash snapshot - Round trip") {
+    std::string path = snapshotPath();
+    CMove move(enumSquare::e7, enumSquare::e8, Constants::Q_PROMO_CAPTURE_FLAG);
+    TTData data;
+
+    CTranspositionTable tt(1);
+    tt.store(0x1111ULL, move, -300, 12, 9, enumBound::lowerBound);
+    tt.store(0x2222ULL, move, 40, 12, 2, enumBound::exactBound);
+
+    std::size_t saved = 0, loaded = 0;
+    REQUIRE(tt.saveSnapshot(path, 0, &saved));
+    CHECK(saved == 2);
+
+    // Into a table of a different size, after a few searches have gone by
+    CTranspositionTable other(2);
+    other.newSearch();
+    other.newSearch();
+
+    REQUIRE(other.loadSnapshot(path, &loaded));
+    CHECK(loaded == 2);
+
+    REQUIRE(other.probe(0x1111ULL, &data));
+    CHECK(data.move == move);
+    CHECK(data.score == -300);
+    CHECK(data.depth == 9);
+    CHECK(data.bound == enumBound::lowerBound);
+    CHECK(other.probe(0x2222ULL, &data));
+
+    // Loaded entries belong to the current search, so a shallower result does not replace them
+    other.store(0x1111ULL, CMove(), 0, 0, 1, enumBound::upperBound);
+    REQUIRE(other.probe(0x1111ULL, &data));
+    CHECK(data.depth == 9);
+
+    SECTION("Shallow entries are left out") {
+        REQUIRE(tt.saveSnapshot(path, 5, &saved));
+        CHECK(saved == 1);
+
+        CTranspositionTable filtered(1);
+        REQUIRE(filtered.loadSnapshot(path));
+        CHECK(filtered.probe(0x1111ULL, &data));
+        CHECK(!filtered.probe(0x2222ULL, &data));
+    }
+
+    SECTION("Deeper entries already in the table are kept") {
+        CTranspositionTable deeper(1);
+        deeper.store(0x2222ULL, CMove(), 10, 0, 20, enumBound::exactBound);
+
+        REQUIRE(deeper.loadSnapshot(path, &loaded));
+        CHECK(loaded == 1);
+        REQUIRE(deeper.probe(0x2222ULL, &data));
+        CHECK(data.depth == 20);
+    }
+
+    SECTION("Damaged snapshots") {
+        CTranspositionTable fresh(1);
+
+        // Zobrist fingerprint, then the second record's data
+        overwriteByte(path, 16);
+        CHECK(!fresh.loadSnapshot(path));
+
+        REQUIRE(tt.saveSnapshot(path));
+        overwriteByte(path, 40 + 16 + 8 + 3);
+        CHECK(!fresh.loadSnapshot(path));
+        CHECK(!fresh.probe(0x1111ULL, &data));
+
+        // Truncated
+        REQUIRE(tt.saveSnapshot(path));
+        REQUIRE(truncate(path.c_str(), 40 + 16 + 8) == 0);
+        CHECK(!fresh.loadSnapshot(path));
+
+        CHECK(!fresh.loadSnapshot(path + ".missing"));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Hash snapshot - Warm start") {
+    std::string path = snapshotPath();
+    std::ostringstream out;
+
+    Bench::WarmStart result = Bench::warmStart(5, 3, path, out);
+
+    CHECK(result.entries > 0);
+    CHECK(result.warmNodes < result.coldNodes);
+    CHECK(out.str().find("Warm time") != std::string::npos);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+#include "chessbot/bitbase.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/evaluate.h"
+#include "chessbot/tuner.h"
+
+static const std::vector<std::string> LABELLED = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1 [0.5]",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - c9 \"1-0\";",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1 [0.0]",
+    "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1 1-0",
+    "4k3/8/8/3q4/4P3/8/8/4K3 w - - 0 1 0-1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3 1/2-1/2",
+};
+
+static Tuner::TuningSet labelledSet() {
+    std::string path = "/tmp/chessbot-test-tuner-" + std::to_string(getpid()) + ".epd";
+
+    {
+        std::ofstream file(path);
+        for (const auto &line : LABELLED) file << line << "\n";
+        file << "not a position\n";
+    }
+
+    Tuner::TuningSet set;
+    Tuner::loadPositions(path, &set, 2);
+    std::remove(path.c_str());
+
+    return set;
+}
+
+TEST_CASE("Tuner - Labels") {
+    std::string fen;
+    float result;
+
+    REQUIRE(Tuner::parseLabel(LABELLED[1], &fen, &result));
+    CHECK(fen == "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -");
+    CHECK(result == 1.0f);
+
+    REQUIRE(Tuner::parseLabel(LABELLED[5], &fen, &result));
+    CHECK(fen == "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+    CHECK(result == 0.5f);
+
+    CHECK(!Tuner::parseLabel("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1", &fen, &result));
+}
+
+TEST_CASE("Tuner - Features match the evaluation") {
+    Tuner::TuningSet set = labelledSet();
+
+    REQUIRE(set.size() == LABELLED.size());
+    CHECK(set.malformed == 1);
+    CHECK(set.offsets.size() == set.size() + 1);
+
+    // The hanging queen is taken before the position is scored
+    CHECK(set.results[4] == 0.0f);
+    CHECK(set.offsets[5] - set.offsets[4] == 3);
+
+    Tuner::Weights weights = Tuner::Weights::current();
+    CTranspositionTable tt(1);
+    CSearch search(&tt);
+    std::vector<CMove> pv;
+
+    for (std::size_t i = 0; i < LABELLED.size(); ++i) {
+        std::string fen;
+        float result;
+        Tuner::parseLabel(LABELLED[i], &fen, &result);
+
+        CBoard board(fen);
+        search.resolve(board, &pv);
+        for (auto move : pv) board.makeMove(move);
+
+        // The bitbase scores king and pawn endings instead of the weights
+        bool win;
+        if (Bitbase::probeKpk(board, &win)) continue;
+
+        int eval = Evaluation::evaluate(board);
+        if (board.getSideToMove() == enumColour::black) eval = -eval;
+
+        CHECK(std::abs(Tuner::evaluate(set, i, weights) - eval) < 1.0);
+    }
+}
+
+TEST_CASE("Tuner - Gradient") {
+    Tuner::TuningSet set = labelledSet();
+    Tuner::Weights weights = Tuner::Weights::current(), gradient;
+    double k = 1.2;
+
+    double loss = Tuner::loss(set, weights, k, 2, &gradient);
+    CHECK(loss == Tuner::loss(set, weights, k, 1));
+
+    // Against central differences, for a material weight and a square
+    auto numeric = [&](double *weight) {
+        double original = *weight;
+        *weight = original + 1.0;
+        double above = Tuner::loss(set, weights, k);
+        *weight = original - 1.0;
+        double below = Tuner::loss(set, weights, k);
+        *weight = original;
+
+        return (above - below) / 2.0;
+    };
+
+    for (double *weight : { &weights.materialMg[enumPiece::nPawn], &weights.materialEg[enumPiece::nQueen], &weights.pstEg[enumPiece::nPawn][52] }) {
+        double expected = numeric(weight);
+        double difference = std::abs(expected - (weight == &weights.materialMg[enumPiece::nPawn] ? gradient.materialMg[enumPiece::nPawn]
+                                               : weight == &weights.materialEg[enumPiece::nQueen] ? gradient.materialEg[enumPiece::nQueen]
+                                               : gradient.pstEg[enumPiece::nPawn][52]));
+
+        CHECK(difference <= 1e-4 * std::abs(expected) + 1e-9);
+    }
+}
+
+TEST_CASE("Tuner - Tuning lowers the loss") {
+    Tuner::TuningSet set = labelledSet();
+    Tuner::Weights weights = Tuner::Weights::current();
+
+    Tuner::TunerConfig config;
+    config.epochs = 50;
+    config.threads = 2;
+    config.reportInterval = 0;
+
+    std::ostringstream out;
+    std::vector<Tuner::EpochReport> reports = Tuner::tune(set, &weights, config, out);
+
+    REQUIRE(reports.size() == 50);
+    CHECK(reports.back().loss < reports.front().loss);
+    CHECK(reports.back().positionsPerSecond > 0.0);
+}
+
+TEST_CASE("Tuner - Binary sets") {
+    Tuner::TuningSet set = labelledSet(), loaded;
+    std::string path = "/tmp/chessbot-test-tuner-" + std::to_string(getpid()) + ".bin";
+
+    REQUIRE(Tuner::saveBinary(path, set));
+    REQUIRE(Tuner::loadBinary(path, &loaded));
+
+    CHECK(loaded.offsets == set.offsets);
+    CHECK(loaded.features == set.features);
+    CHECK(loaded.signs == set.signs);
+    CHECK(loaded.phases == set.phases);
+    CHECK(loaded.results == set.results);
+
+    std::remove(path.c_str());
+    CHECK(!Tuner::loadBinary(path, &loaded));
+}
+
+TEST_CASE("Tuner - Corrupt binary sets") {
+    Tuner::TuningSet set = labelledSet();
+    std::string path = "/tmp/chessbot-test-tuner-corrupt-" + std::to_string(getpid()) + ".bin";
+    REQUIRE(Tuner::saveBinary(path, set));
+
+    std::string original;
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        original = contents.str();
+    }
+
+    // Writes the file with value at offset, then tries to load it
+    auto loadsWith = [&](std::size_t offset, const auto &value) {
+        std::string bytes = original;
+        std::memcpy(bytes.data() + offset, &value, sizeof(value));
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+
+        Tuner::TuningSet loaded;
+        return Tuner::loadBinary(path, &loaded);
+    };
+
+    std::size_t offsets = 3 * sizeof(U64);
+    std::size_t features = offsets + set.offsets.size() * sizeof(uint32_t);
+    std::size_t signs = features + set.features.size() * sizeof(uint16_t);
+
+    // Each write here leaves the file as it was, so it loads
+    CHECK(loadsWith(0, original[0]));
+
+    // Counts which do not match the file, one of them large enough to be an absurd allocation
+    CHECK(!loadsWith(sizeof(U64), U64(1) << 60));
+    CHECK(!loadsWith(sizeof(U64), U64(set.size() + 1)));
+    CHECK(!loadsWith(2 * sizeof(U64), U64(set.features.size() - 1)));
+
+    // Offsets going backwards, a feature past the last weight and a sign which is not one
+    CHECK(!loadsWith(offsets + sizeof(uint32_t), set.offsets[2] + 1));
+    CHECK(!loadsWith(features, uint16_t(Tuner::FEATURES)));
+    CHECK(!loadsWith(signs, int8_t(5)));
+
+    // Truncated
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << original.substr(0, original.size() - 1);
+    Tuner::TuningSet loaded;
+    CHECK(!Tuner::loadBinary(path, &loaded));
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("Tuner - Writes the weights header") {
+    std::ifstream file(CHESSBOT_EVAL_WEIGHTS);
+    std::stringstream header;
+    header << file.rdbuf();
+
+    // The current weights come out as the header they were read from
+    std::ostringstream out;
+    Tuner::writeWeights(Tuner::Weights::current(), out);
+
+    CHECK(out.str() == header.str());
+}
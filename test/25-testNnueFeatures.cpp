@@ -0,0 +1,193 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "chessbot/bitboard.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CTrainingData.h"
+#include "chessbot/nnue.h"
+
+static const std::vector<std::string> FENS = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "4k3/8/8/8/8/8/4P3/4K3 b - - 0 1",
+};
+
+static std::vector<int32_t> features(const CBoard &board, enumColour perspective, Nnue::enumFeatureSet set) {
+    std::vector<int32_t> active(Nnue::MAX_ACTIVE);
+    active.resize(Nnue::activeFeatures(board.getPieceSets(), perspective, set, active.data()));
+    std::sort(active.begin(), active.end());
+
+    return active;
+}
+
+TEST_CASE("Training data - Pack and unpack") {
+    for (const auto &fen : FENS) {
+        CBoard board(fen);
+        TrainingEntry entry = CTrainingData::pack(board, 123, -1);
+
+        std::array<U64, 8> pieceBB;
+        CTrainingData::unpack(entry, &pieceBB);
+
+        CHECK(pieceBB == board.getPieceSets());
+        CHECK(entry.sideToMove == board.getSideToMove());
+        CHECK(entry.score == 123);
+        CHECK(entry.result == -1);
+    }
+
+    // Scores beyond 16 bits are clamped
+    CHECK(CTrainingData::pack(CBoard(), 100000, 0).score == 32767);
+}
+
+TEST_CASE("Training data - Files") {
+    std::string path = "/tmp/chessbot-test-training-" + std::to_string(getpid()) + ".bin";
+
+    std::vector<TrainingEntry> entries;
+    for (const auto &fen : FENS) entries.push_back(CTrainingData::pack(CBoard(fen), 10, 1));
+    REQUIRE(CTrainingData::write(path, entries));
+
+    CTrainingData data(path);
+    REQUIRE(data.size() == FENS.size());
+    CHECK(data[1].occupied == CBoard(FENS[1]).getOccupiedSquares());
+
+    // A file which is not a whole number of entries is rejected
+    {
+        std::ofstream file(path, std::ios::app | std::ios::binary);
+        file << "x";
+    }
+
+    CTrainingData truncated;
+    CHECK(!truncated.open(path));
+    CHECK(!truncated.isOpen());
+    CHECK_THROWS_AS(CTrainingData(path + ".missing"), std::invalid_argument);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("NNUE - Active features") {
+    const std::vector<Nnue::enumFeatureSet> sets = { Nnue::halfKP, Nnue::halfKA };
+
+    for (auto set : sets) {
+        for (const auto &fen : FENS) {
+            CBoard board(fen);
+            int pieces = Bitboard::popcount(board.getOccupiedSquares());
+            int expected = set == Nnue::halfKP ? pieces - 2 : pieces;
+
+            for (auto perspective : { enumColour::white, enumColour::black }) {
+                std::vector<int32_t> active = features(board, perspective, set);
+
+                CHECK(static_cast<int>(active.size()) == expected);
+                CHECK(std::set<int32_t>(active.begin(), active.end()).size() == active.size());
+                CHECK(active.front() >= 0);
+                CHECK(active.back() < Nnue::featureCount(set));
+            }
+        }
+    }
+
+    // Own pawn on e2 with the king on e1, as either side sees it
+    CBoard board("4k3/4p3/8/8/8/8/4P3/4K3 w - - 0 1");
+    int32_t pawn = enumSquare::e1 * 10 * 64 + enumSquare::e2;
+    int32_t theirPawn = enumSquare::e1 * 10 * 64 + 5 * 64 + enumSquare::e7;
+
+    CHECK(features(board, enumColour::white, Nnue::halfKP) == std::vector<int32_t>{ pawn, theirPawn });
+    CHECK(features(board, enumColour::black, Nnue::halfKP) == std::vector<int32_t>{ pawn, theirPawn });
+}
+
+TEST_CASE("NNUE - Boards without valid features are rejected") {
+    // setFen takes both, but one has more pieces than a row holds and the other has no White king
+    CBoard crowded, kingless;
+    crowded.setFen("rnbqkbnr/pppppppp/pppppppp/8/8/PPPPPPPP/PPPPPPPP/RNBQKBNR w - - 0 1");
+    kingless.setFen("4k3/8/8/8/8/8/4P3/8 w - - 0 1");
+
+    std::vector<int32_t> row(Nnue::MAX_ACTIVE, 7);
+
+    for (auto set : { Nnue::halfKP, Nnue::halfKA }) {
+        for (auto perspective : { enumColour::white, enumColour::black }) {
+            CHECK(Nnue::activeFeatures(crowded.getPieceSets(), perspective, set, row.data()) == -1);
+            CHECK(Nnue::activeFeatures(kingless.getPieceSets(), perspective, set, row.data()) == -1);
+        }
+    }
+
+    CHECK(row == std::vector<int32_t>(Nnue::MAX_ACTIVE, 7));
+
+    // Rejected positions get rows of -1 without touching their neighbours
+    std::vector<CBoard> boards = { CBoard(FENS[0]), crowded, kingless, CBoard(FENS[1]) };
+    std::vector<int32_t> white(boards.size() * Nnue::MAX_ACTIVE), black(boards.size() * Nnue::MAX_ACTIVE);
+
+    CHECK(Nnue::extract(boards.data(), boards.size(), Nnue::halfKA, { white.data(), black.data() }) == 2);
+
+    for (std::size_t i = 0; i < boards.size(); ++i) {
+        bool rejected = i == 1 or i == 2;
+        auto begin = white.begin() + i * Nnue::MAX_ACTIVE;
+
+        CHECK(std::all_of(begin, begin + Nnue::MAX_ACTIVE, [](int32_t feature) { return feature == -1; }) == rejected);
+        if (!rejected) CHECK(*begin >= 0);
+    }
+
+    // Entries read from a file are checked as well, here one with an unknown piece code
+    std::vector<TrainingEntry> entries = { CTrainingData::pack(boards[0], 0, 0), CTrainingData::pack(boards[3], 0, 0) };
+    entries[1].pieces[0] |= 0x7;
+
+    std::array<U64, 8> pieceBB;
+    CHECK(!CTrainingData::unpack(entries[1], &pieceBB));
+    CHECK(Nnue::extract(entries.data(), entries.size(), Nnue::halfKA, { white.data(), black.data() }) == 1);
+    CHECK(white[Nnue::MAX_ACTIVE] == -1);
+    CHECK(black[Nnue::MAX_ACTIVE] == -1);
+}
+
+TEST_CASE("NNUE - Colour flipped positions swap perspectives") {
+    CBoard kiwipete("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    CBoard flipped("r3k2r/pppbbppp/2n2q1P/1P2p3/3pn3/BN2PNP1/P1PPQPB1/R3K2R b KQkq - 0 1");
+
+    for (auto set : { Nnue::halfKP, Nnue::halfKA }) {
+        CHECK(features(kiwipete, enumColour::white, set) == features(flipped, enumColour::black, set));
+        CHECK(features(kiwipete, enumColour::black, set) == features(flipped, enumColour::white, set));
+    }
+}
+
+TEST_CASE("NNUE - Batches") {
+    // Enough positions for the threads to get a slice each
+    std::vector<CBoard> boards;
+    std::vector<TrainingEntry> entries;
+
+    for (int i = 0; i < 4000; ++i) {
+        boards.emplace_back(FENS[i % FENS.size()]);
+        entries.push_back(CTrainingData::pack(boards.back(), i, i % 3 - 1));
+    }
+
+    std::size_t count = boards.size();
+    std::vector<int32_t> white(count * Nnue::MAX_ACTIVE), black(count * Nnue::MAX_ACTIVE);
+    std::vector<uint8_t> sideToMove(count);
+    std::vector<float> score(count), result(count);
+
+    Nnue::FeatureBatch batch = { white.data(), black.data(), sideToMove.data(), score.data(), result.data() };
+    Nnue::extract(entries.data(), count, Nnue::halfKA, batch, 3);
+
+    std::vector<int32_t> fromBoards(count * Nnue::MAX_ACTIVE), fromBoardsBlack(count * Nnue::MAX_ACTIVE);
+    std::vector<uint8_t> boardSides(count);
+    Nnue::extract(boards.data(), count, Nnue::halfKA, { fromBoards.data(), fromBoardsBlack.data(), boardSides.data() }, 1);
+
+    CHECK(white == fromBoards);
+    CHECK(black == fromBoardsBlack);
+    CHECK(sideToMove == boardSides);
+
+    for (std::size_t i = 0; i < count; i += 997) {
+        CHECK(score[i] == static_cast<float>(i));
+        CHECK(result[i] == (i % 3) * 0.5f);
+        CHECK(sideToMove[i] == boards[i].getSideToMove());
+
+        // Rows are padded after the active features
+        std::size_t active = Bitboard::popcount(boards[i].getOccupiedSquares());
+        CHECK(white[i * Nnue::MAX_ACTIVE + active - 1] >= 0);
+        if (active < Nnue::MAX_ACTIVE) CHECK(white[i * Nnue::MAX_ACTIVE + active] == -1);
+    }
+}
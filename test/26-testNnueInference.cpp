@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "chessbot/bench.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/CNnue.h"
+
+static std::vector<CBoard> benchBoards() {
+    std::vector<CBoard> boards;
+    for (const auto &fen : Bench::POSITIONS) boards.emplace_back(fen);
+
+    return boards;
+}
+
+TEST_CASE("NNUE - Batches score as single positions") {
+    CNnue network;
+    network.randomise(7);
+
+    std::vector<CBoard> boards = benchBoards();
+
+    // Enough positions for several threads, with a tile and a block left over
+    while (boards.size() < 600) boards.push_back(boards[boards.size() % Bench::POSITIONS.size()]);
+    boards.resize(603);
+
+    std::vector<int> single(boards.size()), threaded(boards.size());
+    network.evaluate(boards.data(), boards.size(), single.data(), 1);
+    network.evaluate(boards.data(), boards.size(), threaded.data(), 3);
+
+    bool distinct = false;
+
+    for (std::size_t i = 0; i < boards.size(); ++i) {
+        CHECK(single[i] == network.evaluate(boards[i]));
+        distinct |= single[i] != single[0];
+    }
+
+    CHECK(single == threaded);
+    CHECK(distinct);
+}
+
+TEST_CASE("NNUE - Side to move's point of view") {
+    CNnue network;
+    CHECK(network.evaluate(CBoard()) == 0);
+
+    network.randomise(11);
+
+    CBoard kiwipete("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+    CBoard flipped("r3k2r/pppbbppp/2n2q1P/1P2p3/3pn3/BN2PNP1/P1PPQPB1/R3K2R b KQkq - 0 1");
+
+    CHECK(network.evaluate(kiwipete) == network.evaluate(flipped));
+}
+
+TEST_CASE("NNUE - Boards without valid features") {
+    CNnue network;
+    network.randomise(3);
+
+    // setFen takes both, but one has more pieces than a row of features holds and the other has no White king
+    CBoard crowded, kingless;
+    crowded.setFen("rnbqkbnr/pppppppp/pppppppp/8/8/PPPPPPPP/PPPPPPPP/RNBQKBNR w - - 0 1");
+    kingless.setFen("4k3/8/8/8/8/8/4P3/8 w - - 0 1");
+
+    CHECK_THROWS_AS(network.evaluate(crowded), std::invalid_argument);
+    CHECK_THROWS_AS(network.evaluate(kingless), std::invalid_argument);
+
+    // In the tiles of a batch as well as the positions left over
+    std::vector<CBoard> boards(9, CBoard());
+    std::vector<int> scores(boards.size());
+    network.evaluate(boards.data(), boards.size(), scores.data());
+
+    for (std::size_t i : { 1, 8 }) {
+        std::vector<CBoard> bad = boards;
+        bad[i] = i == 1 ? crowded : kingless;
+        CHECK_THROWS_AS(network.evaluate(bad.data(), bad.size(), scores.data()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("NNUE - Network files") {
+    std::string path = "/tmp/chessbot-test-network-" + std::to_string(getpid()) + ".nnue";
+
+    CNnue network;
+    network.randomise(3);
+    REQUIRE(network.save(path));
+
+    CNnue loaded(path);
+    std::vector<CBoard> boards = benchBoards();
+    for (const auto &board : boards) CHECK(loaded.evaluate(board) == network.evaluate(board));
+
+    // A truncated file is rejected and leaves the network as it was
+    {
+        std::ifstream file(path, std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        std::ofstream truncated(path, std::ios::binary | std::ios::trunc);
+        truncated.write(contents.data(), contents.size() - 4);
+    }
+
+    CHECK(!loaded.load(path));
+    CHECK(loaded.evaluate(boards[1]) == network.evaluate(boards[1]));
+    CHECK_THROWS_AS(CNnue(path + ".missing"), std::invalid_argument);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chessbot/bitbase.h"
+#include "chessbot/CBoard.h"
+#include "chessbot/constants.h"
+#include "chessbot/CSearch.h"
+#include "chessbot/CTranspositionTable.h"
+#include "chessbot/evaluate.h"
+#include "chessbot/kpk_bitbase.h"
+
+static bool kpkWin(const std::string &fen) {
+    bool win = false;
+    REQUIRE(Bitbase::probeKpk(CBoard(fen), &win));
+
+    return win;
+}
+
+// Looks a position up in a queen or rook table, squares are enumSquare
+static bool pieceWins(const std::vector<U64> &table, enumPiece piece, enumColour sideToMove, int strongKing, int weakKing, int square) {
+    return Bitbase::isWin(table, Bitbase::index(piece, sideToMove, strongKing, weakKing, square));
+}
+
+TEST_CASE("Bitbase - Generated table matches the embedded one") {
+    std::vector<U64> table = Bitbase::generate(enumPiece::nPawn, 2);
+
+    REQUIRE(table.size() == Bitbase::KPK_WORDS);
+    CHECK(std::equal(table.begin(), table.end(), KpkBitbase::BITS.begin()));
+}
+
+TEST_CASE("Bitbase - King and pawn against king") {
+    // Rook pawn with the defending king in the corner, on either wing
+    CHECK(!kpkWin("k7/8/K7/P7/8/8/8/8 w - - 0 1"));
+    CHECK(!kpkWin("7k/8/7K/7P/8/8/8/8 w - - 0 1"));
+
+    // King on the sixth rank in front of the pawn wins whoever moves
+    CHECK(kpkWin("4k3/8/4K3/4P3/8/8/8/8 w - - 0 1"));
+    CHECK(kpkWin("4k3/8/4K3/4P3/8/8/8/8 b - - 0 1"));
+
+    // Outside the square of the pawn, for either colour
+    CHECK(kpkWin("8/8/8/8/P6k/8/8/K7 w - - 0 1"));
+    CHECK(kpkWin("k7/8/8/p6K/8/8/8/8 b - - 0 1"));
+
+    // The pawn is taken
+    CHECK(!kpkWin("8/8/8/8/8/8/4Pk2/K7 b - - 0 1"));
+
+    bool win;
+    CHECK(!Bitbase::probeKpk(CBoard(), &win));
+    CHECK(!Bitbase::probeKpk(CBoard("8/8/8/8/8/8/3PP3/K6k w - - 0 1"), &win));
+    CHECK(!Bitbase::probeKpk(CBoard("8/8/8/8/8/8/4R3/K6k w - - 0 1"), &win));
+}
+
+TEST_CASE("Bitbase - Rook and queen tables") {
+    std::vector<U64> rook = Bitbase::generate(enumPiece::nRook, 2);
+    std::vector<U64> queen = Bitbase::generate(enumPiece::nQueen, 2);
+
+    REQUIRE(rook.size() == Bitbase::PIECE_POSITIONS / 64);
+
+    // Stalemates
+    CHECK(!pieceWins(rook, enumPiece::nRook, enumColour::black, enumSquare::c8, enumSquare::a8, enumSquare::h7));
+    CHECK(!pieceWins(queen, enumPiece::nQueen, enumColour::black, enumSquare::b6, enumSquare::a8, enumSquare::c7));
+
+    // The rook is taken, unless the king protects it
+    CHECK(!pieceWins(rook, enumPiece::nRook, enumColour::black, enumSquare::h1, enumSquare::d8, enumSquare::d7));
+    CHECK(pieceWins(rook, enumPiece::nRook, enumColour::black, enumSquare::d6, enumSquare::d8, enumSquare::d7));
+
+    CHECK(pieceWins(rook, enumPiece::nRook, enumColour::black, enumSquare::b6, enumSquare::a8, enumSquare::c1));
+    CHECK(pieceWins(queen, enumPiece::nQueen, enumColour::white, enumSquare::a1, enumSquare::a8, enumSquare::h2));
+
+    // Black in check with White to move is not a position
+    CHECK(!pieceWins(queen, enumPiece::nQueen, enumColour::white, enumSquare::a1, enumSquare::a8, enumSquare::h1));
+}
+
+TEST_CASE("Bitbase - Evaluation and search") {
+    CBoard draw("k7/8/K7/P7/8/8/8/8 w - - 0 1");
+    CBoard win("4k3/8/4K3/4P3/8/8/8/8 b - - 0 1");
+
+    CHECK(Evaluation::evaluate(draw) == 0);
+    CHECK(Evaluation::evaluate(win) < -500);
+
+    auto tt = std::make_unique<CTranspositionTable>(1);
+    CSearch search(tt.get());
+
+    SearchLimits limits;
+    limits.depth = 12;
+
+    CHECK(search.search(draw, limits).score == Constants::DRAW_SCORE);
+    CHECK(search.search(win, limits).score < -500);
+}